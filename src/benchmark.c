@@ -0,0 +1,499 @@
+//	Drawing benchmarks
+//
+//	These are reached through the draw system call interrupt, which is an
+//	interrupt gate, so interrupts are off on entry. They are turned back on
+//	while timing since otherwise the tick count would never move.
+
+#include <stdint.h>
+#include <hal.h>
+#include <draw.h>
+#include <benchmark.h>
+#include <print.h>
+#include <vgamodes.h>
+#include <math.h>
+#include <fixed.h>
+#include <kprintf.h>
+#include "physicalmemorymanager.h"
+
+// Wait for the start of a new tick so that each measurement starts on a tick boundary
+static uint32_t BenchmarkStart()
+{
+	uint32_t ticks = HAL_GetTickCount();
+	while (HAL_GetTickCount() == ticks);
+	return ticks + 1;
+}
+
+// The benchmarks time drawing straight to VGA memory, so the back buffer and page flipping
+// are turned off while they run and put back afterwards
+typedef struct
+{
+	uint8_t BackBuffer;
+	uint8_t PageFlipping;
+} BenchmarkTarget;
+
+static void BenchmarkDirectToVGA(BenchmarkTarget * saved)
+{
+	saved->BackBuffer = GetBackBufferEnabled();
+	saved->PageFlipping = GetPageFlippingEnabled();
+	EnablePageFlipping(0);
+	EnableBackBuffer(0);
+}
+
+static void BenchmarkRestoreTarget(const BenchmarkTarget * saved)
+{
+	EnableBackBuffer(saved->BackBuffer);
+	EnablePageFlipping(saved->PageFlipping);
+}
+
+void Benchmark_SpanFill(SpanFillBenchmark * results)
+{
+	BenchmarkTarget target;
+	uint32_t start;
+	int i;
+	Rectangle screen = { .x = 0, .y = 0, .width = screenWidth, .height = screenHeight };
+	uint16_t radius = (screenWidth < screenHeight ? screenWidth : screenHeight) / 2 - 1;
+	Vector2 centre = { .x = screenWidth / 2, .y = screenHeight / 2 };
+
+	BenchmarkDirectToVGA(&target);
+	HAL_EnableInterrupts();
+
+	start = BenchmarkStart();
+	for (i = 0; i < BENCHMARK_ITERATIONS; i++)
+	{
+		ClearScreen((uint8_t)i);
+	}
+	results->ClearScreenTicks = HAL_GetTickCount() - start;
+
+	start = BenchmarkStart();
+	for (i = 0; i < BENCHMARK_ITERATIONS; i++)
+	{
+		FillRectangle(screen, (uint8_t)i);
+	}
+	results->FillRectangleTicks = HAL_GetTickCount() - start;
+
+	start = BenchmarkStart();
+	for (i = 0; i < BENCHMARK_ITERATIONS; i++)
+	{
+		FillCircle(centre, radius, (uint8_t)i);
+	}
+	results->FillCircleTicks = HAL_GetTickCount() - start;
+
+	BenchmarkRestoreTarget(&target);
+}
+
+// Count the pixels of a given colour in a rectangle
+static uint32_t CountPixels(int x, int y, int width, int height, uint8_t colour)
+{
+	uint32_t count = 0;
+	for (int row = y; row < y + height; row++)
+	{
+		for (int column = x; column < x + width; column++)
+		{
+			if (GetPixel(column, row) == colour)
+			{
+				count++;
+			}
+		}
+	}
+	return count;
+}
+
+void Benchmark_CircleFill(CircleFillBenchmark * results)
+{
+	uint16_t largest = (screenWidth < screenHeight ? screenWidth : screenHeight) / 2 - 1;
+	Vector2 centre = { .x = screenWidth / 2, .y = screenHeight / 2 };
+	uint32_t before;
+
+	results->Radius[0] = 1;
+	results->Radius[1] = 10;
+	results->Radius[2] = largest / 2;
+	results->Radius[3] = largest;
+	for (int i = 0; i < BENCHMARK_RADII; i++)
+	{
+		uint16_t radius = results->Radius[i];
+
+		ClearScreen(0);
+		before = GetPixelWriteCount();
+		FillCircle(centre, radius, 1);
+		results->CircleWrites[i] = GetPixelWriteCount() - before;
+		results->CirclePixels[i] = CountPixels(centre.x - radius, centre.y - radius, radius * 2 + 1, radius * 2 + 1, 1);
+
+		ClearScreen(0);
+		before = GetPixelWriteCount();
+		FillEllipse(centre, radius, radius / 2, 1);
+		results->EllipseWrites[i] = GetPixelWriteCount() - before;
+		results->EllipsePixels[i] = CountPixels(centre.x - radius, centre.y - radius / 2, radius * 2 + 1, (radius / 2) * 2 + 1, 1);
+	}
+}
+
+// Draw a sprite in the given mode over the whole screen, starting half a sprite
+// off the top left so the clipping paths are timed too
+static void BlitScreen(const void * sprite, uint8_t mode)
+{
+	int half = BENCHMARK_SPRITE_SIZE / 2;
+	for (int y = -half; y < screenHeight; y += BENCHMARK_SPRITE_SIZE)
+	{
+		for (int x = -half; x < screenWidth; x += BENCHMARK_SPRITE_SIZE)
+		{
+			Vector2 position = { .x = (uint16_t)x, .y = (uint16_t)y };
+			switch (mode)
+			{
+				case BLIT_OPAQUE:
+					BlitBitmap((const Bitmap *)sprite, position);
+					break;
+				case BLIT_KEYED:
+					BlitBitmapKeyed((const Bitmap *)sprite, position, 0);
+					break;
+				case BLIT_RLE:
+					BlitRLESprite((const RLESprite *)sprite, position);
+					break;
+				case BLIT_PLANAR:
+					BlitPlanarSprite((const PlanarSprite *)sprite, position);
+					break;
+				case BLIT_PLANAR_KEYED:
+					BlitPlanarSpriteKeyed((const PlanarSprite *)sprite, position, 0);
+					break;
+			}
+		}
+	}
+}
+
+void Benchmark_Blit(BlitBenchmark * results)
+{
+	int size = BENCHMARK_SPRITE_SIZE;
+	int half = size / 2;
+	Bitmap bitmap = { .Width = size, .Height = size };
+	RLESprite rle;
+	PlanarSprite planar;
+	uint32_t pixelBlocks = (size * size + 4095) / 4096;
+	uint32_t rleBlocks, start, before;
+	uint8_t mode;
+	const void * sprites[BLIT_MODES] = { &bitmap, &bitmap, &rle, &planar, &planar };
+	BenchmarkTarget target;
+
+	bitmap.Pixels = (uint8_t *)PMM_AllocateBlocks(pixelBlocks);
+	if (!bitmap.Pixels)
+	{
+		return;
+	}
+	// A striped disc on colour 0, which is used as the transparent colour
+	for (int y = 0; y < size; y++)
+	{
+		for (int x = 0; x < size; x++)
+		{
+			int dx = x - half;
+			int dy = y - half;
+			bitmap.Pixels[y * size + x] = dx * dx + dy * dy < half * half ? 32 + ((x + y) & 15) : 0;
+		}
+	}
+	rleBlocks = (GetRLESpriteSize(&bitmap, 0) + 4095) / 4096;
+	void * rleStorage = PMM_AllocateBlocks(rleBlocks);
+	void * planarStorage = PMM_AllocateBlocks(pixelBlocks);
+	if (!rleStorage || !planarStorage)
+	{
+		if (rleStorage)
+		{
+			PMM_FreeBlocks(rleStorage, rleBlocks);
+		}
+		if (planarStorage)
+		{
+			PMM_FreeBlocks(planarStorage, pixelBlocks);
+		}
+		PMM_FreeBlocks(bitmap.Pixels, pixelBlocks);
+		return;
+	}
+	CreateRLESprite(&rle, &bitmap, 0, rleStorage);
+	CreatePlanarSprite(&planar, &bitmap, planarStorage);
+
+	BenchmarkDirectToVGA(&target);
+	HAL_EnableInterrupts();
+
+	for (mode = 0; mode < BLIT_MODES; mode++)
+	{
+		ClearScreen(0);
+		before = GetPixelWriteCount();
+		start = BenchmarkStart();
+		for (int i = 0; i < BENCHMARK_ITERATIONS; i++)
+		{
+			BlitScreen(sprites[mode], mode);
+		}
+		results->Ticks[mode] = HAL_GetTickCount() - start;
+		results->Pixels[mode] = GetPixelWriteCount() - before;
+		results->PixelsPerTick[mode] = results->Pixels[mode] / (results->Ticks[mode] ? results->Ticks[mode] : 1);
+	}
+
+	BenchmarkRestoreTarget(&target);
+	PMM_FreeBlocks(planarStorage, pixelBlocks);
+	PMM_FreeBlocks(rleStorage, rleBlocks);
+	PMM_FreeBlocks(bitmap.Pixels, pixelBlocks);
+}
+
+void Benchmark_Fixed(FixedBenchmark * results)
+{
+	// Results go to volatiles so the calls cannot be optimised away
+	volatile float floatSink;
+	volatile fixed fixedSink;
+	uint64_t start;
+	int i;
+
+	start = HAL_ReadTimeStampCounter();
+	for (i = 0; i < BENCHMARK_MATHS_CALLS; i++)
+	{
+		floatSink = sin((float)i * 0.01f);
+	}
+	results->FloatSinCycles = (uint32_t)(HAL_ReadTimeStampCounter() - start) / BENCHMARK_MATHS_CALLS;
+
+	start = HAL_ReadTimeStampCounter();
+	for (i = 0; i < BENCHMARK_MATHS_CALLS; i++)
+	{
+		fixedSink = FixedSin((uint16_t)(i * 104));
+	}
+	results->FixedSinCycles = (uint32_t)(HAL_ReadTimeStampCounter() - start) / BENCHMARK_MATHS_CALLS;
+
+	start = HAL_ReadTimeStampCounter();
+	for (i = 0; i < BENCHMARK_MATHS_CALLS; i++)
+	{
+		floatSink = 1000.0f / (float)(i + 1);
+	}
+	results->FloatDivideCycles = (uint32_t)(HAL_ReadTimeStampCounter() - start) / BENCHMARK_MATHS_CALLS;
+
+	start = HAL_ReadTimeStampCounter();
+	for (i = 0; i < BENCHMARK_MATHS_CALLS; i++)
+	{
+		fixedSink = FixedDivide(FIXED_FROM_INT(1000), FIXED_FROM_INT(i + 1));
+	}
+	results->FixedDivideCycles = (uint32_t)(HAL_ReadTimeStampCounter() - start) / BENCHMARK_MATHS_CALLS;
+
+	start = HAL_ReadTimeStampCounter();
+	for (i = 0; i < BENCHMARK_MATHS_CALLS; i++)
+	{
+		fixedSink = FixedReciprocal(FIXED_FROM_INT(i + 1));
+	}
+	results->FixedReciprocalCycles = (uint32_t)(HAL_ReadTimeStampCounter() - start) / BENCHMARK_MATHS_CALLS;
+
+	start = HAL_ReadTimeStampCounter();
+	for (i = 0; i < BENCHMARK_MATHS_CALLS; i++)
+	{
+		fixedSink = FixedSqrt(FIXED_FROM_INT(i));
+	}
+	results->FixedSqrtCycles = (uint32_t)(HAL_ReadTimeStampCounter() - start) / BENCHMARK_MATHS_CALLS;
+	(void)floatSink;
+	(void)fixedSink;
+}
+
+// Screen sizes VGA_SetGraphicsMode accepts. Every combination is tried in
+// both chain4 and plane mode; the ones it rejects are skipped.
+static const uint16_t _modeWidths[] = { 256, 320, 360, 376, 400 };
+static const uint16_t _modeHeights[] = { 200, 224, 240, 256, 270, 300, 360, 400, 480, 564, 600 };
+
+typedef struct _ModeBenchmark
+{
+	const char *	Name;
+	// Number of primitives one call to Draw draws
+	uint32_t		Count;
+	void			(*Draw)(int iteration);
+} ModeBenchmark;
+
+static void ModeClear(int iteration)
+{
+	ClearScreen((uint8_t)iteration);
+}
+
+// Lines from the middle to the left and right edges at a given rise over 8
+static void ModeLines(int iteration, int rise)
+{
+	uint16_t run = screenHeight / 2 * 8 / rise;
+	if (run > screenWidth / 2)
+	{
+		run = screenWidth / 2;
+	}
+	Vector2 centre = { .x = screenWidth / 2, .y = screenHeight / 2 };
+	for (int i = 0; i < 4; i++)
+	{
+		Vector2 end = { .y = screenHeight / 2 + (i & 1 ? 1 : -1) * (int)(run * rise / 8) };
+		end.x = i & 2 ? centre.x + run : centre.x - run;
+		DrawLine(centre, end, (uint8_t)(iteration + i));
+	}
+}
+
+static void ModeLinesShallow(int iteration)
+{
+	ModeLines(iteration, 1);
+}
+
+static void ModeLinesDiagonal(int iteration)
+{
+	ModeLines(iteration, 8);
+}
+
+static void ModeLinesSteep(int iteration)
+{
+	ModeLines(iteration, 64);
+}
+
+static void ModeLinesHorizontal(int iteration)
+{
+	Vector2 start = { .x = 0 };
+	for (int i = 0; i < 4; i++)
+	{
+		start.y = screenHeight / 5 * (i + 1);
+		DrawHorizontalLine(start, screenWidth, (uint8_t)(iteration + i));
+	}
+}
+
+static void ModeLinesVertical(int iteration)
+{
+	Vector2 start = { .y = 0 };
+	for (int i = 0; i < 4; i++)
+	{
+		start.x = screenWidth / 5 * (i + 1);
+		DrawVerticalLine(start, screenHeight, (uint8_t)(iteration + i));
+	}
+}
+
+static void ModeRectangle(int iteration)
+{
+	Rectangle rect = { .x = screenWidth / 4, .y = screenHeight / 4, .width = screenWidth / 2, .height = screenHeight / 2 };
+	DrawRectangle(rect, (uint8_t)iteration);
+}
+
+static void ModeFilledRectangle(int iteration)
+{
+	Rectangle rect = { .x = screenWidth / 4 + 1, .y = screenHeight / 4, .width = screenWidth / 2, .height = screenHeight / 2 };
+	FillRectangle(rect, (uint8_t)iteration);
+}
+
+static void ModeCircle(int iteration)
+{
+	Vector2 centre = { .x = screenWidth / 2, .y = screenHeight / 2 };
+	DrawCircle(centre, screenHeight / 3, (uint8_t)iteration);
+}
+
+static void ModeFilledCircle(int iteration)
+{
+	Vector2 centre = { .x = screenWidth / 2, .y = screenHeight / 2 };
+	FillCircle(centre, screenHeight / 3, (uint8_t)iteration);
+}
+
+// A five pointed star filling the middle of the screen, which self intersects
+static void ModeStar(uint16_t * xPoints, uint16_t * yPoints)
+{
+	static const int8_t starX[5] = { 0, 29, -47, 47, -29 };
+	static const int8_t starY[5] = { -50, 40, -15, -15, 40 };
+	for (int i = 0; i < 5; i++)
+	{
+		xPoints[i] = screenWidth / 2 + starX[i] * (int)screenHeight / 128;
+		yPoints[i] = screenHeight / 2 + starY[i] * (int)screenHeight / 128;
+	}
+}
+
+static void ModePolygon(int iteration)
+{
+	uint16_t xPoints[5];
+	uint16_t yPoints[5];
+	ModeStar(xPoints, yPoints);
+	DrawPolygon(xPoints, yPoints, 5, (uint8_t)iteration);
+}
+
+static void ModeFilledPolygon(int iteration)
+{
+	uint16_t xPoints[5];
+	uint16_t yPoints[5];
+	ModeStar(xPoints, yPoints);
+	FillPolygonWithRule(xPoints, yPoints, 5, (uint8_t)iteration, FILL_NON_ZERO);
+}
+
+static void ModeText(int iteration)
+{
+	for (uint16_t y = 0; y + 8 <= screenHeight && y < 160; y += 10)
+	{
+		WriteText("The quick brown fox jumps", 0, y, (uint8_t)iteration);
+	}
+}
+
+static const ModeBenchmark _modeBenchmarks[] =
+{
+	{ "ClearScreen", 1, ModeClear },
+	{ "Line 1:8", 4, ModeLinesShallow },
+	{ "Line 1:1", 4, ModeLinesDiagonal },
+	{ "Line 8:1", 4, ModeLinesSteep },
+	{ "Horizontal", 4, ModeLinesHorizontal },
+	{ "Vertical", 4, ModeLinesVertical },
+	{ "Rectangle", 1, ModeRectangle },
+	{ "FillRect", 1, ModeFilledRectangle },
+	{ "Circle", 1, ModeCircle },
+	{ "FillCircle", 1, ModeFilledCircle },
+	{ "Polygon", 1, ModePolygon },
+	{ "FillPolygon", 1, ModeFilledPolygon },
+	{ "Text x16", 1, ModeText },
+};
+
+// Divide a cycle count, without the 64-bit division the kernel has no library support for.
+// Saturates if the result does not fit in 32 bits.
+static uint32_t DivideCycles(uint64_t cycles, uint32_t divisor)
+{
+	uint32_t quotient;
+	uint32_t remainder;
+	if ((uint32_t)(cycles >> 32) >= divisor)
+	{
+		return 0xffffffff;
+	}
+	asm("divl %4" : "=a"(quotient), "=d"(remainder) : "a"((uint32_t)cycles), "d"((uint32_t)(cycles >> 32)), "rm"(divisor));
+	return quotient;
+}
+
+static void BenchmarkMode(uint16_t width, uint16_t height, uint8_t chain4Mode)
+{
+	for (uint32_t b = 0; b < sizeof(_modeBenchmarks) / sizeof(_modeBenchmarks[0]); b++)
+	{
+		const ModeBenchmark * benchmark = &_modeBenchmarks[b];
+
+		ClearScreen(0);
+		uint32_t start = BenchmarkStart();
+		uint64_t cycles = HAL_ReadTimeStampCounter();
+		for (int i = 0; i < BENCHMARK_MODE_ITERATIONS; i++)
+		{
+			benchmark->Draw(i);
+		}
+		cycles = HAL_ReadTimeStampCounter() - cycles;
+		uint32_t ticks = HAL_GetTickCount() - start;
+
+		kserialprintf("%3ux%3u %-8s%-12s%8u%14u\n", width, height, chain4Mode ? "chain4" : "planar", benchmark->Name,
+					  ticks, DivideCycles(cycles, BENCHMARK_MODE_ITERATIONS * benchmark->Count));
+	}
+}
+
+void Benchmark_AllModes()
+{
+	uint16_t width = screenWidth;
+	uint16_t height = screenHeight;
+	uint8_t chain4Mode = chain4;
+
+	// Time drawing straight to VGA memory
+	EnablePageFlipping(0);
+	EnableBackBuffer(0);
+	HAL_EnableInterrupts();
+
+	HAL_SerialWriteString("\nMode            Primitive      Ticks   Cycles/prim\n");
+	for (uint32_t w = 0; w < sizeof(_modeWidths) / sizeof(_modeWidths[0]); w++)
+	{
+		for (uint32_t h = 0; h < sizeof(_modeHeights) / sizeof(_modeHeights[0]); h++)
+		{
+			for (uint8_t c = 0; c < 2; c++)
+			{
+				if (!VGA_SetGraphicsMode(_modeWidths[w], _modeHeights[h], c))
+				{
+					continue;
+				}
+				chain4 = c;
+				ResetClipRectangle();
+				BenchmarkMode(_modeWidths[w], _modeHeights[h], c);
+			}
+		}
+	}
+
+	VGA_SetGraphicsMode(width, height, chain4Mode);
+	chain4 = chain4Mode;
+	ResetClipRectangle();
+	ClearScreen(0);
+}
@@ -5,6 +5,9 @@ BITS 16
 ORG 9000h
 	jmp 	Second_Stage
 
+; The kernel is bigger than one 64KB segment, so reads carry on into the next segment
+%define READ_SECTORS_PAST_64K
+
 %include "functions_16.asm"
 %include "bpb.asm"						; The BIOS Parameter Block (i.e. information about the disk format)
 %include "floppy16.asm"					; Routines to access the floppy disk drive
@@ -24,9 +27,20 @@ ORG 9000h
 ; This is the above address once we are in 32-bit mode
 %define IMAGE_PMODE_LOAD_ADDR 10000h
 
+; Where the meshes for the 3D pipeline are loaded to. The kernel must end before this, and the
+; file must end before the kernel stack, which the kernel places in the two 4KB blocks below 80000h.
+; Both sizes are checked before loading (see CheckFileSize)
+%define MESH_RMODE_SEG		7000h
+%define MESH_RMODE_OFFSET	0000h
+%define MESH_PMODE_ADDR		70000h
+%define MESH_PMODE_END		7E000h
+
 ; kernel name (Must be a 8.3 filename and must be 11 bytes exactly)
 ImageName     db "KERNEL  SYS"
 
+; mesh file name (8.3, 11 bytes)
+MeshFileName  db "MESHES  DAT"
+
 ; This is where we will store the size of the kernel image in sectors (updated just before jump to kernel to be kernel size in bytes)
 ImageSize     			dd 0
 
@@ -35,6 +49,9 @@ BootInfo_StackTop		dd 0	; Address of top of stack
 BootInfo_KernelSize		dd 0	; Size of the kernel in bytes
 BootInfo_MemoryMap		dd 0	; Address of memory map
 BootInfo_BootDevice		db 0	; Boot device id
+						times 3 db 0	; Padding, to match the layout of the C structure
+BootInfo_MeshFileAddress	dd 0	; Address of the mesh file
+BootInfo_MeshFileSize	dd 0	; Size of the mesh file in bytes (whole sectors). 0 if not loaded
 
 ;	Start of the second stage of the boot loader
 	
@@ -70,9 +87,21 @@ Second_Stage:
 ;	First, load the root directory table
 	call	LoadRoot
 
+;	The kernel image (which includes its .bss) must end before the mesh file is loaded
+
+	mov		si, ImageName
+	mov		ebx, MESH_PMODE_ADDR - IMAGE_PMODE_LOAD_ADDR
+	call	CheckFileSize
+	cmp		ax, 1
+	jne		Load_Kernel
+	mov		si, msgKernelTooBig
+	call	Console_Write_16
+	jmp		Cannot_Continue
+
 ;	Load kernel.sys.  We have to load it into conventional memory since the BIOS routines
 ;   can only access conventional memory.  We will relocate it to high memory later
-    
+
+Load_Kernel:
 	mov		ebx, IMAGE_RMODE_SEG	; BX:BP points to memory address to load the file to
     mov		bp, IMAGE_RMODE_OFFSET
 	mov		si, ImageName			; The file to load
@@ -80,7 +109,7 @@ Second_Stage:
 
 	mov		dword [ImageSize], ecx	; Save size of kernel (in sectors)
 	cmp		ax, 0					; Test for successful load
-	je		Switch_To_Protected_Mode
+	je		Load_Meshes
 
 	mov		si, msgFailure			; Unable to load kernel.sys - print error
 	call	Console_Write_16
@@ -92,6 +121,60 @@ Cannot_Continue:
 	int     16h                    	; Wait for key press before continuing
 	int     19h                     ; Warm boot computer
 	hlt
+
+;	Find a file in the root directory and check that it fits in the room there is to load it.
+;	Files are loaded in whole sectors, so the room must be a multiple of the sector size.
+;	SI = file name, EBX = bytes of room.
+;	Returns AX = -1 if the file is not there, 1 if it is too big and 0 if it fits
+
+CheckFileSize:
+	push	es
+	push	di
+	push	word 0					; FindFile searches the root directory through ES:DI
+	pop		es
+	call	FindFile
+	cmp		ax, -1
+	je		CheckFileSize_Done
+	cmp		dword [es:di + 001Ch], ebx	; Size of the file in bytes, from its directory entry
+	jbe		CheckFileSize_Done		; AX is already 0
+	mov		ax, 1
+
+CheckFileSize_Done:
+	pop		di
+	pop		es
+	ret
+
+;	Load the mesh file the same way. It is optional; if it is missing, the kernel sees a size of 0.
+;	If it would run into the kernel stack, booting stops instead
+
+Load_Meshes:
+	call	LoadRoot				; Loading the FAT for the kernel overwrote the root directory
+	mov		si, MeshFileName
+	mov		ebx, MESH_PMODE_END - MESH_PMODE_ADDR
+	call	CheckFileSize
+	cmp		ax, -1
+	je		Switch_To_Protected_Mode
+	cmp		ax, 1
+	jne		Load_Mesh_File
+	mov		si, msgMeshTooBig
+	call	Console_Write_16
+	jmp		Cannot_Continue
+
+Load_Mesh_File:
+	push	word 0					; LoadFile leaves ES at the kernel's segment, but FindFile
+	pop		es						; searches the root directory through ES:DI
+	mov		ebx, MESH_RMODE_SEG
+	mov		bp, MESH_RMODE_OFFSET
+	mov		si, MeshFileName
+	call	LoadFile
+	cmp		ax, 0
+	jne		Switch_To_Protected_Mode
+
+	movzx	eax, cx					; Sectors loaded, converted to bytes
+	movzx	ebx, word [bpbBytesPerSector]
+	mul		ebx
+	mov		dword [BootInfo_MeshFileSize], eax
+	mov		dword [BootInfo_MeshFileAddress], MESH_PMODE_ADDR
 	
 ; 	We are now ready to switch to 32-bit protected mode
 
@@ -113,6 +196,8 @@ a20_msg_four	  db 'A20 line enabled using Fast A20 gate', 0
 no_a20_msg		  db 'Unable to enable A20 line.', 0	
 wait_for_key_msg  db 'Press a key to continue', 0
 msgFailure 	  	  db 'Unable to find KERNEL.SYS. ', 0
+msgKernelTooBig	  db 'KERNEL.SYS is too big to load below the mesh file. ', 0
+msgMeshTooBig	  db 'MESHES.DAT is too big to load below the kernel stack. ', 0
 
 a20_message_list  dw no_a20_msg
 				  dw a20_msg_one
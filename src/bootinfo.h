@@ -27,6 +27,8 @@ typedef struct _BootInfo
 	uint32_t	   KernelSize;		// Size of the kernel in bytes
 	MemoryRegion * MemoryRegions;	// Pointer to the memory map returned by the BIOS
 	uint8_t		   BootDevice;		// Id of boot device
+	uint32_t	   MeshFileAddress;	// Physical address of MESHES.DAT (see meshfile.h)
+	uint32_t	   MeshFileSize;	// Size of MESHES.DAT in bytes, rounded up to whole sectors. 0 if not found
 } BootInfo;
 
 #endif
\ No newline at end of file
@@ -3,13 +3,21 @@
 #include <stdint.h>
 #include <string.h>
 #include <console.h>
+#include <vgamodes.h>
 
-// Video memory
+// Video memory. Text mode can display from anywhere in the 32KB window at 0xB8000
 uint16_t *_videoMemory = (uint16_t *)0xB8000;
 
 #define CONSOLE_HEIGHT		25
 #define CONSOLE_WIDTH		80
 
+// Number of whole rows in the text window
+#define CONSOLE_WINDOW_ROWS	(0x8000 / 2 / CONSOLE_WIDTH)
+
+// Number of lines that have scrolled off the top of the screen that are kept for viewing.
+// Room is left in the window below them to scroll by moving the display start address
+#define CONSOLE_HISTORY_LINES	100
+
 // Current cursor position
 uint8_t _cursorX = 0;
 uint8_t _cursorY = 0;
@@ -17,61 +25,269 @@ uint8_t _cursorY = 0;
 // Current color
 uint8_t	_colour = 0;
 
-char stringBuffer[40];
-char hexChars[] = {'0','1','2','3','4','5','6','7','8','9','A','B','C','D','E','F'};
+// Hardware cursor position last sent to the CRT controller, so unchanged positions are not sent again
+uint16_t _hardwareCursor = 0xFFFF;
+
+// Row of the window that is the top of the screen. The rows above it hold the newest
+// history lines, so looking back through them only needs the start address changing
+uint16_t _topRow = 0;
+
+// Number of lines the view is scrolled back from the bottom of the output
+uint16_t _viewBack = 0;
+
+// Lines that have scrolled off the top of the screen, as a ring, used to fill the top of
+// the window again when the screen is moved back to the start of it
+uint16_t _history[CONSOLE_HISTORY_LINES][CONSOLE_WIDTH];
+uint16_t _historyNext = 0;
+uint16_t _historyCount = 0;
+
+// The keyboard interrupt moves the view (ConsoleScrollView) and may arrive while output is
+// changing _topRow, copying the window or writing the two start address registers. While
+// _displayBusy is set it only adds its lines to _pendingView, which the output code applies
+// when it has finished, so the start address is only ever written by one of them at a time
+volatile uint8_t _displayBusy = 0;
+volatile uint32_t _pendingView = 0;
+
+// Write an index and its value to the CRT controller with one out instruction, so nothing
+// can come between selecting the register and writing it
+static void OutputWordToVideoController(uint8_t index, uint8_t value)
+{
+	asm volatile("outw %0, %1"
+				 :
+				 : "a"((uint16_t)(index | (value << 8))), "Nd"((uint16_t)0x3D4));
+}
+
+// The CRT controller belongs to the console until a graphics mode has been set
 
-// Write byte to device through port mapped io
-void  OutputByteToVideoController(unsigned short portid, unsigned char value) 
+static bool ConsoleOwnsDisplay()
 {
-	asm volatile("movb	%1, %%al \n\t"
-				 "movw	%0, %%dx \n\t"
-				  "out	%%al, %%dx"
-				 : : "m" (portid), "m" (value));
-				 
+	return VGA_GetModeSetCount() == 0;
 }
 
-// Update hardware cursor position
+// Update hardware cursor position. The cursor location counts from the start of the
+// window, not the start of the screen
 
 void UpdateCursorPosition(int x, int y) 
 {
-    uint16_t cursorLocation = y * 80 + x;
+    uint16_t cursorLocation = (_topRow + y) * CONSOLE_WIDTH + x;
+
+	if (cursorLocation == _hardwareCursor || !ConsoleOwnsDisplay())
+	{
+		return;
+	}
+	// Send location to VGA controller to set cursor, high byte then low byte
+	OutputWordToVideoController(14, cursorLocation >> 8);
+	OutputWordToVideoController(15, cursorLocation & 0xFF);
+	_hardwareCursor = cursorLocation;
+}
+
+// Show the window from the given row down
+
+static void SetDisplayStartRow(unsigned int row)
+{
+	uint16_t startAddress = row * CONSOLE_WIDTH;
+
+	if (ConsoleOwnsDisplay())
+	{
+		OutputWordToVideoController(12, startAddress >> 8);
+		OutputWordToVideoController(13, startAddress & 0xFF);
+	}
+}
+
+// Move the view through the history by a number of lines, as far as there are lines to show.
+// Only called by whichever of the output code and the keyboard interrupt has the display
+
+static void MoveView(int lines)
+{
+	int viewBack = _viewBack + lines;
+	int available = _topRow < _historyCount ? _topRow : _historyCount;
+
+	if (viewBack < 0)
+	{
+		viewBack = 0;
+	}
+	if (viewBack > available)
+	{
+		viewBack = available;
+	}
+	_viewBack = viewBack;
+	SetDisplayStartRow(_topRow - _viewBack);
+}
+
+// Take the lines the view is waiting to move by. The exchange is one instruction, so
+// lines the interrupt adds are either taken now or left for next time
+
+static int TakePendingView()
+{
+	uint32_t lines = 0;
 
-	// Send location to VGA controller to set cursor
-	// Send the high byte
-	OutputByteToVideoController(0x3D4, 14);
-	OutputByteToVideoController(0x3D5, cursorLocation >> 8); 
-	// Send the low byte
-	OutputByteToVideoController(0x3D4, 15);
-	OutputByteToVideoController(0x3D5, cursorLocation);      
+	asm volatile("xchgl %0, %1"
+				 : "+r"(lines), "+m"(_pendingView)
+				 :
+				 : "memory");
+	return (int)lines;
 }
 
-void Scroll() 
+static void ApplyPendingView()
 {
-	if (_cursorY >= CONSOLE_HEIGHT) 
+	int lines = TakePendingView();
+
+	if (lines)
 	{
+		MoveView(lines);
+	}
+}
+
+// Keep the keyboard interrupt away from _topRow and the start address while output changes them
+
+static void ClaimDisplay()
+{
+	_displayBusy = 1;
+}
 
-		uint16_t attribute = _colour << 8;
+// Hand the display back. The lines the keyboard interrupt asked for in the meantime move
+// the view, or are dropped if the output has brought the view back to the bottom, since
+// output always leaves it there. An interrupt after _displayBusy is cleared moves the view itself
 
-		// Move current display up one line
-		int line25 = (CONSOLE_HEIGHT - 1) * CONSOLE_WIDTH;
-		for (int i = 0; i < line25; i++)
+static void ReleaseDisplay(bool viewReset)
+{
+	_displayBusy = 0;
+	while (_pendingView)
+	{
+		_displayBusy = 1;
+		if (viewReset)
 		{
-			_videoMemory[i] = _videoMemory[i + CONSOLE_WIDTH];
+			TakePendingView();
 		}
-		// Clear the bottom line
-		for (int i = line25; i < line25 + 80; i++)
+		else
 		{
-			_videoMemory[i] = attribute | ' ';
+			ApplyPendingView();
 		}
-		_cursorY = 25;
+		_displayBusy = 0;
 	}
 }
 
-// Displays a character
-void ConsoleWriteCharacter(unsigned char c) 
+// Return the address of a row of the screen
+
+static uint16_t * ScreenRow(unsigned int y)
+{
+	return _videoMemory + (_topRow + y) * CONSOLE_WIDTH;
+}
+
+// Copy and fill character cells. Rows are a whole number of dwords, so both are done
+// two cells at a time with string instructions. Copies may overlap if destination is lower
+
+static void CopyCells(uint16_t * destination, const uint16_t * source, uint32_t cells)
+{
+	uint32_t count = cells / 2;
+
+	asm volatile("cld\n\t"
+				 "rep movsl"
+				 : "+D"(destination), "+S"(source), "+c"(count)
+				 :
+				 : "memory");
+}
+
+static void FillCells(uint16_t * destination, uint16_t value, uint32_t cells)
+{
+	uint32_t count = cells / 2;
+
+	asm volatile("cld\n\t"
+				 "rep stosl"
+				 : "+D"(destination), "+c"(count)
+				 : "a"(value | ((uint32_t)value << 16))
+				 : "memory");
+}
+
+// Keep a line that is about to scroll off the top of the screen
+
+static void SaveHistoryLine(const uint16_t * line)
+{
+	CopyCells(_history[_historyNext], line, CONSOLE_WIDTH);
+	_historyNext = (_historyNext + 1) % CONSOLE_HISTORY_LINES;
+	if (_historyCount < CONSOLE_HISTORY_LINES)
+	{
+		_historyCount++;
+	}
+}
+
+// Move the screen up by the given number of lines and blank the lines that come in at the
+// bottom. The screen moves down the window, so nothing on it is copied; only when it would
+// run off the end of the window is it copied back to the start, below the history lines
+// rewritten from the ring. That happens once every CONSOLE_WINDOW_ROWS - CONSOLE_HEIGHT -
+// CONSOLE_HISTORY_LINES lines or so
+
+static void ScrollLines(unsigned int lines)
+{
+	if (lines > CONSOLE_HEIGHT)
+	{
+		lines = CONSOLE_HEIGHT;
+	}
+	ClaimDisplay();
+	for (unsigned int i = 0; i < lines; i++)
+	{
+		SaveHistoryLine(ScreenRow(i));
+	}
+	if (_topRow + lines + CONSOLE_HEIGHT <= CONSOLE_WINDOW_ROWS)
+	{
+		_topRow += lines;
+	}
+	else
+	{
+		// The history lines go above the rows that stay on screen, oldest first. The rows that
+		// stay are always further down the window than where they are going
+		uint16_t keptRows = CONSOLE_HEIGHT - lines;
+		uint16_t line = (_historyNext + CONSOLE_HISTORY_LINES - _historyCount) % CONSOLE_HISTORY_LINES;
+
+		CopyCells(_videoMemory + _historyCount * CONSOLE_WIDTH, ScreenRow(lines), keptRows * CONSOLE_WIDTH);
+		for (uint16_t row = 0; row < _historyCount; row++)
+		{
+			CopyCells(_videoMemory + row * CONSOLE_WIDTH, _history[line], CONSOLE_WIDTH);
+			line = (line + 1) % CONSOLE_HISTORY_LINES;
+		}
+		_topRow = _historyCount;
+	}
+	FillCells(ScreenRow(CONSOLE_HEIGHT - lines), ' ' | (_colour << 8), lines * CONSOLE_WIDTH);
+	SetDisplayStartRow(_topRow - _viewBack);
+	ReleaseDisplay(false);
+}
+
+// Scroll in the lines the cursor has moved below the bottom of the screen, all in one go
+
+static void ScrollPending()
+{
+	if (_cursorY >= CONSOLE_HEIGHT)
+	{
+		ScrollLines(_cursorY - CONSOLE_HEIGHT + 1);
+		_cursorY = CONSOLE_HEIGHT - 1;
+	}
+}
+
+// Move the cursor down a line. Below the bottom of the screen this only counts the lines
+// to scroll; a whole screen of them is as many as can make a difference
+
+static void NewLine()
+{
+	if (_cursorY < CONSOLE_HEIGHT * 2 - 1)
+	{
+		_cursorY++;
+	}
+}
+
+// Put a character in video memory and move the cursor on, without scrolling or
+// touching the hardware cursor. A line feed at the bottom of the screen leaves the
+// cursor below it, so that several line feeds become one scroll when the output is
+// finished (see FinishOutput)
+
+static void PutCharacter(unsigned char c)
 {
     uint16_t attribute = _colour << 8;
 
+	if (c >= ' ' && _cursorY >= CONSOLE_HEIGHT)
+	{
+		// The character is going on a new line that has not been scrolled in yet
+		ScrollPending();
+	}
     if (c == 0x08 && _cursorX)
 	{
 		// Backspace character
@@ -91,54 +307,45 @@ void ConsoleWriteCharacter(unsigned char c)
 	{
 		// New line
         _cursorX = 0;
-        _cursorY++;
+        NewLine();
 	}
     else if (c >= ' ') 
 	{
 		// Printable characters
 
 		// Display character on screen
-        uint16_t* location = _videoMemory + (_cursorY * CONSOLE_WIDTH + _cursorX);
-        *location = c | attribute;
+        ScreenRow(_cursorY)[_cursorX] = c | attribute;
         _cursorX++;
     }
     // If we are at edge of row, go to new line
     if (_cursorX >= CONSOLE_WIDTH) 
 	{
         _cursorX = 0;
-        _cursorY++;
+        NewLine();
     }
-	// If we are at the last line, scroll up
-	if (_cursorY >= CONSOLE_HEIGHT)
-	{
-		Scroll();
-		_cursorY = CONSOLE_HEIGHT - 1;
-	}
-    //! update hardware cursor
-	UpdateCursorPosition (_cursorX,_cursorY);
 }
 
-void ConsoleWriteInt(unsigned int i, unsigned int base) 
+// Scroll in any lines the cursor has moved below the screen and show the cursor where it now is
+
+static void FinishOutput()
 {
-    int pos = 0;
-	
-    if (i == 0 || base > 16) 
-    {
-		ConsoleWriteCharacter('0');
-    }
-	else
+	ScrollPending();
+	ClaimDisplay();
+	if (_viewBack)
 	{
-		while (i != 0) 
-		{
-			stringBuffer[pos] = hexChars[i % base];
-			pos++;
-			i /= base;
-		}
-		while (--pos >= 0)
-		{
-			ConsoleWriteCharacter(stringBuffer[pos]);
-		}
+		// Output always brings the view back to the bottom
+		_viewBack = 0;
+		SetDisplayStartRow(_topRow);
 	}
+	ReleaseDisplay(true);
+	UpdateCursorPosition(_cursorX, _cursorY);
+}
+
+// Displays a character
+void ConsoleWriteCharacter(unsigned char c) 
+{
+	PutCharacter(c);
+	FinishOutput();
 }
 
 // Sets new font colour and returns the old colour
@@ -152,12 +359,14 @@ unsigned int ConsoleSetColour(const uint8_t c)
 // Set new cursor position
 void ConsoleGotoXY(unsigned int x, unsigned int y) 
 {
-	if (_cursorX <= CONSOLE_WIDTH - 1)
+	if (x < CONSOLE_WIDTH)
 	{
 	    _cursorX = x;
 	}
-	if (_cursorY <= CONSOLE_HEIGHT - 1)
+	if (y < CONSOLE_HEIGHT)
+	{
 	    _cursorY = y;
+	}
 
 	//! update hardware cursor to new position
 	UpdateCursorPosition(_cursorX, _cursorY);
@@ -190,14 +399,35 @@ int ConsoleGetHeight()
 void ConsoleClearScreen(const uint8_t c) 
 {
 	_colour = c;
-	uint16_t blank = ' ' | (c << 8);
-	for (int i = 0; i < 80*25; i++)
+	FillCells(ScreenRow(0), ' ' | (c << 8), CONSOLE_WIDTH * CONSOLE_HEIGHT);
+	ClaimDisplay();
+	if (_viewBack)
 	{
-        _videoMemory[i] = blank;
+		_viewBack = 0;
+		SetDisplayStartRow(_topRow);
 	}
+	ReleaseDisplay(true);
     ConsoleGotoXY(0,0);
 }
 
+// Move the view through the history. The lines are already in the window above the
+// screen, so only the start address changes. Called from the keyboard interrupt, so if
+// output has the display the lines are left for it to apply
+
+bool ConsoleScrollView(int lines)
+{
+	if (!ConsoleOwnsDisplay())
+	{
+		return false;
+	}
+	_pendingView += lines;
+	if (!_displayBusy)
+	{
+		ApplyPendingView();
+	}
+	return true;
+}
+
 // Display specified string
 
 void ConsoleWriteString(char* str) 
@@ -208,8 +438,9 @@ void ConsoleWriteString(char* str)
 	}
 	while (*str)
 	{
-		ConsoleWriteCharacter(*str++);
+		PutCharacter(*str++);
 	}
+	FinishOutput();
 }
 
 
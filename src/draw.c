@@ -3,391 +3,2371 @@
 #include <print.h>
 #include <hal.h>
 #include <math.h>
+#include <string.h>
+#include <vgamodes.h>
+#include <vgamemory.h>
+#include <palette.h>
+#include <font.h>
+#include "physicalmemorymanager.h"
+
+#define MAX_DIRTY_RECTS 16
+#define MAX_PRESENT_HISTORY 2
+//Opaque texts per frame that can wait for Present to be latch copied from the glyph cache
+#define MAX_CACHED_TEXTS 16
+#define CACHED_TEXT_LENGTH 80
+//Rectangles copied by one Present: the dirty regions of every frame the page missed, the boxes
+//of cached texts that were drawn over, and the pieces left when cached text is cut out of them
+#define MAX_PRESENT_RECTS 256
+
+//Polygons with more edges than this allocate their edge table from the physical memory manager
+#define POLYGON_STATIC_EDGES 1024
+//Tallest screen mode that VGA_SetGraphicsMode supports
+#define POLYGON_MAX_ROWS 600
+
+//An edge in the polygon edge table. x is 16.16 fixed point and steps by dx each row
+typedef struct {
+    int32_t x;
+    int32_t dx;
+    int32_t yEnd;
+    int32_t next;
+    int8_t winding;
+} PolygonEdge;
 
 uint8_t *_vgaMemory = (uint8_t *)0xA0000;
 
-void SetPixel(uint16_t x, uint16_t y, const uint8_t colour)
+//Off-screen linear 8bpp copy of the screen in normal RAM. 0 when drawing straight to VGA memory
+static uint8_t *_backBuffer = 0;
+static uint32_t _backBufferBlocks = 0;
+
+//Regions of the back buffer that have changed since the last Present
+static Rectangle _dirtyRects[MAX_DIRTY_RECTS];
+static int _dirtyCount = 0;
+static int _lastDirty = 0;
+
+//When page flipping, the regions changed in the previous frames are still out of date
+//in the pages that were on screen at the time, so they are copied again
+static Rectangle _previousDirty[MAX_PRESENT_HISTORY][MAX_DIRTY_RECTS];
+static int _previousDirtyCount[MAX_PRESENT_HISTORY];
+static Rectangle _presentRects[MAX_PRESENT_RECTS];
+
+//Page flipping state. Primitives draw into _drawPage while another page is displayed
+static uint8_t _pageFlipping = 0;
+static uint8_t _drawPage = 0;
+static uint32_t _flips = 0;
+
+//Number of pixels written by the primitives, used to check for overdraw
+static uint32_t _pixelWrites = 0;
+
+//Clip rectangle. Nothing is drawn outside it. When not set it is the whole screen.
+//Coordinates are treated as signed 16 bit while clipping, so positions that have gone
+//negative and wrapped round clip against the left and top edges
+static uint8_t _clipSet = 0;
+static Rectangle _clipRect;
+
+//Cohen-Sutherland outcodes
+#define CLIP_LEFT 1
+#define CLIP_RIGHT 2
+#define CLIP_TOP 4
+#define CLIP_BOTTOM 8
+
+//Buffers for polygon vertices, in 24.8 fixed point so that the points where clipped edges
+//cross the clip rectangle keep their fractions. Each Sutherland-Hodgman stage can add
+//vertices, so they are sized well beyond the polygons that are clipped
+#define CLIP_MAX_SIDES 256
+#define CLIP_MAX_VERTICES POLYGON_STATIC_EDGES
+static int32_t _clipX[3][CLIP_MAX_VERTICES];
+static int32_t _clipY[3][CLIP_MAX_VERTICES];
+
+//Widest screen mode that VGA_SetGraphicsMode supports
+#define COPY_MAX_WIDTH 400
+//One row of pixels, used when a plane mode copy moves pixels into different planes
+static uint8_t _copyRow[COPY_MAX_WIDTH];
+
+//Glyph cache. In plane mode the VGA memory past the pages in use holds text cells that have been
+//drawn before: a glyph in one colour on one background, starting at one of the 4 pixels of a
+//byte. The 9 columns of a cell fit in 3 bytes whatever the start, so each slot is 3 bytes wide
+//and FONT_HEIGHT rows high, and a cell reaches the screen as a latch copy. Cells are hashed to
+//a group of GLYPH_CACHE_WAYS slots; key 0 is an empty slot
+#define GLYPH_CELL_BYTES 3
+#define GLYPH_CACHE_WAYS 8
+#define GLYPH_CACHE_MAX_SLOTS 1024
+static uint32_t _glyphKeys[GLYPH_CACHE_MAX_SLOTS];
+static uint16_t _glyphSlots = 0;
+static uint16_t _glyphSlotsPerBand = 0;
+//first row of the slots, counted from the start of VGA memory
+static uint16_t _glyphFirstRow = 0;
+//the mode switch and number of pages in use the slots were laid out for. When either changes
+//their contents may have been drawn over
+static uint32_t _glyphModeSets = 0;
+static uint8_t _glyphPages = 0;
+static uint8_t _glyphNextWay = 0;
+
+//Opaque text drawn with a back buffer in plane mode. It is drawn into the back buffer as usual but
+//not marked dirty; Present latch copies it from the glyph cache instead of copying it from the back
+//buffer a pixel at a time. Index 0 is the frame being drawn and h + 1 the frame h + 1 Presents ago,
+//kept for the pages that missed it when page flipping, like _previousDirty
+typedef struct {
+    Rectangle box;
+    int16_t x;
+    int16_t y;
+    uint8_t colour;
+    uint8_t background;
+    uint8_t latch;
+    char text[CACHED_TEXT_LENGTH + 1];
+} CachedText;
+static CachedText _cachedTexts[MAX_PRESENT_HISTORY + 1][MAX_CACHED_TEXTS];
+static int _cachedTextCount[MAX_PRESENT_HISTORY + 1];
+//with the glyph cache, further down
+static uint8_t GlyphCacheReady();
+static void LatchText(const char* text, int x, int y, uint8_t colour, uint8_t background, const Rectangle* box);
+//with CopyRect, further down
+static void LatchCopyBytes(int srcOffset, int dstOffset, int bytes, int rows, uint8_t mask, int backwards);
+
+//Pixel batch. In plane mode, pixels drawn by lines and outlines are bucketed by plane
+//(x & 3) and written a plane at a time, so a primitive needs at most 4 map mask writes
+//rather than one each time consecutive pixels are in different planes
+#define PIXEL_BATCH_SIZE 1024
+static uint16_t _batchOffsets[4][PIXEL_BATCH_SIZE];
+static uint16_t _batchCount[4];
+static int _batchDepth = 0;
+static uint8_t _batchPlanar = 0;
+static uint8_t _batchColour = 0;
+
+static uint8_t* LinearTarget()
 {
-    if (!chain4) {
+    //Returns the linear buffer primitives draw into, or 0 if they draw into plane mode VGA memory
+    if (_backBuffer) {
+        return _backBuffer;
+    }
+    return chain4 ? _vgaMemory : 0;
+}
+
+static void PlotPixel(uint16_t x, uint16_t y, const uint8_t colour)
+{
+    uint8_t* target = LinearTarget();
+    _pixelWrites++;
+    if (!target) {
         //select a plane to enable writing to based on x position
         // (x & 3) gets plane between 0-3
         // eg x = 5:
         // 101 (5) & 011 (3) = 001 (1) so second plane
-        HAL_OutputByteToPort(0x3c5, 0x01 << (x & 3));
-        _vgaMemory[(screenWidth * y + x)/4] = colour;
+        SetMapMask(0x01 << (x & 3));
+        VGA_WRITE(&_vgaMemory[(screenWidth * y + x)/4], colour);
     } else {
-        _vgaMemory[(screenWidth * y + x)] = colour;
+        target[(screenWidth * y + x)] = colour;
     }
 }
 
-void ClearScreen(uint8_t colour)
+static void FlushPixelBatch()
 {
-    // 90 ticks (400x600)
-    // int i;
-    // int val = screenHeight * screenWidth;
-    // for (i = 0; i < val; i++)
-    // {
-    //     _vgaMemory[i] = colour;
-    // }
-
-    //48 ticks (400x600)
-    //We don't need to worry about planes here, as its still the same block of memory
-    uint8_t* base = _vgaMemory;
-    int val = screenHeight * screenWidth;
-    while(val){
-        base[--val] = colour;
+    //Write out the batched pixels one plane at a time
+    for (int plane = 0; plane < 4; plane++) {
+        uint16_t count = _batchCount[plane];
+        if (count == 0) {
+            continue;
+        }
+        SetMapMask(0x01 << plane);
+        uint16_t* offsets = _batchOffsets[plane];
+        for (int i = 0; i < count; i++) {
+            VGA_WRITE(&_vgaMemory[offsets[i]], _batchColour);
+        }
+        _batchCount[plane] = 0;
     }
 }
 
-Vector2 Reverse32BitMergeVector2(uint32_t a) {
-    //bitshifts 16 to get first value
-    //then ANDs with 0x0000FFFF to get the second
-    uint32_t tStart = a;
-    uint32_t tStartX = tStart >> 16;
-    uint16_t startX = (uint16_t)tStartX;
-    uint32_t tStartY = tStart & 0x0000FFFF;
-    uint16_t startY = (uint16_t)tStartY;
-    Vector2 s = { .x = startX, .y = startY };
-    return s;
+static void FlushPendingPixels()
+{
+    //Anything that writes VGA memory directly must write out batched pixels first,
+    //otherwise they would land on top of whatever is drawn after them
+    if (_batchDepth && _batchPlanar) {
+        FlushPixelBatch();
+    }
 }
 
-void DrawUserHorizontalLine(uint32_t start, uint16_t length, uint8_t colour) {
-    //Version used on the receiving end of user transfer code
-    Vector2 s = Reverse32BitMergeVector2(start);
-    DrawHorizontalLine(s, length, colour);
+static void BatchPixel(uint16_t x, uint16_t y, uint8_t colour)
+{
+    //Draw a pixel that is known to be inside the clip rectangle, batching it if a batch is open
+    if (!_batchDepth || !_batchPlanar) {
+        PlotPixel(x, y, colour);
+        return;
+    }
+    if (colour != _batchColour) {
+        FlushPixelBatch();
+        _batchColour = colour;
+    }
+    uint8_t plane = x & 3;
+    if (_batchCount[plane] == PIXEL_BATCH_SIZE) {
+        FlushPixelBatch();
+    }
+    _batchOffsets[plane][_batchCount[plane]++] = (screenWidth * y + x) / 4;
+    _pixelWrites++;
 }
 
-void DrawHorizontalLine(Vector2 start, uint16_t length, uint8_t colour) {
-    if (chain4) {
-        //extra optimized version for chain4mode, similar to clear screen
-        uint8_t* base = _vgaMemory + (start.y * screenWidth) + start.x;
-        int val = length;
-        while(val){
-            base[--val] = colour;
-        }
-    } else {
-        //otherwise same implementation as vertical
-        uint16_t x = start.x;
-        uint16_t end = start.x + length;
-        while (x < end) {
-            SetPixel(x, start.y, colour);
-            x++;
-        }
+void BeginPixelBatch(uint8_t colour)
+{
+    //Batches can be nested, e.g. a polygon outline batches all of its lines together.
+    //Only the outermost batch writes the pixels out
+    if (_batchDepth++ == 0) {
+        _batchPlanar = LinearTarget() == 0;
+        _batchColour = colour;
     }
 }
 
-void DrawUserVerticalLine(uint32_t start, uint16_t length, uint8_t colour) {
-    //Version used on the receiving end of user transfer code
-    Vector2 s = Reverse32BitMergeVector2(start);
-    DrawVerticalLine(s, length, colour);
+void EndPixelBatch()
+{
+    if (_batchDepth > 0 && --_batchDepth == 0 && _batchPlanar) {
+        FlushPixelBatch();
+    }
 }
 
-void DrawVerticalLine(Vector2 start, uint16_t length, uint8_t colour) {
-    //simply iterate through the positions in memory
-    uint16_t y = start.y;
-    uint16_t end = start.y + length;
-    while (y < end) {
-        SetPixel(start.x, y, colour);
-        y++;
+uint8_t GetPixel(uint16_t x, uint16_t y)
+{
+    uint8_t* target = LinearTarget();
+    FlushPendingPixels();
+    if (!target) {
+        //graphics controller read map select picks the plane to read from
+        VGA_SetGraphicsControllerRegister(0x04, x & 3);
+        return VGA_READ(&_vgaMemory[(screenWidth * y + x)/4]);
     }
+    return target[(screenWidth * y + x)];
 }
 
-void DrawUserLine(uint32_t start, uint32_t end, uint8_t colour) {
-    //Version used on the receiving end of user transfer code
-    Vector2 s = Reverse32BitMergeVector2(start);
-    Vector2 e = Reverse32BitMergeVector2(end);
-    DrawLine(s, e, colour);
+uint32_t GetPixelWriteCount()
+{
+    return _pixelWrites;
 }
 
-void DrawLine(Vector2 start, Vector2 end, uint8_t colour) {
-    // Vector2 d, pos, s1, e1;
-    // int i, p;
-    
-    if (start.x == end.x && start.y == end.y) {
-        return;
+static void GetClip(int* left, int* top, int* right, int* bottom)
+{
+    //right and bottom are one past the last pixel drawn
+    if (_clipSet) {
+        *left = _clipRect.x;
+        *top = _clipRect.y;
+        *right = _clipRect.x + _clipRect.width;
+        *bottom = _clipRect.y + _clipRect.height;
+    } else {
+        *left = 0;
+        *top = 0;
+        *right = screenWidth;
+        *bottom = screenHeight;
     }
+}
 
-    //fast bailouts for axis aligned lines
-    if (start.x == end.x)
-    {
-        if (start.y < end.y) {
-            DrawVerticalLine(start, end.y - start.y, colour);
-        } else {
-            Vector2 s = { .x = start.x, .y = end.y };
-            DrawVerticalLine(s, start.y - end.y, colour);
-        }
-        
-        return;
-    }
-    if (start.y == end.y)
-    {
-        if (start.x < end.x) {
-            DrawHorizontalLine(start, end.x - start.x, colour);
-        } else {
-            Vector2 s = { .x = end.x, .y = start.y };
-            DrawHorizontalLine(s, start.x - end.x, colour);
-        }
-        return;
+void SetClipRectangle(Rectangle clip)
+{
+    //Limit all drawing to a rectangle, which is itself limited to the screen
+    int right = clip.x + clip.width;
+    int bottom = clip.y + clip.height;
+    if (right > screenWidth) {
+        right = screenWidth;
     }
-    
-    //version of bresenham line drawing algorithm
-    //works for any orientation of line
-    int diffX = abs(end.x - start.x),
-        diffY = abs(end.y - start.y),
-        stepX = start.x < end.x ? 1 : -1,
-        stepY = start.y < end.y ? 1 : -1;
-    int err = (diffX>diffY ? diffX : -diffY)/2, 
-        e2;
-    int posX = start.x;
-    int posY = start.y;
-    
-    for(;;){
-        SetPixel(posX, posY, colour);
-        //stops when we've reached the end of the line
-        if (posX == end.x && posY == end.y) 
-            break;
-        e2 = err;
-
-        //change positions based on how far away we are from where the line would actually be
-        if (e2 > -diffX) { 
-            err -= diffY; 
-            posX += stepX; 
-        }
-        if (e2 < diffY) { 
-            err += diffX; 
-            posY += stepY; 
-        }
+    if (bottom > screenHeight) {
+        bottom = screenHeight;
     }
+    _clipRect.x = clip.x < right ? clip.x : right;
+    _clipRect.y = clip.y < bottom ? clip.y : bottom;
+    _clipRect.width = right - _clipRect.x;
+    _clipRect.height = bottom - _clipRect.y;
+    _clipSet = 1;
 }
 
-void DrawUserRectangle(uint32_t start, uint32_t size, uint8_t colour) {
+void SetUserClipRectangle(uint32_t start, uint32_t size) {
     //Version used on the receiving end of user transfer code
     Vector2 s = Reverse32BitMergeVector2(start);
     Vector2 m = Reverse32BitMergeVector2(size);
     Rectangle r = { .x = s.x, .y = s.y, .width = m.x, .height = m.y };
-    DrawRectangle(r, colour);
+    SetClipRectangle(r);
 }
 
-void DrawRectangle(Rectangle rect, uint8_t colour)
+void ResetClipRectangle()
 {
-    //Fast method drawing a rectangle with horizontal and vertical methods
-    Vector2 s = {.x = rect.x, .y = rect.y + rect.height};
-    DrawHorizontalLine(s, rect.width, colour);
-    s.y -= rect.height;
-    DrawHorizontalLine(s, rect.width, colour);
-    DrawVerticalLine(s, rect.height, colour);
-    s.x += rect.width;
-    DrawVerticalLine(s, rect.height, colour);
+    _clipSet = 0;
 }
 
-void FillUserRectangle(uint32_t start, uint32_t size, uint8_t colour) {
-    //Version used on the receiving end of user transfer code
-    Vector2 s = Reverse32BitMergeVector2(start);
-    Vector2 m = Reverse32BitMergeVector2(size);
-    Rectangle r = { .x = s.x, .y = s.y, .width = m.x, .height = m.y };
-    FillRectangle(r, colour);
+static int ClipBlock(int* x, int* y, int* width, int* height)
+{
+    //Trim a rectangle to the clip rectangle. Returns 0 if nothing is left to draw
+    int left, top, right, bottom;
+    GetClip(&left, &top, &right, &bottom);
+    if (*x < left) {
+        *width -= left - *x;
+        *x = left;
+    }
+    if (*y < top) {
+        *height -= top - *y;
+        *y = top;
+    }
+    if (*x + *width > right) {
+        *width = right - *x;
+    }
+    if (*y + *height > bottom) {
+        *height = bottom - *y;
+    }
+    return *width > 0 && *height > 0;
 }
 
-void FillRectangle(Rectangle rect, uint8_t colour) {
-    //Draw horizontal line between minimum and maximum y
-    Vector2 s = {.x = rect.x, .y = rect.y};
-    for (int i = 0; i < rect.height; i++)
-    {
-        DrawHorizontalLine(s, rect.width, colour);
-        s.y++;
+static int ClipOutcode(int x, int y, int left, int top, int right, int bottom)
+{
+    //right and bottom are inclusive here
+    int code = 0;
+    if (x < left) {
+        code |= CLIP_LEFT;
+    } else if (x > right) {
+        code |= CLIP_RIGHT;
     }
+    if (y < top) {
+        code |= CLIP_TOP;
+    } else if (y > bottom) {
+        code |= CLIP_BOTTOM;
+    }
+    return code;
 }
 
-void DrawUserCircle(uint32_t centre, uint16_t radius, uint8_t colour) {
-    //Version used on the receiving end of user transfer code
-    Vector2 c = Reverse32BitMergeVector2(centre);
-    DrawCircle(c, radius, colour);
+static int32_t MultiplyDivide(int32_t a, int32_t b, int32_t c)
+{
+    //a * b / c rounded towards zero, keeping the full 64 bit product.
+    //idiv faults if the answer does not fit in 32 bits (or c is 0), which the coordinates
+    //user programs pass in can cause, so the answer saturates instead, like FixedDivide
+    int64_t product = (int64_t)a * b;
+    uint64_t magnitude = product < 0 ? 0 - (uint64_t)product : (uint64_t)product;
+    uint32_t divisor = c < 0 ? 0u - (uint32_t)c : (uint32_t)c;
+    int32_t result;
+    int32_t remainder;
+    if (magnitude >= ((uint64_t)divisor << 31)) {
+        return (product < 0) != (c < 0) ? INT32_MIN : INT32_MAX;
+    }
+    asm("idivl %4"
+        : "=a"(result), "=d"(remainder)
+        : "a"((uint32_t)product), "d"((int32_t)(product >> 32)), "rm"(c)
+        : "cc");
+    return result;
 }
 
-void DrawCircle(Vector2 centre, uint16_t radius, uint8_t colour) {
-    //Bresenham circle drawing algorithm, otherwise known as Midpoint circle algorithm
-    Vector2 pos = {.x = radius, .y = 0};
-    int16_t p = 1 - radius;
-    uint16_t cxmpx, cxppx, cympy, cyppy, cxmpy, cxppy, cympx, cyppx;
-
-    while (pos.x > pos.y)
-    { 
-        //minor optimization as these would otherwise be done twice.
-        cxmpx = centre.x - pos.x;
-        cxppx = centre.x + pos.x;
-        cympy = centre.y - pos.y;
-        cyppy = centre.y + pos.y;
-        cxmpy = centre.x - pos.y;
-        cxppy = centre.x + pos.y;
-        cympx = centre.y - pos.x;
-        cyppx = centre.y + pos.x;
-
-        SetPixel(cxppx, cyppy, colour);
-        SetPixel(cxmpx, cyppy, colour);
-        SetPixel(cxppx, cympy, colour);
-        SetPixel(cxmpx, cympy, colour);
-
-        SetPixel(cxppy, cyppx, colour);
-        SetPixel(cxppy, cympx, colour);
-        SetPixel(cxmpy, cyppx, colour);
-        SetPixel(cxmpy, cympx, colour);
-
-        pos.y++;
-        if (p <= 0)
-        {
-            p += (pos.y * 2) + 1;
+static int ClipPolygonEdge(int32_t* inX, int32_t* inY, int count, int32_t* outX, int32_t* outY, int edge, int32_t boundary)
+{
+    //One Sutherland-Hodgman stage: keep the part of the polygon inside one clip edge.
+    //edge is the outcode for the side being clipped and boundary is in the same 24.8 fixed point
+    //as the vertices. Returns the new vertex count, or -1 if it would not fit
+    int out = 0;
+    int i, j;
+    for (i = 0, j = count - 1; i < count; j = i++) {
+        int32_t px = inX[j], py = inY[j];
+        int32_t cx = inX[i], cy = inY[i];
+        int prevInside, currInside;
+        if (edge == CLIP_LEFT) {
+            prevInside = px >= boundary;
+            currInside = cx >= boundary;
+        } else if (edge == CLIP_RIGHT) {
+            prevInside = px <= boundary;
+            currInside = cx <= boundary;
+        } else if (edge == CLIP_TOP) {
+            prevInside = py >= boundary;
+            currInside = cy >= boundary;
+        } else {
+            prevInside = py <= boundary;
+            currInside = cy <= boundary;
         }
-        else
-        {
-            pos.x--;
-            p += (pos.y * 2) - (pos.x * 2) + 1;
+        if (out + 2 > CLIP_MAX_VERTICES) {
+            return -1;
+        }
+        if (prevInside != currInside) {
+            //add where the edge crosses the boundary
+            if (edge == CLIP_LEFT || edge == CLIP_RIGHT) {
+                outX[out] = boundary;
+                outY[out] = py + MultiplyDivide(cy - py, boundary - px, cx - px);
+            } else {
+                outX[out] = px + MultiplyDivide(cx - px, boundary - py, cy - py);
+                outY[out] = boundary;
+            }
+            out++;
+        }
+        if (currInside) {
+            outX[out] = cx;
+            outY[out] = cy;
+            out++;
         }
     }
+    return out;
 }
 
-void FillUserCircle(uint32_t centre, uint16_t radius, uint8_t colour) {
-    //Version used on the receiving end of user transfer code
-    Vector2 c = Reverse32BitMergeVector2(centre);
-    FillCircle(c, radius, colour);
+void SetPixel(uint16_t x, uint16_t y, const uint8_t colour)
+{
+    int cx = (int16_t)x, cy = (int16_t)y, w = 1, h = 1;
+    if (!ClipBlock(&cx, &cy, &w, &h)) {
+        return;
+    }
+    BatchPixel(x, y, colour);
+    MarkDirty(x, y, 1, 1);
 }
 
-void FillCircle(Vector2 centre, uint16_t radius, uint8_t colour)
+void SetMapMask(uint8_t mask)
 {
-    Vector2 s = { .x = 0, .y = 0 };
-    Vector2 e = { .x = 0, .y = 0 };
-    Vector2 pos = {.x = radius, .y = 0};   
-    int p = 1 - radius;
-    uint16_t cxmpx, cxppx, cympy, cyppy, cxmpy, cxppy, cympx, cyppx;
+    //the shadowed register skips the port write when the mask is already set
+    VGA_SetSequencerRegister(0x02, mask);
+}
 
-    //From top to bottom draws a horizontal line between lowest and highest point
-    while (pos.x >= pos.y)
-    {
-        cxmpx = centre.x - pos.x;
-        cxppx = centre.x + pos.x;
-        cympy = centre.y - pos.y;
-        cyppy = centre.y + pos.y;
-        cxmpy = centre.x - pos.y;
-        cxppy = centre.x + pos.y;
-        cympx = centre.y - pos.x;
-        cyppx = centre.y + pos.x;
-
-        s.x = cxppy;
-        s.y = cympx;
-        e.x = cxmpy;
-        e.y = cympx;
-        DrawLine(s, e, colour); //top
-
-        s.x = cxppx;
-        s.y = cympy;
-        e.x = cxmpx;
-        e.y = cympy;
-        DrawLine(s, e, colour);//top-upper
-
-        //s.x = cxppx;
-        s.y = cyppy;
-        //e.x = cxmpx;
-        e.y = cyppy;
-        DrawLine(s, e, colour); //top-lower
-
-        s.x = cxppy;
-        s.y = cyppx;
-        e.x = cxmpy;
-        e.y = cyppx;
-        DrawLine(s, e, colour);//bottom
+void FillPlanarRectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t colour)
+{
+    //Mode X stores pixel x in plane (x & 3) at byte x / 4, so each byte holds 4 horizontally adjacent pixels.
+    //Fill column by column: the partial bytes at each end get their own map mask,
+    //and the middle is written with all planes enabled so each byte store paints 4 pixels.
+    //At most 3 port writes for the whole rectangle instead of one per pixel.
+    if (width == 0 || height == 0) {
+        return;
+    }
+    uint16_t rowBytes = screenWidth / 4;
+    uint16_t last = x + width - 1;
+    int startByte = x >> 2;
+    int endByte = last >> 2;
+    uint8_t leftMask = (0x0F << (x & 3)) & 0x0F;
+    uint8_t rightMask = 0x0F >> (3 - (last & 3));
+    uint8_t* base = _vgaMemory + (y * rowBytes);
+    uint8_t* p;
+    int row;
 
-        pos.y++;
-        if (p <= 0)
-        {
-            p += (pos.y * 2) + 1;
+    if (startByte == endByte) {
+        //span starts and ends inside the same group of 4 pixels
+        SetMapMask(leftMask & rightMask);
+        p = base + startByte;
+        for (row = 0; row < height; row++, p += rowBytes) {
+            VGA_WRITE(p, colour);
         }
-        else
-        {
-            pos.x--;
-            p += (pos.y * 2) - (pos.x * 2) + 1;
+        return;
+    }
+
+    //fold whole bytes at either end into the middle section
+    if (leftMask == 0x0F) {
+        startByte--;
+    } else {
+        SetMapMask(leftMask);
+        p = base + startByte;
+        for (row = 0; row < height; row++, p += rowBytes) {
+            VGA_WRITE(p, colour);
+        }
+    }
+    if (rightMask == 0x0F) {
+        endByte++;
+    } else {
+        SetMapMask(rightMask);
+        p = base + endByte;
+        for (row = 0; row < height; row++, p += rowBytes) {
+            VGA_WRITE(p, colour);
         }
     }
-}
 
-void DrawUserPolygon(uint16_t xPoints[], uint16_t yPoints[], uint32_t sizeCol) {
-    //Version used on the receiving end of user transfer code
-    Vector2 vSizeCol = Reverse32BitMergeVector2(sizeCol);
-    uint8_t col = (uint8_t)vSizeCol.y;
-    uint16_t size = vSizeCol.x;
-    DrawPolygon(xPoints, yPoints, size, col);
+    int middle = endByte - startByte - 1;
+    if (middle > 0) {
+        SetMapMask(0x0F);
+        p = base + startByte + 1;
+        for (row = 0; row < height; row++, p += rowBytes) {
+            int i = middle;
+            while (i) {
+                VGA_WRITE(&p[--i], colour);
+            }
+        }
+    }
 }
 
-void DrawPolygon(uint16_t xPoints[], uint16_t yPoints[], uint16_t sides, uint8_t colour)
+static void FillBlock(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t colour)
 {
-    //Draw a line between each of the positions through the list and then last and first
-    uint16_t length = sides;
-    Vector2 s = {.x = 0, .y = 0};
-    Vector2 e = {.x = 0, .y = 0};
+    //Fill a rectangle in whichever buffer we are drawing to, without marking it dirty
+    uint8_t* target = LinearTarget();
+    FlushPendingPixels();
+    _pixelWrites += (uint32_t)width * height;
+    if (!target) {
+        FillPlanarRectangle(x, y, width, height, colour);
+        return;
+    }
+    uint8_t* base = target + (y * screenWidth) + x;
+    for (int row = 0; row < height; row++, base += screenWidth) {
+        int val = width;
+        while(val){
+            base[--val] = colour;
+        }
+    }
+}
 
-    for (int i = 0; i < length - 1; i++)
-    {
-        s.x = xPoints[i];
-        s.y = yPoints[i];
-        e.x = xPoints[i + 1];
-        e.y = yPoints[i + 1];
-        DrawLine(s, e, colour);
+static void FillClippedBlock(int x, int y, int width, int height, uint8_t colour)
+{
+    //Fill the part of a rectangle that is inside the clip rectangle and mark it dirty
+    if (ClipBlock(&x, &y, &width, &height)) {
+        FillBlock(x, y, width, height, colour);
+        MarkDirty(x, y, width, height);
     }
-    s.x = xPoints[0];
-    s.y = yPoints[0];
-    e.x = xPoints[length-1];
-    e.y = yPoints[length-1];
-    DrawLine(s, e, colour);
 }
 
-uint8_t InPolygon(uint16_t x, uint16_t y, uint16_t xPoints[], uint16_t yPoints[], uint16_t length) {
-    //Checks to see if a point is inside the bound of the given polygon. 
-    //An adaptation of the algorithm created by Randolph Franklin in Fortran.
-    uint8_t inside = false;
-    int i, j;
-    for (i = 0, j = length -1; i < length; j = i++) {
-        if ((yPoints[i] > y) != (yPoints[j] > y) && 
-            x < (xPoints[j] - xPoints[i]) * (y - yPoints[i]) / (yPoints[j] - yPoints[i]) + xPoints[i]) {
-                inside = !inside;
-            }
+void ClearScreen(uint8_t colour)
+{
+    // 90 ticks (400x600)
+    // int i;
+    // int val = screenHeight * screenWidth;
+    // for (i = 0; i < val; i++)
+    // {
+    //     _vgaMemory[i] = colour;
+    // }
+
+    //48 ticks (400x600)
+    uint8_t* base = LinearTarget();
+    int val = screenHeight * screenWidth;
+    FlushPendingPixels();
+    if (!base) {
+        //In plane mode each byte covers 4 pixels, so with all planes enabled
+        //we only need to write a quarter of the bytes
+        SetMapMask(0x0F);
+        val /= 4;
+        while(val){
+            VGA_WRITE(&_vgaMemory[--val], colour);
+        }
+    } else {
+        while(val){
+            base[--val] = colour;
+        }
     }
-    return inside;
+    MarkDirty(0, 0, screenWidth, screenHeight);
 }
 
-void FillUserPolygon(uint16_t xPoints[], uint16_t yPoints[], uint32_t sizeCol) {
-    //Version used on the receiving end of user transfer code
-    Vector2 vSizeCol = Reverse32BitMergeVector2(sizeCol);
-    uint8_t col = (uint8_t)vSizeCol.y;
-    uint16_t size = vSizeCol.x;
-    FillPolygon(xPoints, yPoints, size, col);
+static void ForgetCachedTexts()
+{
+    //Drop the texts waiting to be latch copied from earlier frames. The frame being drawn keeps its
+    //own, which are in the back buffer and the dirty list doesn't cover
+    for (int h = 1; h <= MAX_PRESENT_HISTORY; h++) {
+        _cachedTextCount[h] = 0;
+    }
 }
 
-void FillPolygon(uint16_t xPoints[], uint16_t yPoints[], uint16_t sides, uint8_t colour) {
-    int i, j;
-    uint16_t minX = 65535;
-    uint16_t minY = 65535;
-    uint16_t maxX = 0;
-    uint16_t maxY = 0;
+static int RectanglesIntersect(const Rectangle* a, const Rectangle* b)
+{
+    return a->x < b->x + b->width && b->x < a->x + a->width && a->y < b->y + b->height && b->y < a->y + a->height;
+}
 
-    //creates bounding box around the polygon
-    for (i = 0; i < sides; i++) {
-        if (xPoints[i] < minX) {
-            minX = xPoints[i];
-        }
-        if (xPoints[i] > maxX) {
-            maxX = xPoints[i];
-        }
-        if (yPoints[i] < minY) {
-            minY = yPoints[i];
-        }
-        if (yPoints[i] > maxY) {
-            maxY = yPoints[i];
+uint8_t EnableBackBuffer(uint8_t enable)
+{
+    //Switch between drawing straight to VGA memory and drawing into a back buffer in RAM
+    //that is copied to the screen by Present. Returns 1 if the back buffer is in use.
+    if (!enable) {
+        if (_backBuffer) {
+            Present();
+            PMM_FreeBlocks(_backBuffer, _backBufferBlocks);
+            _backBuffer = 0;
+            _backBufferBlocks = 0;
         }
+        return 0;
     }
-    //iterate through each position of the polygon to see if in polygon
-    for (i = minX; i <= maxX; i++) {
-        for (j = minY; j <= maxY; j++) {
-            if (InPolygon(i, j, xPoints, yPoints, sides)) {
-                SetPixel(i, j, colour);
-            }
-        }
+    uint32_t blockSize = PMM_GetBlockSize();
+    uint32_t blocks = ((uint32_t)screenWidth * screenHeight + blockSize - 1) / blockSize;
+    if (_backBuffer && _backBufferBlocks >= blocks) {
+        return 1;
+    }
+    if (_backBuffer) {
+        //mode has grown since the buffer was allocated
+        PMM_FreeBlocks(_backBuffer, _backBufferBlocks);
     }
-}
\ No newline at end of file
+    _backBuffer = (uint8_t *)PMM_AllocateBlocks(blocks);
+    _backBufferBlocks = _backBuffer ? blocks : 0;
+    _dirtyCount = 0;
+    ForgetCachedTexts();
+    if (!_backBuffer) {
+        return 0;
+    }
+    //start with a known (cleared) frame so the first Present shows no garbage
+    memset(_backBuffer, 0, screenWidth * screenHeight);
+    MarkDirty(0, 0, screenWidth, screenHeight);
+    return 1;
+}
+
+uint8_t GetBackBufferEnabled()
+{
+    return _backBuffer != 0;
+}
+
+void MarkDirty(int x, int y, int width, int height)
+{
+    //Record that a region of the back buffer has changed. Overlapping or touching regions
+    //are merged, and once the list is full new regions are merged into the rectangle that grows the least.
+    if (!_backBuffer) {
+        return;
+    }
+    if (x < 0) {
+        width += x;
+        x = 0;
+    }
+    if (y < 0) {
+        height += y;
+        y = 0;
+    }
+    if (x + width > screenWidth) {
+        width = screenWidth - x;
+    }
+    if (y + height > screenHeight) {
+        height = screenHeight - y;
+    }
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    //Cached text that has been drawn over can no longer be latch copied, so its box is copied
+    //from the back buffer like anything else
+    int i;
+    Rectangle changed = { x, y, width, height };
+    for (i = 0; i < _cachedTextCount[0]; i++) {
+        if (RectanglesIntersect(&changed, &_cachedTexts[0][i].box)) {
+            Rectangle box = _cachedTexts[0][i].box;
+            _cachedTexts[0][i] = _cachedTexts[0][--_cachedTextCount[0]];
+            MarkDirty(box.x, box.y, box.width, box.height);
+            i--;
+        }
+    }
+
+    //Fast path: consecutive calls usually land in the rectangle we last touched
+    int right = x + width;
+    int bottom = y + height;
+    if (_dirtyCount > 0) {
+        Rectangle* r = &_dirtyRects[_lastDirty];
+        if (x >= r->x && y >= r->y && right <= r->x + r->width && bottom <= r->y + r->height) {
+            return;
+        }
+    }
+
+    int best = -1;
+    uint32_t bestGrowth = 0xFFFFFFFF;
+    for (i = 0; i < _dirtyCount; i++) {
+        Rectangle* r = &_dirtyRects[i];
+        int rRight = r->x + r->width;
+        int rBottom = r->y + r->height;
+        int ux = x < (int)r->x ? x : (int)r->x;
+        int uy = y < (int)r->y ? y : (int)r->y;
+        int uRight = right > rRight ? right : rRight;
+        int uBottom = bottom > rBottom ? bottom : rBottom;
+        bool touching = x <= rRight && right >= (int)r->x && y <= rBottom && bottom >= (int)r->y;
+        uint32_t growth = (uint32_t)(uRight - ux) * (uBottom - uy) - r->width * r->height;
+        if (touching || (_dirtyCount == MAX_DIRTY_RECTS && growth < bestGrowth)) {
+            best = i;
+            bestGrowth = growth;
+            if (touching) {
+                break;
+            }
+        }
+    }
+    if (best < 0) {
+        best = _dirtyCount++;
+        _dirtyRects[best].x = x;
+        _dirtyRects[best].y = y;
+        _dirtyRects[best].width = width;
+        _dirtyRects[best].height = height;
+    } else {
+        Rectangle* r = &_dirtyRects[best];
+        int rRight = r->x + r->width;
+        int rBottom = r->y + r->height;
+        if (x < (int)r->x) {
+            r->x = x;
+        }
+        if (y < (int)r->y) {
+            r->y = y;
+        }
+        r->width = (right > rRight ? right : rRight) - r->x;
+        r->height = (bottom > rBottom ? bottom : rBottom) - r->y;
+    }
+    _lastDirty = best;
+}
+
+static void CopyRectsToScreen(Rectangle* rects, int count)
+{
+    //Copy regions of the back buffer to the page being drawn
+    int i;
+    uint32_t x, y;
+    if (count == 0) {
+        return;
+    }
+    if (chain4) {
+        for (i = 0; i < count; i++) {
+            Rectangle* r = &rects[i];
+            uint32_t offset = r->y * screenWidth + r->x;
+            for (y = 0; y < r->height; y++, offset += screenWidth) {
+                memcpy(_vgaMemory + offset, _backBuffer + offset, r->width);
+            }
+        }
+    } else {
+        //Copy a plane at a time so the whole present only needs 4 map mask writes
+        uint16_t rowBytes = screenWidth / 4;
+        for (int plane = 0; plane < 4; plane++) {
+            SetMapMask(0x01 << plane);
+            for (i = 0; i < count; i++) {
+                Rectangle* r = &rects[i];
+                //first column in the rectangle that lives in this plane
+                uint32_t first = r->x + ((plane - r->x) & 3);
+                uint32_t end = r->x + r->width;
+                uint8_t* src = _backBuffer + r->y * screenWidth;
+                uint8_t* dst = _vgaMemory + r->y * rowBytes;
+                for (y = 0; y < r->height; y++, src += screenWidth, dst += rowBytes) {
+                    for (x = first; x < end; x += 4) {
+                        VGA_WRITE(&dst[x >> 2], src[x]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void CopyPlanarPage(uint8_t* from, uint8_t* to)
+{
+    //Copy a whole page of plane mode VGA memory, reading and writing one plane at a time
+    uint32_t size = (uint32_t)screenWidth * screenHeight / 4;
+    for (uint8_t plane = 0; plane < 4; plane++) {
+        SetMapMask(0x01 << plane);
+        //graphics controller read map select
+        VGA_SetGraphicsControllerRegister(0x04, plane);
+        for (uint32_t i = 0; i < size; i++) {
+            VGA_WRITE(&to[i], VGA_READ(&from[i]));
+        }
+    }
+}
+
+static int CutOutRectangle(Rectangle* rects, int count, const Rectangle* box)
+{
+    //Cut box out of each rectangle, leaving up to 4 pieces: the rows above and below it and the
+    //columns either side. Stops if the pieces don't fit, leaving the rest of the box to be copied
+    for (int i = 0; i < count; i++) {
+        Rectangle r = rects[i];
+        Rectangle pieces[4];
+        int n = 0;
+        if (!RectanglesIntersect(&r, box)) {
+            continue;
+        }
+        unsigned int top = r.y > box->y ? r.y : box->y;
+        unsigned int bottom = r.y + r.height < box->y + box->height ? r.y + r.height : box->y + box->height;
+        if (r.y < box->y) {
+            pieces[n++] = (Rectangle){ r.x, r.y, r.width, box->y - r.y };
+        }
+        if (r.y + r.height > bottom) {
+            pieces[n++] = (Rectangle){ r.x, bottom, r.width, r.y + r.height - bottom };
+        }
+        if (r.x < box->x) {
+            pieces[n++] = (Rectangle){ r.x, top, box->x - r.x, bottom - top };
+        }
+        if (r.x + r.width > box->x + box->width) {
+            pieces[n++] = (Rectangle){ box->x + box->width, top, r.x + r.width - box->x - box->width, bottom - top };
+        }
+        if (count + n - 1 > MAX_PRESENT_RECTS) {
+            return count;
+        }
+        if (n == 0) {
+            rects[i--] = rects[--count];
+            continue;
+        }
+        rects[i] = pieces[0];
+        for (int k = 1; k < n; k++) {
+            rects[count++] = pieces[k];
+        }
+    }
+    return count;
+}
+
+static int PrepareCachedTexts(int frames, int count)
+{
+    //Decide which cached texts can be latch copied to the page being drawn. frames is how many
+    //frames' texts the page needs: this one's, and those of the frames it missed. Text that anything
+    //in a later frame touched is out of date and its box is copied from the back buffer instead. The
+    //rest is cut out of the rectangles copied from the back buffer. Returns the new number of rectangles
+    int f, g, i, j;
+    uint8_t ready = GlyphCacheReady();
+    for (f = frames - 1; f >= 0; f--) {
+        for (i = 0; i < _cachedTextCount[f]; i++) {
+            CachedText* cached = &_cachedTexts[f][i];
+            cached->latch = ready;
+            for (g = 0; g < f && cached->latch; g++) {
+                Rectangle* rects = g == 0 ? _dirtyRects : _previousDirty[g - 1];
+                int rectCount = g == 0 ? _dirtyCount : _previousDirtyCount[g - 1];
+                for (j = 0; j < rectCount && cached->latch; j++) {
+                    cached->latch = !RectanglesIntersect(&cached->box, &rects[j]);
+                }
+                for (j = 0; j < _cachedTextCount[g] && cached->latch; j++) {
+                    cached->latch = !RectanglesIntersect(&cached->box, &_cachedTexts[g][j].box);
+                }
+            }
+            if (!cached->latch) {
+                _presentRects[count++] = cached->box;
+            }
+        }
+    }
+    for (f = 0; f < frames; f++) {
+        for (i = 0; i < _cachedTextCount[f]; i++) {
+            if (_cachedTexts[f][i].latch) {
+                count = CutOutRectangle(_presentRects, count, &_cachedTexts[f][i].box);
+            }
+        }
+    }
+    return count;
+}
+
+void Present()
+{
+    //Show everything drawn since the last Present. With a back buffer the dirty regions are
+    //copied to VGA memory. With page flipping the page that was drawn is then displayed
+    //at the next vertical retrace and drawing moves on to the next hidden page.
+    int i, h;
+    if (_backBuffer) {
+        int count = 0;
+        int frames = _pageFlipping ? VGA_GetPageCount() : 1;
+        for (i = 0; i < _dirtyCount; i++) {
+            _presentRects[count++] = _dirtyRects[i];
+        }
+        if (_pageFlipping) {
+            uint8_t stalePages = VGA_GetPageCount() - 1;
+            for (h = 0; h < stalePages; h++) {
+                for (i = 0; i < _previousDirtyCount[h]; i++) {
+                    _presentRects[count++] = _previousDirty[h][i];
+                }
+            }
+        }
+        count = PrepareCachedTexts(frames, count);
+        if (_pageFlipping) {
+            //age the history by one frame
+            for (h = MAX_PRESENT_HISTORY - 1; h > 0; h--) {
+                for (i = 0; i < _previousDirtyCount[h - 1]; i++) {
+                    _previousDirty[h][i] = _previousDirty[h - 1][i];
+                }
+                _previousDirtyCount[h] = _previousDirtyCount[h - 1];
+            }
+            for (i = 0; i < _dirtyCount; i++) {
+                _previousDirty[0][i] = _dirtyRects[i];
+            }
+            _previousDirtyCount[0] = _dirtyCount;
+        }
+        CopyRectsToScreen(_presentRects, count);
+        for (h = frames - 1; h >= 0; h--) {
+            for (i = 0; i < _cachedTextCount[h]; i++) {
+                CachedText* cached = &_cachedTexts[h][i];
+                if (cached->latch) {
+                    LatchText(cached->text, cached->x, cached->y, cached->colour, cached->background, &cached->box);
+                }
+            }
+        }
+        if (_pageFlipping) {
+            for (h = MAX_PRESENT_HISTORY; h > 0; h--) {
+                for (i = 0; i < _cachedTextCount[h - 1]; i++) {
+                    _cachedTexts[h][i] = _cachedTexts[h - 1][i];
+                }
+                _cachedTextCount[h] = _cachedTextCount[h - 1];
+            }
+        }
+        _cachedTextCount[0] = 0;
+        _dirtyCount = 0;
+        _lastDirty = 0;
+    }
+    if (_pageFlipping) {
+        uint8_t* drawn = _vgaMemory;
+        VGA_SetDisplayPage(_drawPage);
+        _flips++;
+        _drawPage = (_drawPage + 1) % VGA_GetPageCount();
+        _vgaMemory = VGA_GetPageAddress(_drawPage);
+        if (!_backBuffer) {
+            //nothing records what was drawn without a back buffer, so the next page would still
+            //hold a frame from before. It starts as a latch copy of the page now on screen instead
+            VGA_SetGraphicsControllerRegister(0x05, 0x41);
+            LatchCopyBytes(drawn - _vgaMemory, 0, (uint32_t)screenWidth / 4 * screenHeight, 1, 0x0F, 0);
+            VGA_SetGraphicsControllerRegister(0x05, 0x40);
+        }
+    }
+    //palette changes go out in the retrace the flip has just waited for, or wait for one
+    Palette_Flush(!_pageFlipping);
+}
+
+uint8_t EnablePageFlipping(uint8_t enable)
+{
+    //Double or triple buffer in plane mode. Needs at least two pages to fit in VGA memory,
+    //so it is not available in chain4 mode or the largest plane mode resolutions.
+    //Returns 1 if page flipping is in use.
+    uint8_t shown = VGA_GetDisplayPage();
+    uint8_t page;
+    if (!enable) {
+        if (_pageFlipping) {
+            _pageFlipping = 0;
+            //go back to drawing into and displaying the first page
+            if (shown != 0) {
+                CopyPlanarPage(VGA_GetPageAddress(shown), VGA_GetPageAddress(0));
+                VGA_SetDisplayPage(0);
+            }
+            _vgaMemory = VGA_GetPageAddress(0);
+        }
+        return 0;
+    }
+    if (chain4 || VGA_GetPageCount() < 2) {
+        return 0;
+    }
+    if (!_pageFlipping) {
+        //every hidden page starts as a copy of the one on screen
+        for (page = 0; page < VGA_GetPageCount(); page++) {
+            if (page != shown) {
+                CopyPlanarPage(VGA_GetPageAddress(shown), VGA_GetPageAddress(page));
+            }
+        }
+        for (int h = 0; h < MAX_PRESENT_HISTORY; h++) {
+            _previousDirtyCount[h] = 0;
+        }
+        ForgetCachedTexts();
+        _pageFlipping = 1;
+        _drawPage = (shown + 1) % VGA_GetPageCount();
+        _vgaMemory = VGA_GetPageAddress(_drawPage);
+    }
+    return 1;
+}
+
+uint8_t GetPageFlippingEnabled()
+{
+    return _pageFlipping;
+}
+
+void GetPresentStatistics(PresentStatistics* stats)
+{
+    stats->Flips = _flips;
+    uint64_t cycles;
+    VGA_GetRetraceStatistics(&stats->RetraceWaits, &cycles, &stats->RetracePolls);
+    stats->RetraceWaitKilocycles = (uint32_t)(cycles >> 10);
+}
+
+Vector2 Reverse32BitMergeVector2(uint32_t a) {
+    //bitshifts 16 to get first value
+    //then ANDs with 0x0000FFFF to get the second
+    uint32_t tStart = a;
+    uint32_t tStartX = tStart >> 16;
+    uint16_t startX = (uint16_t)tStartX;
+    uint32_t tStartY = tStart & 0x0000FFFF;
+    uint16_t startY = (uint16_t)tStartY;
+    Vector2 s = { .x = startX, .y = startY };
+    return s;
+}
+
+void DrawUserHorizontalLine(uint32_t start, uint16_t length, uint8_t colour) {
+    //Version used on the receiving end of user transfer code
+    Vector2 s = Reverse32BitMergeVector2(start);
+    DrawHorizontalLine(s, length, colour);
+}
+
+void DrawHorizontalLine(Vector2 start, uint16_t length, uint8_t colour) {
+    //in plane mode this is a one pixel high planar fill, writing 4 pixels per byte store
+    FillClippedBlock((int16_t)start.x, (int16_t)start.y, length, 1, colour);
+}
+
+void FillSpans(const Span* spans, uint16_t count, uint8_t colour)
+{
+    int left, top, right, bottom;
+    int boxLeft = screenWidth, boxTop = screenHeight, boxRight = 0, boxBottom = 0;
+    uint8_t* target = LinearTarget();
+    uint16_t rowBytes = screenWidth / 4;
+    GetClip(&left, &top, &right, &bottom);
+    FlushPendingPixels();
+
+    //linear buffers take each span as one run of stores. In plane mode every span is visited once
+    //per plane, writing the pixels that plane holds, so the map mask changes at most 4 times
+    for (int plane = 0; plane < (target ? 1 : 4); plane++) {
+        if (!target) {
+            SetMapMask(0x01 << plane);
+        }
+        for (uint16_t i = 0; i < count; i++) {
+            //signed while clipping, so a run starting left of the screen keeps its visible part
+            int y = (int16_t)spans[i].y;
+            int start = (int16_t)spans[i].x;
+            int end = start + spans[i].length;
+            if (y < top || y >= bottom) {
+                continue;
+            }
+            if (start < left) {
+                start = left;
+            }
+            if (end > right) {
+                end = right;
+            }
+            if (start >= end) {
+                continue;
+            }
+            if (plane == 0) {
+                _pixelWrites += end - start;
+                boxLeft = start < boxLeft ? start : boxLeft;
+                boxRight = end > boxRight ? end : boxRight;
+                boxTop = y < boxTop ? y : boxTop;
+                boxBottom = y + 1 > boxBottom ? y + 1 : boxBottom;
+            }
+            if (target) {
+                uint8_t* p = target + y * screenWidth;
+                for (int x = start; x < end; x++) {
+                    p[x] = colour;
+                }
+            } else {
+                uint8_t* row = _vgaMemory + y * rowBytes;
+                for (int x = start + ((plane - start) & 3); x < end; x += 4) {
+                    VGA_WRITE(&row[x >> 2], colour);
+                }
+            }
+        }
+    }
+    if (boxRight > boxLeft) {
+        MarkDirty(boxLeft, boxTop, boxRight - boxLeft, boxBottom - boxTop);
+    }
+}
+
+void DrawUserVerticalLine(uint32_t start, uint16_t length, uint8_t colour) {
+    //Version used on the receiving end of user transfer code
+    Vector2 s = Reverse32BitMergeVector2(start);
+    DrawVerticalLine(s, length, colour);
+}
+
+void DrawVerticalLine(Vector2 start, uint16_t length, uint8_t colour) {
+    //a one pixel wide fill, so plane mode only needs to select the plane once
+    FillClippedBlock((int16_t)start.x, (int16_t)start.y, 1, length, colour);
+}
+
+void DrawUserLine(uint32_t start, uint32_t end, uint8_t colour) {
+    //Version used on the receiving end of user transfer code
+    Vector2 s = Reverse32BitMergeVector2(start);
+    Vector2 e = Reverse32BitMergeVector2(end);
+    DrawLine(s, e, colour);
+}
+
+void DrawLine(Vector2 start, Vector2 end, uint8_t colour) {
+    // Vector2 d, pos, s1, e1;
+    // int i, p;
+    int startX = (int16_t)start.x, startY = (int16_t)start.y;
+    int endX = (int16_t)end.x, endY = (int16_t)end.y;
+
+    if (startX == endX && startY == endY) {
+        return;
+    }
+
+    //fast bailouts for axis aligned lines, which clip as spans
+    if (startX == endX)
+    {
+        if (startY < endY) {
+            FillClippedBlock(startX, startY, 1, endY - startY, colour);
+        } else {
+            FillClippedBlock(startX, endY, 1, startY - endY, colour);
+        }
+        return;
+    }
+    if (startY == endY)
+    {
+        if (startX < endX) {
+            FillClippedBlock(startX, startY, endX - startX, 1, colour);
+        } else {
+            FillClippedBlock(endX, startY, startX - endX, 1, colour);
+        }
+        return;
+    }
+
+    //Cohen-Sutherland outcodes reject lines that are entirely off one side of the clip rectangle
+    int left, top, right, bottom;
+    GetClip(&left, &top, &right, &bottom);
+    if (ClipOutcode(startX, startY, left, top, right - 1, bottom - 1) &
+        ClipOutcode(endX, endY, left, top, right - 1, bottom - 1)) {
+        return;
+    }
+
+    //Bresenham line stepping one pixel at a time along the major axis. Pixel k along the line
+    //is minor steps m(k) = (k * minorLength + majorLength / 2) / majorLength from the start,
+    //so the range of k inside the clip rectangle can be worked out up front (much like
+    //Liang-Barsky does with its line parameter) and the line started part way along.
+    //Clipped lines then light exactly the pixels the unclipped line would
+    int diffX = abs(endX - startX),
+        diffY = abs(endY - startY),
+        stepX = startX < endX ? 1 : -1,
+        stepY = startY < endY ? 1 : -1;
+    uint8_t xMajor = diffX >= diffY;
+    int major = xMajor ? startX : startY, minor = xMajor ? startY : startX;
+    int majorStep = xMajor ? stepX : stepY, minorStep = xMajor ? stepY : stepX;
+    int majorLow = xMajor ? left : top, majorHigh = (xMajor ? right : bottom) - 1;
+    int minorLow = xMajor ? top : left, minorHigh = (xMajor ? bottom : right) - 1;
+    uint32_t length = xMajor ? diffX : diffY;
+    uint32_t minorLength = xMajor ? diffY : diffX;
+    uint32_t half = length / 2;
+    int first = 0, last = length;
+    int from, to;
+
+    //steps for which the major axis is inside
+    from = majorStep > 0 ? majorLow - major : major - majorHigh;
+    to = majorStep > 0 ? majorHigh - major : major - majorLow;
+    if (from > first) first = from;
+    if (to < last) last = to;
+
+    //steps for which the minor axis is inside, as a range of m(k) turned into a range of k
+    from = minorStep > 0 ? minorLow - minor : minor - minorHigh;
+    to = minorStep > 0 ? minorHigh - minor : minor - minorLow;
+    if (to < 0 || (minorLength == 0 && from > 0)) {
+        return;
+    }
+    if (from > 0) {
+        //smallest k with k * minorLength + half >= from * length
+        int k = (from * length - half + minorLength - 1) / minorLength;
+        if (k > first) first = k;
+    }
+    if (minorLength != 0) {
+        //largest k with k * minorLength + half < (to + 1) * length
+        uint32_t limit = (uint32_t)(to + 1) * length;
+        int k = limit > half ? (limit - half - 1) / minorLength : -1;
+        if (k < last) last = k;
+    }
+    if (first > last) {
+        return;
+    }
+
+    uint32_t e = (uint32_t)first * minorLength + half;
+    int posMajor = major + majorStep * first;
+    int posMinor = minor + minorStep * (int)(e / length);
+    e %= length;
+    int endMajor = major + majorStep * last;
+    int endMinor = minor + minorStep * (int)(((uint32_t)last * minorLength + half) / length);
+    if (xMajor) {
+        MarkDirty(posMajor < endMajor ? posMajor : endMajor, posMinor < endMinor ? posMinor : endMinor,
+                  abs(endMajor - posMajor) + 1, abs(endMinor - posMinor) + 1);
+    } else {
+        MarkDirty(posMinor < endMinor ? posMinor : endMinor, posMajor < endMajor ? posMajor : endMajor,
+                  abs(endMinor - posMinor) + 1, abs(endMajor - posMajor) + 1);
+    }
+    BeginPixelBatch(colour);
+    for (int k = first; k <= last; k++) {
+        if (xMajor) {
+            BatchPixel(posMajor, posMinor, colour);
+        } else {
+            BatchPixel(posMinor, posMajor, colour);
+        }
+        posMajor += majorStep;
+        //change minor position once we've moved far enough from where the line would actually be
+        e += minorLength;
+        if (e >= length) {
+            e -= length;
+            posMinor += minorStep;
+        }
+    }
+    EndPixelBatch();
+}
+
+void DrawUserRectangle(uint32_t start, uint32_t size, uint8_t colour) {
+    //Version used on the receiving end of user transfer code
+    Vector2 s = Reverse32BitMergeVector2(start);
+    Vector2 m = Reverse32BitMergeVector2(size);
+    Rectangle r = { .x = s.x, .y = s.y, .width = m.x, .height = m.y };
+    DrawRectangle(r, colour);
+}
+
+void DrawRectangle(Rectangle rect, uint8_t colour)
+{
+    //Fast method drawing a rectangle with horizontal and vertical methods
+    Vector2 s = {.x = rect.x, .y = rect.y + rect.height};
+    DrawHorizontalLine(s, rect.width, colour);
+    s.y -= rect.height;
+    DrawHorizontalLine(s, rect.width, colour);
+    DrawVerticalLine(s, rect.height, colour);
+    s.x += rect.width;
+    DrawVerticalLine(s, rect.height, colour);
+}
+
+void FillUserRectangle(uint32_t start, uint32_t size, uint8_t colour) {
+    //Version used on the receiving end of user transfer code
+    Vector2 s = Reverse32BitMergeVector2(start);
+    Vector2 m = Reverse32BitMergeVector2(size);
+    Rectangle r = { .x = s.x, .y = s.y, .width = m.x, .height = m.y };
+    FillRectangle(r, colour);
+}
+
+void FillRectangle(Rectangle rect, uint8_t colour) {
+    //in plane mode whole columns are filled at a time so the map mask is only set up to 3 times
+    FillClippedBlock((int16_t)rect.x, (int16_t)rect.y, rect.width, rect.height, colour);
+}
+
+void DrawUserCircle(uint32_t centre, uint16_t radius, uint8_t colour) {
+    //Version used on the receiving end of user transfer code
+    Vector2 c = Reverse32BitMergeVector2(centre);
+    DrawCircle(c, radius, colour);
+}
+
+void DrawCircle(Vector2 centre, uint16_t radius, uint8_t colour) {
+    //Bresenham circle drawing algorithm, otherwise known as Midpoint circle algorithm
+    Vector2 pos = {.x = radius, .y = 0};
+    int16_t p = 1 - radius;
+    int cx = (int16_t)centre.x, cy = (int16_t)centre.y;
+    int cxmpx, cxppx, cympy, cyppy, cxmpy, cxppy, cympx, cyppx;
+    int left, top, right, bottom;
+
+    //nothing to do if the circle is entirely outside the clip rectangle.
+    //if it is entirely inside, the pixels don't need checking one by one
+    GetClip(&left, &top, &right, &bottom);
+    if (cx + radius < left || cx - radius >= right || cy + radius < top || cy - radius >= bottom) {
+        return;
+    }
+    uint8_t inside = cx - radius >= left && cx + radius < right && cy - radius >= top && cy + radius < bottom;
+
+    MarkDirty(cx - radius, cy - radius, radius * 2 + 1, radius * 2 + 1);
+    BeginPixelBatch(colour);
+
+    while (pos.x > pos.y)
+    { 
+        //minor optimization as these would otherwise be done twice.
+        cxmpx = cx - pos.x;
+        cxppx = cx + pos.x;
+        cympy = cy - pos.y;
+        cyppy = cy + pos.y;
+        cxmpy = cx - pos.y;
+        cxppy = cx + pos.y;
+        cympx = cy - pos.x;
+        cyppx = cy + pos.x;
+
+        if (inside) {
+            BatchPixel(cxppx, cyppy, colour);
+            BatchPixel(cxmpx, cyppy, colour);
+            BatchPixel(cxppx, cympy, colour);
+            BatchPixel(cxmpx, cympy, colour);
+
+            BatchPixel(cxppy, cyppx, colour);
+            BatchPixel(cxppy, cympx, colour);
+            BatchPixel(cxmpy, cyppx, colour);
+            BatchPixel(cxmpy, cympx, colour);
+        } else {
+            //a right/left column is visible when its x is, and a top/bottom row when its y is
+            uint8_t inPpx = cxppx >= left && cxppx < right, inMpx = cxmpx >= left && cxmpx < right;
+            uint8_t inPpy = cxppy >= left && cxppy < right, inMpy = cxmpy >= left && cxmpy < right;
+            uint8_t inYppy = cyppy >= top && cyppy < bottom, inYmpy = cympy >= top && cympy < bottom;
+            uint8_t inYppx = cyppx >= top && cyppx < bottom, inYmpx = cympx >= top && cympx < bottom;
+            if (inPpx && inYppy) BatchPixel(cxppx, cyppy, colour);
+            if (inMpx && inYppy) BatchPixel(cxmpx, cyppy, colour);
+            if (inPpx && inYmpy) BatchPixel(cxppx, cympy, colour);
+            if (inMpx && inYmpy) BatchPixel(cxmpx, cympy, colour);
+
+            if (inPpy && inYppx) BatchPixel(cxppy, cyppx, colour);
+            if (inPpy && inYmpx) BatchPixel(cxppy, cympx, colour);
+            if (inMpy && inYppx) BatchPixel(cxmpy, cyppx, colour);
+            if (inMpy && inYmpx) BatchPixel(cxmpy, cympx, colour);
+        }
+
+        pos.y++;
+        if (p <= 0)
+        {
+            p += (pos.y * 2) + 1;
+        }
+        else
+        {
+            pos.x--;
+            p += (pos.y * 2) - (pos.x * 2) + 1;
+        }
+    }
+    EndPixelBatch();
+}
+
+void FillUserCircle(uint32_t centre, uint16_t radius, uint8_t colour) {
+    //Version used on the receiving end of user transfer code
+    Vector2 c = Reverse32BitMergeVector2(centre);
+    FillCircle(c, radius, colour);
+}
+
+static void FillRowPair(int cx, int cy, int offset, int half, uint8_t colour)
+{
+    //Fill the rows offset above and below the centre, half pixels either side of it.
+    //The centre row is only filled once. Each row is clipped as a span
+    int x = cx - half, y = cy - offset, width = half * 2 + 1, height = 1;
+    if (ClipBlock(&x, &y, &width, &height)) {
+        FillBlock(x, y, width, 1, colour);
+    }
+    if (offset != 0) {
+        x = cx - half;
+        y = cy + offset;
+        width = half * 2 + 1;
+        height = 1;
+        if (ClipBlock(&x, &y, &width, &height)) {
+            FillBlock(x, y, width, 1, colour);
+        }
+    }
+}
+
+static int ClipRejectBox(int x, int y, int width, int height)
+{
+    //Returns 1 if a bounding box is entirely outside the clip rectangle
+    return !ClipBlock(&x, &y, &width, &height);
+}
+
+void FillCircle(Vector2 centre, uint16_t radius, uint8_t colour)
+{
+    //signed so a radius of 0 can step x below 0 and end the loop
+    int x = radius;
+    int y = 0;
+    int p = 1 - radius;
+    int cx = (int16_t)centre.x, cy = (int16_t)centre.y;
+
+    if (ClipRejectBox(cx - radius, cy - radius, radius * 2 + 1, radius * 2 + 1)) {
+        return;
+    }
+    MarkDirty(cx - radius, cy - radius, radius * 2 + 1, radius * 2 + 1);
+
+    //Same midpoint steps as DrawCircle, but every row is filled exactly once as a span.
+    //Rows near the middle (offset y) change each step. Rows near the top and bottom
+    //(offset x) are only filled once y has reached their widest, just before x moves on
+    while (x >= y)
+    {
+        FillRowPair(cx, cy, y, x, colour);
+        if (p <= 0)
+        {
+            y++;
+            p += (y * 2) + 1;
+        }
+        else
+        {
+            if (x > y) {
+                FillRowPair(cx, cy, x, y, colour);
+            }
+            y++;
+            x--;
+            p += (y * 2) - (x * 2) + 1;
+        }
+    }
+}
+
+void FillUserEllipse(uint32_t centre, uint32_t radii, uint8_t colour) {
+    //Version used on the receiving end of user transfer code
+    Vector2 c = Reverse32BitMergeVector2(centre);
+    Vector2 r = Reverse32BitMergeVector2(radii);
+    FillEllipse(c, r.x, r.y, colour);
+}
+
+void FillEllipse(Vector2 centre, uint16_t radiusX, uint16_t radiusY, uint8_t colour)
+{
+    //A pixel dx, dy from the centre is inside if it is within the ellipse with radii half a
+    //pixel bigger than asked for: 4dx^2(2ry+1)^2 + 4dy^2(2rx+1)^2 <= (2rx+1)^2(2ry+1)^2.
+    //The half width only ever shrinks going away from the centre, so each row
+    //costs a few multiplies and is filled once
+    uint64_t a = (uint64_t)(radiusX * 2 + 1) * (radiusX * 2 + 1);
+    uint64_t b = (uint64_t)(radiusY * 2 + 1) * (radiusY * 2 + 1);
+    uint64_t limit = a * b;
+    uint32_t half = radiusX;
+    int cx = (int16_t)centre.x, cy = (int16_t)centre.y;
+
+    if (ClipRejectBox(cx - radiusX, cy - radiusY, radiusX * 2 + 1, radiusY * 2 + 1)) {
+        return;
+    }
+    MarkDirty(cx - radiusX, cy - radiusY, radiusX * 2 + 1, radiusY * 2 + 1);
+    for (uint32_t dy = 0; dy <= radiusY; dy++) {
+        uint64_t rowTerm = 4 * (uint64_t)dy * dy * a;
+        while (half > 0 && 4 * (uint64_t)half * half * b + rowTerm > limit) {
+            half--;
+        }
+        FillRowPair(cx, cy, dy, half, colour);
+    }
+}
+
+void DrawUserPolygon(uint16_t xPoints[], uint16_t yPoints[], uint32_t sizeCol) {
+    //Version used on the receiving end of user transfer code
+    Vector2 vSizeCol = Reverse32BitMergeVector2(sizeCol);
+    uint8_t col = (uint8_t)vSizeCol.y;
+    uint16_t size = vSizeCol.x;
+    DrawPolygon(xPoints, yPoints, size, col);
+}
+
+void DrawPolygon(uint16_t xPoints[], uint16_t yPoints[], uint16_t sides, uint8_t colour)
+{
+    //Draw a line between each of the positions through the list and then last and first
+    uint16_t length = sides;
+    Vector2 s = {.x = 0, .y = 0};
+    Vector2 e = {.x = 0, .y = 0};
+
+    //one batch for the whole outline
+    BeginPixelBatch(colour);
+    for (int i = 0; i < length - 1; i++)
+    {
+        s.x = xPoints[i];
+        s.y = yPoints[i];
+        e.x = xPoints[i + 1];
+        e.y = yPoints[i + 1];
+        DrawLine(s, e, colour);
+    }
+    s.x = xPoints[0];
+    s.y = yPoints[0];
+    e.x = xPoints[length-1];
+    e.y = yPoints[length-1];
+    DrawLine(s, e, colour);
+    EndPixelBatch();
+}
+
+void FillUserPolygon(uint16_t xPoints[], uint16_t yPoints[], uint32_t sizeCol) {
+    //Version used on the receiving end of user transfer code.
+    //The high byte of the colour half selects the fill rule
+    Vector2 vSizeCol = Reverse32BitMergeVector2(sizeCol);
+    uint8_t col = (uint8_t)vSizeCol.y;
+    uint8_t rule = (uint8_t)(vSizeCol.y >> 8);
+    uint16_t size = vSizeCol.x;
+    FillPolygonWithRule(xPoints, yPoints, size, col, rule);
+}
+
+void FillPolygon(uint16_t xPoints[], uint16_t yPoints[], uint16_t sides, uint8_t colour) {
+    FillPolygonWithRule(xPoints, yPoints, sides, colour, FILL_EVEN_ODD);
+}
+
+static void BuildEdgeTable(int32_t xPoints[], int32_t yPoints[], int sides, PolygonEdge* edges, int32_t* rowEdges, int top, int bottom)
+{
+    //Put every edge in the bucket for the first visible row it crosses. Vertices are
+    //24.8 fixed point and an edge covers the rows whose y is from its top y up to but
+    //not including its bottom y, so a vertex shared by two edges is only counted once
+    int i, j;
+    int count = 0;
+    for (i = 0, j = sides - 1; i < sides; j = i++) {
+        int32_t x0 = xPoints[j], y0 = yPoints[j];
+        int32_t x1 = xPoints[i], y1 = yPoints[i];
+        int8_t winding = 1;
+        if (y0 > y1) {
+            int32_t t = x0; x0 = x1; x1 = t;
+            t = y0; y0 = y1; y1 = t;
+            winding = -1;
+        }
+        int32_t firstRow = (y0 + 0xFF) >> 8;
+        int32_t endRow = (y1 + 0xFF) >> 8;
+        if (firstRow >= endRow || endRow <= top || firstRow >= bottom) {
+            continue;
+        }
+        if (firstRow < top) {
+            firstRow = top;
+        }
+        PolygonEdge* e = &edges[count];
+        //16.16 x per row, and x where the edge crosses the first row it covers. That x comes
+        //from the end points rather than the slope, so it stays between them however steep
+        //the edge. An edge less than a row high covers one row at most and never steps, and
+        //its slope is left at 0 rather than divided out of a tiny height
+        e->dx = y1 - y0 < 0x100 ? 0 : MultiplyDivide(x1 - x0, 0x10000, y1 - y0);
+        e->x = (x0 << 8) + MultiplyDivide(x1 - x0, ((firstRow << 8) - y0) << 8, y1 - y0);
+        e->yEnd = endRow;
+        e->winding = winding;
+        e->next = rowEdges[firstRow];
+        rowEdges[firstRow] = count;
+        count++;
+    }
+}
+
+void FillPolygonWithRule(uint16_t xPoints[], uint16_t yPoints[], uint16_t sides, uint8_t colour, uint8_t rule) {
+    //Scanline fill using an edge table and an active edge list. Each row only looks at the
+    //edges that cross it, kept sorted by x, and fills the spans between them, so the cost
+    //is proportional to the polygon's height and edge count rather than its area
+    static PolygonEdge edgePool[POLYGON_STATIC_EDGES];
+    static int32_t rowEdges[POLYGON_MAX_ROWS];
+    PolygonEdge* edges = edgePool;
+    int32_t* xs = _clipX[0];
+    int32_t* ys = _clipY[0];
+    int count = sides;
+    uint32_t blocks = 0;
+    int32_t active = -1;
+    int32_t minX = 32767, minY = 32767, maxX = -32768, maxY = -32768;
+    int left, top, right, bottom;
+    int32_t y, i;
+
+    if (sides < 3) {
+        return;
+    }
+    //coordinates are signed while clipping
+    for (i = 0; i < sides; i++) {
+        int16_t x = xPoints[i], y = yPoints[i];
+        if (x < minX) { minX = x; }
+        if (x > maxX) { maxX = x; }
+        if (y < minY) { minY = y; }
+        if (y > maxY) { maxY = y; }
+    }
+    GetClip(&left, &top, &right, &bottom);
+    if (maxX < left || minX >= right || maxY < top || minY >= bottom) {
+        return;
+    }
+    if (sides > CLIP_MAX_SIDES) {
+        //large polygons get their vertices and edges from the physical memory manager,
+        //and rely on the rows and spans being clipped below rather than Sutherland-Hodgman
+        blocks = (sides * (sizeof(PolygonEdge) + 2 * sizeof(int32_t)) + 4095) / 4096;
+        edges = (PolygonEdge *)PMM_AllocateBlocks(blocks);
+        if (!edges) {
+            return;
+        }
+        xs = (int32_t *)(edges + sides);
+        ys = xs + sides;
+    }
+    for (i = 0; i < sides; i++) {
+        xs[i] = (int16_t)xPoints[i] << 8;
+        ys[i] = (int16_t)yPoints[i] << 8;
+    }
+    if ((minX < left || maxX >= right || minY < top || maxY >= bottom) && sides <= CLIP_MAX_SIDES) {
+        //Sutherland-Hodgman against each side of the clip rectangle in turn, so
+        //edges outside it never reach the edge table
+        int n = ClipPolygonEdge(_clipX[0], _clipY[0], sides, _clipX[1], _clipY[1], CLIP_LEFT, left << 8);
+        if (n > 0) {
+            n = ClipPolygonEdge(_clipX[1], _clipY[1], n, _clipX[2], _clipY[2], CLIP_RIGHT, right << 8);
+        }
+        if (n > 0) {
+            n = ClipPolygonEdge(_clipX[2], _clipY[2], n, _clipX[1], _clipY[1], CLIP_TOP, top << 8);
+        }
+        if (n > 0) {
+            n = ClipPolygonEdge(_clipX[1], _clipY[1], n, _clipX[2], _clipY[2], CLIP_BOTTOM, bottom << 8);
+        }
+        if (n >= 0) {
+            if (n < 3) {
+                return;
+            }
+            xs = _clipX[2];
+            ys = _clipY[2];
+            count = n;
+        }
+    }
+    if (minX < left) { minX = left; }
+    if (maxX >= right) { maxX = right - 1; }
+    if (minY < top) { minY = top; }
+    if (maxY > bottom) { maxY = bottom; }
+    for (y = minY; y < maxY; y++) {
+        rowEdges[y] = -1;
+    }
+    BuildEdgeTable(xs, ys, count, edges, rowEdges, minY, maxY);
+    MarkDirty(minX, minY, maxX - minX + 1, maxY - minY + 1);
+
+    for (y = minY; y < maxY; y++) {
+        //drop edges that have ended and move the rest down a row
+        int32_t* link = &active;
+        while (*link != -1) {
+            PolygonEdge* e = &edges[*link];
+            if (e->yEnd <= y) {
+                *link = e->next;
+            } else {
+                link = &e->next;
+            }
+        }
+        //add the edges that start on this row
+        int32_t index = rowEdges[y];
+        while (index != -1) {
+            int32_t next = edges[index].next;
+            edges[index].next = active;
+            active = index;
+            index = next;
+        }
+        //insertion sort by x. the list is almost always still sorted from the last row
+        int32_t sorted = -1;
+        while (active != -1) {
+            int32_t current = active;
+            active = edges[current].next;
+            link = &sorted;
+            while (*link != -1 && edges[*link].x < edges[current].x) {
+                link = &edges[*link].next;
+            }
+            edges[current].next = *link;
+            *link = current;
+        }
+        active = sorted;
+
+        //walk across the row, filling while inside according to the fill rule
+        int winding = 0;
+        int32_t spanStart = 0;
+        for (index = active; index != -1; index = edges[index].next) {
+            PolygonEdge* e = &edges[index];
+            int wasInside = (rule == FILL_NON_ZERO) ? winding != 0 : winding & 1;
+            winding += e->winding;
+            int isInside = (rule == FILL_NON_ZERO) ? winding != 0 : winding & 1;
+            //first pixel whose centre is at or to the right of the edge
+            int32_t x = (e->x + 0xFFFF) >> 16;
+            if (!wasInside && isInside) {
+                spanStart = x;
+            } else if (wasInside && !isInside) {
+                //span clipping
+                if (spanStart < left) {
+                    spanStart = left;
+                }
+                if (x > right) {
+                    x = right;
+                }
+                if (x > spanStart) {
+                    FillBlock(spanStart, y, x - spanStart, 1, colour);
+                }
+            }
+        }
+        for (index = active; index != -1; index = edges[index].next) {
+            edges[index].x += edges[index].dx;
+        }
+    }
+    if (blocks) {
+        PMM_FreeBlocks(edges, blocks);
+    }
+}
+
+static int ClipSprite(int* x, int* y, int* width, int* height, int* column, int* row)
+{
+    //Clip a sprite's rectangle and work out the first sprite column and row that are still visible
+    int startX = *x, startY = *y;
+    if (!ClipBlock(x, y, width, height)) {
+        return 0;
+    }
+    *column = *x - startX;
+    *row = *y - startY;
+    return 1;
+}
+
+static void BlitBitmapClipped(const Bitmap* bitmap, Vector2 position, uint8_t keyed, uint8_t key)
+{
+    int x = (int16_t)position.x, y = (int16_t)position.y;
+    int width = bitmap->Width, height = bitmap->Height, column, row, i;
+    if (!ClipSprite(&x, &y, &width, &height, &column, &row)) {
+        return;
+    }
+    uint8_t* target = LinearTarget();
+    const uint8_t* src = bitmap->Pixels + row * bitmap->Width + column;
+    uint32_t writes = 0;
+    FlushPendingPixels();
+    if (target) {
+        uint8_t* dst = target + y * screenWidth + x;
+        for (row = 0; row < height; row++, src += bitmap->Width, dst += screenWidth) {
+            if (!keyed) {
+                memcpy(dst, src, width);
+                writes += width;
+                continue;
+            }
+            for (i = 0; i < width; i++) {
+                if (src[i] != key) {
+                    dst[i] = src[i];
+                    writes++;
+                }
+            }
+        }
+    } else {
+        //every 4th source pixel lands in the same plane, so copy a plane at a time
+        uint16_t rowBytes = screenWidth / 4;
+        for (int plane = 0; plane < 4; plane++) {
+            int first = (plane - x) & 3;
+            if (first >= width) {
+                continue;
+            }
+            SetMapMask(0x01 << plane);
+            const uint8_t* s = src + first;
+            uint8_t* d = _vgaMemory + y * rowBytes + ((x + first) >> 2);
+            for (row = 0; row < height; row++, s += bitmap->Width, d += rowBytes) {
+                int k = 0;
+                for (i = 0; i < width - first; i += 4, k++) {
+                    if (!keyed || s[i] != key) {
+                        VGA_WRITE(&d[k], s[i]);
+                        writes++;
+                    }
+                }
+            }
+        }
+    }
+    _pixelWrites += writes;
+    MarkDirty(x, y, width, height);
+}
+
+void BlitBitmap(const Bitmap* bitmap, Vector2 position)
+{
+    BlitBitmapClipped(bitmap, position, 0, 0);
+}
+
+void BlitBitmapKeyed(const Bitmap* bitmap, Vector2 position, uint8_t key)
+{
+    BlitBitmapClipped(bitmap, position, 1, key);
+}
+
+static uint32_t EncodeRLERows(const Bitmap* bitmap, uint8_t key, uint32_t* rowOffsets, uint8_t* runs)
+{
+    //Each run is a count of transparent pixels to skip, a count of opaque pixels and then the
+    //opaque pixels themselves. Counts are bytes, so longer stretches are split over several runs.
+    //A run of 0 and 0 ends the row. With runs == 0 this only measures the encoded size
+    uint32_t size = 0;
+    for (int row = 0; row < bitmap->Height; row++) {
+        const uint8_t* pixels = bitmap->Pixels + row * bitmap->Width;
+        int x = 0;
+        if (rowOffsets) {
+            rowOffsets[row] = size;
+        }
+        while (x < bitmap->Width) {
+            int skip = 0, count = 0;
+            while (x < bitmap->Width && pixels[x] == key && skip < 255) {
+                skip++;
+                x++;
+            }
+            if (x == bitmap->Width) {
+                //the end of row marker covers trailing transparent pixels
+                break;
+            }
+            while (x < bitmap->Width && pixels[x] != key && count < 255) {
+                if (runs) {
+                    runs[size + 2 + count] = pixels[x];
+                }
+                count++;
+                x++;
+            }
+            if (runs) {
+                runs[size] = skip;
+                runs[size + 1] = count;
+            }
+            size += 2 + count;
+        }
+        if (runs) {
+            runs[size] = 0;
+            runs[size + 1] = 0;
+        }
+        size += 2;
+    }
+    return size;
+}
+
+uint32_t GetRLESpriteSize(const Bitmap* bitmap, uint8_t key)
+{
+    return bitmap->Height * sizeof(uint32_t) + EncodeRLERows(bitmap, key, 0, 0);
+}
+
+void CreateRLESprite(RLESprite* sprite, const Bitmap* bitmap, uint8_t key, void* storage)
+{
+    sprite->Width = bitmap->Width;
+    sprite->Height = bitmap->Height;
+    sprite->RowOffsets = (uint32_t *)storage;
+    sprite->Runs = (uint8_t *)storage + bitmap->Height * sizeof(uint32_t);
+    EncodeRLERows(bitmap, key, sprite->RowOffsets, sprite->Runs);
+}
+
+void BlitRLESprite(const RLESprite* sprite, Vector2 position)
+{
+    //Transparent runs are stepped over without touching a pixel. In plane mode the rows
+    //are walked once per plane so the map mask is only set 4 times
+    int spriteX = (int16_t)position.x, spriteY = (int16_t)position.y;
+    int x = spriteX, y = spriteY;
+    int width = sprite->Width, height = sprite->Height, left, top;
+    if (!ClipSprite(&x, &y, &width, &height, &left, &top)) {
+        return;
+    }
+    int right = left + width;
+    uint8_t* target = LinearTarget();
+    uint16_t rowBytes = screenWidth / 4;
+    uint32_t writes = 0;
+    int planes = target ? 1 : 4;
+    FlushPendingPixels();
+    for (int plane = 0; plane < planes; plane++) {
+        if (!target) {
+            SetMapMask(0x01 << plane);
+        }
+        for (int row = top; row < top + height; row++) {
+            const uint8_t* run = sprite->Runs + sprite->RowOffsets[row];
+            int screenY = spriteY + row;
+            int column = 0;
+            while (run[0] || run[1]) {
+                int start = column + run[0];
+                int end = start + run[1];
+                int runStart = start;
+                const uint8_t* pixels = run + 2;
+                run += 2 + run[1];
+                column = end;
+                if (start >= right) {
+                    break;
+                }
+                if (end <= left) {
+                    continue;
+                }
+                if (start < left) {
+                    start = left;
+                }
+                if (end > right) {
+                    end = right;
+                }
+                if (target) {
+                    memcpy(target + screenY * screenWidth + spriteX + start, pixels + start - runStart, end - start);
+                    writes += end - start;
+                } else {
+                    //first column of the run that is in this plane
+                    int c = start + ((plane - spriteX - start) & 3);
+                    uint8_t* dst = _vgaMemory + screenY * rowBytes;
+                    for (; c < end; c += 4) {
+                        VGA_WRITE(&dst[(spriteX + c) >> 2], pixels[c - runStart]);
+                        writes++;
+                    }
+                }
+            }
+        }
+    }
+    _pixelWrites += writes;
+    MarkDirty(x, y, width, height);
+}
+
+uint32_t GetPlanarSpriteSize(const Bitmap* bitmap)
+{
+    return (uint32_t)bitmap->Width * bitmap->Height;
+}
+
+void CreatePlanarSprite(PlanarSprite* sprite, const Bitmap* bitmap, void* storage)
+{
+    //Split the columns into 4 groups by (column & 3), each stored as its own packed image
+    uint8_t* data = (uint8_t *)storage;
+    sprite->Width = bitmap->Width;
+    sprite->Height = bitmap->Height;
+    for (int group = 0; group < 4; group++) {
+        uint16_t groupWidth = bitmap->Width > group ? (bitmap->Width - group + 3) / 4 : 0;
+        sprite->GroupWidth[group] = groupWidth;
+        sprite->Groups[group] = data;
+        for (int row = 0; row < bitmap->Height; row++) {
+            const uint8_t* src = bitmap->Pixels + row * bitmap->Width + group;
+            for (int k = 0; k < groupWidth; k++) {
+                *data++ = src[k * 4];
+            }
+        }
+    }
+}
+
+static void BlitPlanarSpriteClipped(const PlanarSprite* sprite, Vector2 position, uint8_t keyed, uint8_t key)
+{
+    //Column group g always lands in a single plane ((x + g) & 3) as a run of consecutive bytes,
+    //wherever the sprite is on the screen, so each group is copied row by row in one pass
+    int spriteX = (int16_t)position.x, spriteY = (int16_t)position.y;
+    int x = spriteX, y = spriteY;
+    int width = sprite->Width, height = sprite->Height, left, top, row, k;
+    if (!ClipSprite(&x, &y, &width, &height, &left, &top)) {
+        return;
+    }
+    int right = left + width;
+    uint8_t* target = LinearTarget();
+    uint16_t rowBytes = screenWidth / 4;
+    uint32_t writes = 0;
+    FlushPendingPixels();
+    for (int group = 0; group < 4; group++) {
+        uint16_t groupWidth = sprite->GroupWidth[group];
+        //range of k for which column group + 4k is inside [left, right)
+        int first = left > group ? (left - group + 3) / 4 : 0;
+        int last = right > group ? (right - group + 3) / 4 : 0;
+        if (first >= last) {
+            continue;
+        }
+        const uint8_t* src = sprite->Groups[group] + top * groupWidth;
+        if (target) {
+            uint8_t* dst = target + y * screenWidth + spriteX + group;
+            for (row = 0; row < height; row++, src += groupWidth, dst += screenWidth) {
+                for (k = first; k < last; k++) {
+                    if (!keyed || src[k] != key) {
+                        dst[k * 4] = src[k];
+                        writes++;
+                    }
+                }
+            }
+            continue;
+        }
+        SetMapMask(0x01 << ((spriteX + group) & 3));
+        uint8_t* dst = _vgaMemory + y * rowBytes + ((spriteX + group) >> 2);
+        for (row = 0; row < height; row++, src += groupWidth, dst += rowBytes) {
+            if (!keyed) {
+                VGA_COPY_TO(dst + first, src + first, last - first);
+                writes += last - first;
+                continue;
+            }
+            for (k = first; k < last; k++) {
+                if (src[k] != key) {
+                    VGA_WRITE(&dst[k], src[k]);
+                    writes++;
+                }
+            }
+        }
+    }
+    _pixelWrites += writes;
+    MarkDirty(x, y, width, height);
+}
+
+void BlitPlanarSprite(const PlanarSprite* sprite, Vector2 position)
+{
+    BlitPlanarSpriteClipped(sprite, position, 0, 0);
+}
+
+void BlitPlanarSpriteKeyed(const PlanarSprite* sprite, Vector2 position, uint8_t key)
+{
+    BlitPlanarSpriteClipped(sprite, position, 1, key);
+}
+
+void BlitUserSprite(const void* sprite, uint32_t position, uint32_t modeKey) {
+    //Version used on the receiving end of user transfer code. The blit mode is in the low
+    //byte of modeKey and the transparent colour in the byte above it
+    Vector2 p = Reverse32BitMergeVector2(position);
+    uint8_t key = (modeKey >> 8) & 0xFF;
+    switch (modeKey & 0xFF) {
+        case BLIT_OPAQUE:
+            BlitBitmap((const Bitmap *)sprite, p);
+            break;
+        case BLIT_KEYED:
+            BlitBitmapKeyed((const Bitmap *)sprite, p, key);
+            break;
+        case BLIT_RLE:
+            BlitRLESprite((const RLESprite *)sprite, p);
+            break;
+        case BLIT_PLANAR:
+            BlitPlanarSprite((const PlanarSprite *)sprite, p);
+            break;
+        case BLIT_PLANAR_KEYED:
+            BlitPlanarSpriteKeyed((const PlanarSprite *)sprite, p, key);
+            break;
+    }
+}
+
+static void LatchCopyBytes(int srcOffset, int dstOffset, int bytes, int rows, uint8_t mask, int backwards)
+{
+    //Copy a block of bytes in all the planes enabled by mask. In write mode 1 every read loads
+    //the 4 latches with a byte from each plane and every write stores them, so each byte moved
+    //is 4 pixels and the data never passes through the CPU. Backwards copies go bottom up and
+    //right to left, for when the destination overlaps the source further on in memory
+    uint16_t rowBytes = screenWidth / 4;
+    int step = backwards ? -rowBytes : rowBytes;
+    volatile uint8_t* src = _vgaMemory + srcOffset;
+    volatile uint8_t* dst = _vgaMemory + dstOffset;
+    int row, b;
+    if (backwards) {
+        src += (rows - 1) * rowBytes;
+        dst += (rows - 1) * rowBytes;
+    }
+    SetMapMask(mask);
+    for (row = 0; row < rows; row++, src += step, dst += step) {
+        if (backwards) {
+            for (b = bytes - 1; b >= 0; b--) {
+                VGA_WRITE(&dst[b], VGA_READ(&src[b]));
+            }
+        } else {
+            for (b = 0; b < bytes; b++) {
+                VGA_WRITE(&dst[b], VGA_READ(&src[b]));
+            }
+        }
+    }
+}
+
+static void LatchCopyRect(int sx, int sy, int dx, int dy, int width, int height)
+{
+    //Source and destination start in the same plane, so their bytes line up. The partial
+    //bytes at each end get their own map mask and the middle is copied with all planes enabled.
+    //The caller selects write mode 1 first
+    uint16_t rowBytes = screenWidth / 4;
+    int last = dx + width - 1;
+    int leftByte = dx >> 2;
+    int rightByte = last >> 2;
+    int shift = (sy - dy) * rowBytes + (sx >> 2) - leftByte;
+    uint8_t leftMask = (0x0F << (dx & 3)) & 0x0F;
+    uint8_t rightMask = 0x0F >> (3 - (last & 3));
+    int middleStart = leftByte, middleEnd = rightByte + 1;
+    int copyLeft = 0, copyRight = 0;
+    int backwards = shift < 0;
+    int overlap = sx < dx + width && dx < sx + width && sy < dy + height && dy < sy + height;
+    int row, rows, offset;
+
+    if (leftByte == rightByte) {
+        leftMask &= rightMask;
+    }
+    if (leftMask != 0x0F) {
+        copyLeft = 1;
+        middleStart++;
+    }
+    if (rightMask != 0x0F && rightByte != leftByte) {
+        copyRight = 1;
+        middleEnd--;
+    }
+    //Without overlap each section is copied in one go, so the map mask is set at most 3 times.
+    //With overlap every byte must be read before it is written over, so go a row at a time
+    //in the same direction as the bytes are copied
+    rows = overlap ? 1 : height;
+    for (row = 0; row < height; row += rows) {
+        offset = (dy + (backwards ? height - rows - row : row)) * rowBytes;
+        if (copyLeft && !backwards) {
+            LatchCopyBytes(offset + leftByte + shift, offset + leftByte, 1, rows, leftMask, 0);
+        }
+        if (copyRight && backwards) {
+            LatchCopyBytes(offset + rightByte + shift, offset + rightByte, 1, rows, rightMask, 1);
+        }
+        if (middleEnd > middleStart) {
+            LatchCopyBytes(offset + middleStart + shift, offset + middleStart, middleEnd - middleStart, rows, 0x0F, backwards);
+        }
+        if (copyLeft && backwards) {
+            LatchCopyBytes(offset + leftByte + shift, offset + leftByte, 1, rows, leftMask, 1);
+        }
+        if (copyRight && !backwards) {
+            LatchCopyBytes(offset + rightByte + shift, offset + rightByte, 1, rows, rightMask, 0);
+        }
+    }
+}
+
+static void PlanarCopyRect(int sx, int sy, int dx, int dy, int width, int height)
+{
+    //Source and destination are in different planes, so the latches cannot be used. Read each
+    //source row a plane at a time into a buffer and write it out a plane at a time
+    uint16_t rowBytes = screenWidth / 4;
+    int backwards = dy > sy;
+    int row, i, plane, c;
+    for (i = 0; i < height; i++) {
+        row = backwards ? height - 1 - i : i;
+        uint8_t* src = _vgaMemory + (sy + row) * rowBytes;
+        uint8_t* dst = _vgaMemory + (dy + row) * rowBytes;
+        for (plane = 0; plane < 4; plane++) {
+            //graphics controller read map select
+            VGA_SetGraphicsControllerRegister(0x04, plane);
+            for (c = (plane - sx) & 3; c < width; c += 4) {
+                _copyRow[c] = VGA_READ(&src[(sx + c) >> 2]);
+            }
+        }
+        for (plane = 0; plane < 4; plane++) {
+            SetMapMask(0x01 << plane);
+            for (c = (plane - dx) & 3; c < width; c += 4) {
+                VGA_WRITE(&dst[(dx + c) >> 2], _copyRow[c]);
+            }
+        }
+    }
+}
+
+void CopyRect(Rectangle source, Vector2 destination)
+{
+    //Copy a rectangle of the screen somewhere else on it. The source can also be in the
+    //off-screen VGA memory below the screen. Overlapping rectangles are copied correctly
+    int sx = source.x, sy = source.y, width = source.width, height = source.height;
+    int dx = (int16_t)destination.x, dy = (int16_t)destination.y;
+    int column, row, sourceRows;
+    uint8_t* target = LinearTarget();
+    if (!ClipSprite(&dx, &dy, &width, &height, &column, &row)) {
+        return;
+    }
+    sx += column;
+    sy += row;
+    if (_backBuffer) {
+        sourceRows = screenHeight;
+    } else {
+        sourceRows = VGA_GetMemoryRows(_pageFlipping ? _drawPage : 0);
+    }
+    if (sx + width > screenWidth) {
+        width = screenWidth - sx;
+    }
+    if (sy + height > sourceRows) {
+        height = sourceRows - sy;
+    }
+    if (width <= 0 || height <= 0 || (sx == dx && sy == dy)) {
+        return;
+    }
+    FlushPendingPixels();
+    _pixelWrites += (uint32_t)width * height;
+    if (target) {
+        int backwards = dy > sy || (dy == sy && dx > sx);
+        int i, c;
+        for (i = 0; i < height; i++) {
+            row = backwards ? height - 1 - i : i;
+            uint8_t* src = target + (sy + row) * screenWidth + sx;
+            uint8_t* dst = target + (dy + row) * screenWidth + dx;
+            if (backwards) {
+                for (c = width - 1; c >= 0; c--) {
+                    dst[c] = src[c];
+                }
+            } else {
+                for (c = 0; c < width; c++) {
+                    dst[c] = src[c];
+                }
+            }
+        }
+    } else if (((sx ^ dx) & 3) == 0) {
+        //graphics mode register: write mode 1, then back to write mode 0
+        VGA_SetGraphicsControllerRegister(0x05, 0x41);
+        LatchCopyRect(sx, sy, dx, dy, width, height);
+        VGA_SetGraphicsControllerRegister(0x05, 0x40);
+    } else {
+        PlanarCopyRect(sx, sy, dx, dy, width, height);
+    }
+    MarkDirty(dx, dy, width, height);
+}
+
+void CopyUserRect(uint32_t start, uint32_t size, uint32_t destination) {
+    //Version used on the receiving end of user transfer code
+    Vector2 s = Reverse32BitMergeVector2(start);
+    Vector2 m = Reverse32BitMergeVector2(size);
+    Rectangle r = { .x = s.x, .y = s.y, .width = m.x, .height = m.y };
+    CopyRect(r, Reverse32BitMergeVector2(destination));
+}
+
+static void ResetGlyphCache(uint8_t pages)
+{
+    //Lay the slots out in bands of FONT_HEIGHT rows across the memory past the pages in use.
+    //Without page flipping only the first page is used, which leaves the most room
+    uint16_t rowBytes = screenWidth / 4;
+    uint16_t spareRows = VGA_GetMemoryRows(pages - 1) - screenHeight;
+    uint32_t slots;
+    _glyphFirstRow = pages * screenHeight;
+    _glyphSlotsPerBand = rowBytes / GLYPH_CELL_BYTES;
+    slots = (uint32_t)(spareRows / FONT_HEIGHT) * _glyphSlotsPerBand;
+    if (slots > GLYPH_CACHE_MAX_SLOTS) {
+        slots = GLYPH_CACHE_MAX_SLOTS;
+    }
+    _glyphSlots = slots & ~(GLYPH_CACHE_WAYS - 1);
+    for (int i = 0; i < GLYPH_CACHE_MAX_SLOTS; i++) {
+        _glyphKeys[i] = 0;
+    }
+    _glyphModeSets = VGA_GetModeSetCount();
+    _glyphPages = pages;
+}
+
+static uint16_t FindGlyphCell(uint32_t key, uint8_t* found)
+{
+    //Look for the cell in its group. When it isn't there it takes an empty slot in the group,
+    //or the slots are reused in turn
+    uint16_t groups = _glyphSlots / GLYPH_CACHE_WAYS;
+    uint16_t first = ((key * 2654435761u) >> 16) % groups * GLYPH_CACHE_WAYS;
+    uint16_t slot = first + (_glyphNextWay++ & (GLYPH_CACHE_WAYS - 1));
+    for (int way = 0; way < GLYPH_CACHE_WAYS; way++) {
+        if (_glyphKeys[first + way] == key) {
+            *found = 1;
+            return first + way;
+        }
+        if (_glyphKeys[first + way] == 0) {
+            slot = first + way;
+        }
+    }
+    *found = 0;
+    _glyphKeys[slot] = key;
+    return slot;
+}
+
+static void RenderGlyphCell(uint16_t slot, uint8_t code, uint8_t align, uint8_t colour, uint8_t background)
+{
+    //Draw a cell into its slot a plane at a time, in write mode 0. Pixels of the slot either
+    //side of the glyph's 9 columns are never copied to the screen, so they are skipped
+    uint16_t rowBytes = screenWidth / 4;
+    const uint16_t* glyph = 0;
+    uint8_t* cell = VGA_GetPageAddress(0) + (uint32_t)(_glyphFirstRow + slot / _glyphSlotsPerBand * FONT_HEIGHT) * rowBytes +
+                    slot % _glyphSlotsPerBand * GLYPH_CELL_BYTES;
+    if (code >= FONT_FIRST && code <= FONT_LAST) {
+        glyph = FontGlyphs[code - FONT_FIRST];
+    }
+    VGA_SetGraphicsControllerRegister(0x05, 0x40);
+    for (int plane = 0; plane < 4; plane++) {
+        SetMapMask(0x01 << plane);
+        for (int b = 0; b < GLYPH_CELL_BYTES; b++) {
+            int column = b * 4 + plane - align;
+            uint8_t* p = cell + b;
+            if (column < 0 || column >= FONT_WIDTH) {
+                continue;
+            }
+            for (int row = 0; row < FONT_HEIGHT; row++, p += rowBytes) {
+                uint8_t lit = glyph && ((glyph[row] >> column) & 1);
+                VGA_WRITE(p, lit ? colour : background);
+            }
+        }
+    }
+}
+
+static uint8_t GlyphCacheReady()
+{
+    //Lay the cache out again if the mode or the number of pages in use has changed. Returns 0 if
+    //there is no room for it
+    uint8_t pages = _pageFlipping ? VGA_GetPageCount() : 1;
+    if (_glyphModeSets != VGA_GetModeSetCount() || _glyphPages != pages) {
+        ResetGlyphCache(pages);
+    }
+    return _glyphSlots != 0;
+}
+
+static void LatchText(const char* text, int x, int y, uint8_t colour, uint8_t background, const Rectangle* box)
+{
+    //Latch copy the cells of the text that are inside box to the page being drawn, drawing any
+    //that aren't in the cache into it first
+    uint16_t rowBytes = screenWidth / 4;
+    int left = box->x, right = box->x + box->width;
+    int first = box->y - y, last = first + box->height;
+    int cx = x;
+    uint8_t found;
+    //row of VGA memory the page being drawn starts at, as the slots are counted from the first page
+    int pageRow = (_vgaMemory - VGA_GetPageAddress(0)) / rowBytes;
+    VGA_SetGraphicsControllerRegister(0x05, 0x41);
+    for (int i = 0; text[i] != '\0'; i++, cx += FONT_WIDTH) {
+        int start = cx > left ? cx : left;
+        int end = cx + FONT_WIDTH < right ? cx + FONT_WIDTH : right;
+        uint8_t align = cx & 3;
+        if (start >= end) {
+            continue;
+        }
+        uint32_t key = (uint8_t)text[i] | (uint32_t)align << 8 | (uint32_t)colour << 16 | (uint32_t)background << 24;
+        uint16_t slot = FindGlyphCell(key, &found);
+        if (!found) {
+            RenderGlyphCell(slot, (uint8_t)text[i], align, colour, background);
+            VGA_SetGraphicsControllerRegister(0x05, 0x41);
+        }
+        int sx = slot % _glyphSlotsPerBand * GLYPH_CELL_BYTES * 4 + align;
+        int sy = _glyphFirstRow + slot / _glyphSlotsPerBand * FONT_HEIGHT - pageRow;
+        LatchCopyRect(sx + start - cx, sy + first, start, y + first, end - start, last - first);
+    }
+    VGA_SetGraphicsControllerRegister(0x05, 0x40);
+}
+
+static uint8_t QueueCachedText(const char* text, int x, int y, uint8_t colour, uint8_t background, const Rectangle* box)
+{
+    //With a back buffer, draw the text into it and leave it to Present to latch copy to the screen.
+    //Only the cells inside box are kept. Returns 0 if there is no room to keep them
+    int firstCell = (box->x - x) / FONT_WIDTH;
+    int lastCell = (box->x + box->width - x + FONT_WIDTH - 1) / FONT_WIDTH;
+    int i;
+    if (_cachedTextCount[0] == MAX_CACHED_TEXTS || lastCell - firstCell > CACHED_TEXT_LENGTH) {
+        return 0;
+    }
+    //the same pixels as the cells in the cache
+    for (unsigned int row = box->y - y; row < box->y + box->height - y; row++) {
+        uint8_t* dst = _backBuffer + (y + row) * screenWidth;
+        int cell = firstCell;
+        int column = box->x - x - cell * FONT_WIDTH;
+        for (unsigned int px = box->x; px < box->x + box->width; px++) {
+            uint8_t code = (uint8_t)text[cell];
+            uint8_t lit = code >= FONT_FIRST && code <= FONT_LAST && ((FontGlyphs[code - FONT_FIRST][row] >> column) & 1);
+            dst[px] = lit ? colour : background;
+            if (++column == FONT_WIDTH) {
+                column = 0;
+                cell++;
+            }
+        }
+    }
+    _pixelWrites += box->width * box->height;
+    //text already waiting that this covers is no longer what the screen should show
+    for (i = 0; i < _cachedTextCount[0]; i++) {
+        if (RectanglesIntersect(box, &_cachedTexts[0][i].box)) {
+            Rectangle covered = _cachedTexts[0][i].box;
+            _cachedTexts[0][i--] = _cachedTexts[0][--_cachedTextCount[0]];
+            MarkDirty(covered.x, covered.y, covered.width, covered.height);
+        }
+    }
+    CachedText* cached = &_cachedTexts[0][_cachedTextCount[0]++];
+    cached->box = *box;
+    cached->x = x + firstCell * FONT_WIDTH;
+    cached->y = y;
+    cached->colour = colour;
+    cached->background = background;
+    for (i = 0; i < lastCell - firstCell; i++) {
+        cached->text[i] = text[firstCell + i];
+    }
+    cached->text[i] = '\0';
+    return 1;
+}
+
+uint8_t DrawCachedText(const char* text, uint16_t x, uint16_t y, uint8_t colour, uint8_t background)
+{
+    int left, top, right, bottom;
+    int cx = (int16_t)x, cy = (int16_t)y;
+    int first, last, count;
+    if (chain4 || !GlyphCacheReady()) {
+        return 0;
+    }
+    //rows of the cells inside the clip rectangle
+    GetClip(&left, &top, &right, &bottom);
+    first = top > cy ? top - cy : 0;
+    last = bottom < cy + FONT_HEIGHT ? bottom - cy : FONT_HEIGHT;
+    for (count = 0; text[count] != '\0'; count++);
+    int boxLeft = cx > left ? cx : left;
+    int boxRight = cx + count * FONT_WIDTH < right ? cx + count * FONT_WIDTH : right;
+    if (first >= last || boxLeft >= boxRight) {
+        return 1;
+    }
+    Rectangle box = { boxLeft, cy + first, boxRight - boxLeft, last - first };
+    FlushPendingPixels();
+    if (_backBuffer) {
+        return QueueCachedText(text, cx, cy, colour, background, &box);
+    }
+    LatchText(text, cx, cy, colour, background, &box);
+    _pixelWrites += box.width * box.height;
+    MarkDirty(box.x, box.y, box.width, box.height);
+    return 1;
+}
+
+//4x4 ordered dither thresholds, in 16ths of a colour step
+static const uint8_t _ditherThresholds[4][4] = {
+    { 0, 8, 2, 10 },
+    { 12, 4, 14, 6 },
+    { 3, 11, 1, 9 },
+    { 15, 7, 13, 5 }
+};
+
+static int32_t GradientStep(int from, int to, int pixels)
+{
+    //16.16 change in colour index per pixel, so the last pixel lands exactly on the end colour
+    return pixels > 1 ? (to - from) * 65536 / (pixels - 1) : 0;
+}
+
+static void FillGradientRuns(int32_t value, int32_t step, int x, int y, int width, int height, uint8_t vertical)
+{
+    //The gradient only changes along one axis, so fill each run of equal colour as a single block
+    int count = vertical ? height : width;
+    int start = 0;
+    uint8_t colour = (value + 0x8000) >> 16;
+    for (int i = 1; i <= count; i++) {
+        value += step;
+        uint8_t next = (value + 0x8000) >> 16;
+        if (i < count && next == colour) {
+            continue;
+        }
+        if (vertical) {
+            FillBlock(x, y + start, width, i - start, colour);
+        } else {
+            FillBlock(x + start, y, i - start, height, colour);
+        }
+        start = i;
+        colour = next;
+    }
+}
+
+void DrawGradientRectangleWithDither(Rectangle rect, unsigned int ColTL, unsigned int ColTR, unsigned int ColBL, unsigned int ColBR, uint8_t dither)
+{
+    //Bilinear interpolation in 16.16 fixed point. The colour down each side steps by a constant
+    //each row and across each row by a constant each pixel, so there is one divide per row
+    //and an add per pixel. Without dithering the value is rounded to the nearest index; with it
+    //a 4x4 ordered dither spreads the fraction between the two nearest indexes
+    int x = (int16_t)rect.x, y = (int16_t)rect.y, width = rect.width, height = rect.height;
+    int column, top, row, i;
+    int32_t leftStep = GradientStep(ColTL, ColBL, rect.height);
+    int32_t rightStep = GradientStep(ColTR, ColBR, rect.height);
+    if (!ClipSprite(&x, &y, &width, &height, &column, &top)) {
+        return;
+    }
+    int32_t left = ColTL * 65536 + leftStep * top;
+    int32_t right = ColTR * 65536 + rightStep * top;
+    uint8_t* target = LinearTarget();
+    FlushPendingPixels();
+
+    if (!dither && leftStep == rightStep && ColTL == ColTR) {
+        //top to bottom only: runs of whole rows
+        FillGradientRuns(left, leftStep, x, y, width, height, 1);
+    } else if (!dither && leftStep == 0 && rightStep == 0) {
+        //left to right only: runs of whole columns
+        int32_t step = GradientStep(ColTL, ColTR, rect.width);
+        FillGradientRuns(left + step * column, step, x, y, width, height, 0);
+    } else if (target) {
+        uint8_t* dst = target + y * screenWidth + x;
+        for (row = 0; row < height; row++, left += leftStep, right += rightStep, dst += screenWidth) {
+            int32_t step = rect.width > 1 ? (right - left) / (int32_t)(rect.width - 1) : 0;
+            int32_t value = left + step * column;
+            const uint8_t* thresholds = _ditherThresholds[(y + row) & 3];
+            if (!dither) {
+                value += 0x8000;
+                for (i = 0; i < width; i++, value += step) {
+                    dst[i] = value >> 16;
+                }
+            } else {
+                for (i = 0; i < width; i++, value += step) {
+                    dst[i] = (value + (thresholds[(x + i) & 3] << 12) + 0x800) >> 16;
+                }
+            }
+        }
+        _pixelWrites += (uint32_t)width * height;
+    } else {
+        //A plane at a time. Every 4th pixel is in the plane, so the value steps 4 times as far,
+        //and they all share a dither column
+        uint16_t rowBytes = screenWidth / 4;
+        for (int plane = 0; plane < 4; plane++) {
+            int first = (plane - x) & 3;
+            if (first >= width) {
+                continue;
+            }
+            SetMapMask(0x01 << plane);
+            int32_t rowLeft = left, rowRight = right;
+            uint8_t* dst = _vgaMemory + y * rowBytes;
+            for (row = 0; row < height; row++, rowLeft += leftStep, rowRight += rightStep, dst += rowBytes) {
+                int32_t step = rect.width > 1 ? (rowRight - rowLeft) / (int32_t)(rect.width - 1) : 0;
+                int32_t value = rowLeft + step * (column + first);
+                int32_t round = dither ? (_ditherThresholds[(y + row) & 3][plane] << 12) + 0x800 : 0x8000;
+                value += round;
+                for (i = first; i < width; i += 4, value += step * 4) {
+                    VGA_WRITE(&dst[(x + i) >> 2], value >> 16);
+                }
+            }
+        }
+        _pixelWrites += (uint32_t)width * height;
+    }
+    MarkDirty(x, y, width, height);
+}
+
+void DrawGradientRectangle(Rectangle rect, unsigned int ColTL, unsigned int ColTR, unsigned int ColBL, unsigned int ColBR)
+{
+    DrawGradientRectangleWithDither(rect, ColTL, ColTR, ColBL, ColBR, 0);
+}
+
+void DrawUserGradientRectangle(uint32_t start, uint32_t size, uint32_t corners) {
+    //Version used on the receiving end of user transfer code. corners holds the top left, top
+    //right, bottom left and bottom right colours from the high byte down, and the top bit of
+    //the width turns dithering on
+    Vector2 s = Reverse32BitMergeVector2(start);
+    Vector2 m = Reverse32BitMergeVector2(size);
+    Rectangle r = { .x = s.x, .y = s.y, .width = m.x & 0x7FFF, .height = m.y };
+    DrawGradientRectangleWithDither(r, corners >> 24, (corners >> 16) & 0xFF, (corners >> 8) & 0xFF, corners & 0xFF, m.x >> 15);
+}
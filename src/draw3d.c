@@ -1,116 +1,524 @@
-// not working
-// an attempt to draw a 3D cube
-// abandoned due to a number of float/int conversion errors
-// -m-nosse did not solve these issues.
-// not included in build
-
 #include <draw3d.h>
-#include <math.h>
+#include <fixed.h>
+
+//Outcodes: which sides of the view frustum a point is outside
+#define OUT_LEFT 0x01
+#define OUT_RIGHT 0x02
+#define OUT_BOTTOM 0x04
+#define OUT_TOP 0x08
+#define OUT_NEAR 0x10
+#define OUT_FAR 0x20
+
+//Furthest off screen a projected point is allowed to be, so lines stay within 16 bits
+#define PROJECT_LIMIT 8192
+
+//Largest screen the scene's line buffers cover, the same as the widest mode
+#define SCENE_MAX_WIDTH 400
+#define SCENE_MAX_HEIGHT 600
+
+//Light direction (towards the light, up and to the left in front of the model) in 2.14, and the
+//share of the brightness every face gets whichever way it faces
+#define LIGHT_X -9459
+#define LIGHT_Y 9459
+#define LIGHT_Z -9459
+#define LIGHT_ONE 16384
+#define LIGHT_AMBIENT 4096
+
+//The colour cube CreateColourPalette builds: 16 + red * 36 + green * 6 + blue, 6 levels each
+#define CUBE_FIRST 16
+#define CUBE_LAST 231
+#define CUBE_LEVELS 6
+
+static uint16_t _focal = 256;
+static fixed _inverseFocal = FIXED_ONE / 256;
+static fixed _near = FIXED_ONE * 8;
+static fixed _far = FIXED_ONE * 4096;
+
+//View space vertices and their projections for the mesh being drawn. Screen positions keep
+//their fraction for the rasteriser, and depth is focal / z, which is linear across the screen
+static fixed _viewX[MESH_MAX_VERTICES];
+static fixed _viewY[MESH_MAX_VERTICES];
+static fixed _viewZ[MESH_MAX_VERTICES];
+static fixed _screenX[MESH_MAX_VERTICES];
+static fixed _screenY[MESH_MAX_VERTICES];
+static fixed _depth[MESH_MAX_VERTICES];
+static uint8_t _outcodes[MESH_MAX_VERTICES];
+
+//A triangle ready for scan conversion. Vertices are sorted top to bottom; the long edge runs
+//from 0 to 2 and the short edges from 0 to 1 and 1 to 2. Depth is stepped along the long edge
+//and then across the line
+typedef struct {
+    fixed X0, Y0, X1, Y1;
+    fixed Slope02, Slope01, Slope12;
+    fixed Depth0, DepthSlope02, DepthStepX;
+    int16_t Top, Bottom;
+    int16_t Next;
+    uint8_t Colour;
+    uint8_t LongOnLeft;
+} SceneTriangle;
+
+static SceneTriangle _triangles[SCENE_MAX_TRIANGLES];
+static uint16_t _triangleCount;
+//triangles by the first line they cover, linked through Next
+static int16_t _lineFirst[SCENE_MAX_HEIGHT];
+static int16_t _active[SCENE_MAX_TRIANGLES];
 
-void DrawTeapot()
+//one line of the scene: the nearest depth so far (0 where nothing is) and its colour
+static fixed _lineDepth[SCENE_MAX_WIDTH];
+static uint8_t _lineColour[SCENE_MAX_WIDTH];
+
+void Matrix4_Identity(Matrix4* m)
+{
+    for (int row = 0; row < 4; row++) {
+        for (int column = 0; column < 4; column++) {
+            m->m[row][column] = row == column ? FIXED_ONE : 0;
+        }
+    }
+}
+
+void Matrix4_Multiply(Matrix4* result, const Matrix4* a, const Matrix4* b)
+{
+    Matrix4 product;
+    for (int row = 0; row < 4; row++) {
+        for (int column = 0; column < 4; column++) {
+            int64_t sum = 0;
+            for (int i = 0; i < 4; i++) {
+                sum += (int64_t)a->m[row][i] * b->m[i][column];
+            }
+            product.m[row][column] = (fixed)(sum >> FIXED_SHIFT);
+        }
+    }
+    *result = product;
+}
+
+//Rotation in the plane of two axes, e.g. y and z for a rotation about x
+static void Matrix4_Rotation(Matrix4* m, uint16_t angle, int first, int second)
 {
-    float rotationCos = cos(cube.rotate);
-    float rotationSin = sin(cube.rotate);
+    fixed c = FixedCos(angle);
+    fixed s = FixedSin(angle);
+    Matrix4_Identity(m);
+    m->m[first][first] = c;
+    m->m[first][second] = -s;
+    m->m[second][first] = s;
+    m->m[second][second] = c;
+}
 
-    uint16_t    projX,
-                projY,
-                i;
+void Matrix4_RotationX(Matrix4* m, uint16_t angle)
+{
+    Matrix4_Rotation(m, angle, 1, 2);
+}
 
-    Vector3 newPos = {.x = 0.0f, .y = 0.0f, .z = 0.0f};
+void Matrix4_RotationY(Matrix4* m, uint16_t angle)
+{
+    Matrix4_Rotation(m, angle, 2, 0);
+}
 
-    for (i = 0; i < TOTAL_POINTS; i++)
-    {
-        Vector3 p = cube.points[i];
-        newPos.x = p.x;
-        newPos.y = (p.y * rotationCos - p.z * rotationSin);
-        newPos.z = (p.y * rotationSin + p.z * rotationCos);
-        // uint16_t a = newPos.y;
-        // char* c = ToStringUint16(a, 10);
-        // WriteText(c, 0,0,1,5);
+void Matrix4_RotationZ(Matrix4* m, uint16_t angle)
+{
+    Matrix4_Rotation(m, angle, 0, 1);
+}
 
-        newPos.z += cube.z;
+void Matrix4_Translation(Matrix4* m, fixed x, fixed y, fixed z)
+{
+    Matrix4_Identity(m);
+    m->m[0][3] = x;
+    m->m[1][3] = y;
+    m->m[2][3] = z;
+}
+
+void Draw3D_SetCamera(uint16_t focal, fixed nearZ, fixed farZ)
+{
+    if (focal == 0 || nearZ <= 0 || farZ <= nearZ) {
+        return;
+    }
+    _focal = focal;
+    _inverseFocal = FixedReciprocal(FIXED_FROM_INT(focal));
+    _near = nearZ;
+    _far = farZ;
+}
+
+void Draw3D_TransformVertices(const Matrix4* m, const int16_t* x, const int16_t* y, const int16_t* z, uint16_t count,
+                              uint8_t shift, fixed* outX, fixed* outY, fixed* outZ)
+{
+    //one row of the matrix at a time, so each pass keeps its 4 terms in registers. The matrix is
+    //16.16 and the positions are in 1 / 2^shift units, so the shift alone brings the sum to 16.16
+    for (int row = 0; row < 3; row++) {
+        fixed m0 = m->m[row][0], m1 = m->m[row][1], m2 = m->m[row][2], m3 = m->m[row][3];
+        fixed* out = row == 0 ? outX : (row == 1 ? outY : outZ);
+        for (uint16_t i = 0; i < count; i++) {
+            int64_t sum = (int64_t)m0 * x[i] + (int64_t)m1 * y[i] + (int64_t)m2 * z[i];
+            out[i] = (fixed)(sum >> shift) + m3;
+        }
+    }
+}
+
+//Outside the plane through the eye and a screen edge, e.g. x / z > halfWidth / focal on the right
+static uint8_t Outcode(fixed x, fixed y, fixed z)
+{
+    int64_t fx = (int64_t)x * _focal;
+    int64_t fy = (int64_t)y * _focal;
+    int64_t sx = (int64_t)z * (screenWidth / 2);
+    int64_t sy = (int64_t)z * (screenHeight / 2);
+    uint8_t code = 0;
+    if (fx < -sx) {
+        code |= OUT_LEFT;
+    } else if (fx > sx) {
+        code |= OUT_RIGHT;
+    }
+    if (fy < -sy) {
+        code |= OUT_BOTTOM;
+    } else if (fy > sy) {
+        code |= OUT_TOP;
+    }
+    if (z < _near) {
+        code |= OUT_NEAR;
+    } else if (z > _far) {
+        code |= OUT_FAR;
+    }
+    return code;
+}
+
+//1 if a sphere in view space is entirely outside one of the frustum planes
+static int SphereOutside(fixed x, fixed y, fixed z, fixed radius)
+{
+    //distance to a side plane is (x * focal - z * halfWidth) / |(focal, halfWidth)|
+    int64_t horizontal = (int64_t)radius * ISqrt((uint32_t)_focal * _focal + (uint32_t)(screenWidth / 2) * (screenWidth / 2));
+    int64_t vertical = (int64_t)radius * ISqrt((uint32_t)_focal * _focal + (uint32_t)(screenHeight / 2) * (screenHeight / 2));
+    int64_t fx = (int64_t)x * _focal;
+    int64_t fy = (int64_t)y * _focal;
+    int64_t sx = (int64_t)z * (screenWidth / 2);
+    int64_t sy = (int64_t)z * (screenHeight / 2);
+    return z + radius < _near || z - radius > _far ||
+           fx - sx > horizontal || -fx - sx > horizontal ||
+           fy - sy > vertical || -fy - sy > vertical;
+}
+
+static fixed ProjectAxis(fixed value, fixed scale, int centre)
+{
+    fixed p = FixedMultiply(value, scale);
+    if (p > FIXED_FROM_INT(PROJECT_LIMIT)) {
+        p = FIXED_FROM_INT(PROJECT_LIMIT);
+    } else if (p < -FIXED_FROM_INT(PROJECT_LIMIT)) {
+        p = -FIXED_FROM_INT(PROJECT_LIMIT);
+    }
+    return FIXED_FROM_INT(centre) + p;
+}
+
+//Transform and project a mesh's vertices. 0 if the whole mesh is out of view
+static int ProjectMesh(const Mesh* mesh, const Matrix4* transform)
+{
+    uint16_t count = mesh->VertexCount;
+    int centreX = screenWidth / 2;
+    int centreY = screenHeight / 2;
 
-        float pX = newPos.x / newPos.z;
-        projX = (uint16_t)pX;
-        float pY = newPos.y / newPos.z;
-        projY = (uint16_t)pY;
+    if (count > MESH_MAX_VERTICES ||
+        SphereOutside(transform->m[0][3], transform->m[1][3], transform->m[2][3], mesh->Radius)) {
+        return 0;
+    }
 
-        // char *j = ToStringUint16(projX, 10);
-        // WriteText(j, 50, i * 10, 1, 5);
+    Draw3D_TransformVertices(transform, mesh->X, mesh->Y, mesh->Z, count, mesh->Shift, _viewX, _viewY, _viewZ);
 
-        // j = ToStringUint16(projY, 10);
-        // WriteText(j, 100, i * 10, 1, 5);
+    //project with one reciprocal per vertex: x * focal / z = x * (1 / (z / focal))
+    for (uint16_t i = 0; i < count; i++) {
+        _outcodes[i] = Outcode(_viewX[i], _viewY[i], _viewZ[i]);
+        if (!(_outcodes[i] & OUT_NEAR)) {
+            fixed scale = FixedReciprocal(FixedMultiply(_viewZ[i], _inverseFocal));
+            _screenX[i] = ProjectAxis(_viewX[i], scale, centreX);
+            _screenY[i] = ProjectAxis(-_viewY[i], scale, centreY);
+            _depth[i] = scale;
+        }
+    }
+    return 1;
+}
 
-        cube.screenPoints[i].x = projX + (SCREEN_WIDTH / 2);
-        cube.screenPoints[i].y = SCREEN_HEIGHT - (projY + (SCREEN_HEIGHT / 2));
+//Whether a face is drawn: 0 if it is out of view or faces away, counting which in counts
+static int FaceVisible(uint16_t a, uint16_t b, uint16_t c, MeshStatistics* counts)
+{
+    //all three points outside the same plane, or any behind the eye (there is no near clipping)
+    if ((_outcodes[a] & _outcodes[b] & _outcodes[c]) || ((_outcodes[a] | _outcodes[b] | _outcodes[c]) & OUT_NEAR)) {
+        counts->FacesRejected++;
+        return 0;
     }
+    //anticlockwise in view space is clockwise on screen, where y points down
+    int64_t area = (int64_t)(_screenX[b] - _screenX[a]) * (_screenY[c] - _screenY[a]) -
+                   (int64_t)(_screenX[c] - _screenX[a]) * (_screenY[b] - _screenY[a]);
+    if (area <= 0) {
+        counts->FacesCulled++;
+        return 0;
+    }
+    counts->FacesDrawn++;
+    return 1;
+}
 
-    return;
+void Draw3D_DrawMesh(const Mesh* mesh, const Matrix4* transform, uint8_t colour, MeshStatistics* stats)
+{
+    MeshStatistics counts = { 0, 0, 0 };
 
-    Vector2 start = {.x = 0, .y = 0};
-    Vector2 end = {.x = 0, .y = 0};
-    for (i = 0; i < TOTAL_FACES; i++)
-    {
-        //asm volatile("xchgw %bx, %bx");
-        uint16_t face1 = cube.face1[i] - 1,
-                 face2 = cube.face2[i] - 1,
-                 face3 = cube.face3[i] - 1;
+    if (!ProjectMesh(mesh, transform)) {
+        counts.FacesRejected = mesh->FaceCount;
+    } else {
+        const uint16_t* face = mesh->Faces;
+        for (uint16_t f = 0; f < mesh->FaceCount; f++, face += 3) {
+            uint16_t a = face[0], b = face[1], c = face[2];
+            if (!FaceVisible(a, b, c, &counts)) {
+                continue;
+            }
+            Vector2 pa = { (uint16_t)FIXED_ROUND(_screenX[a]), (uint16_t)FIXED_ROUND(_screenY[a]) };
+            Vector2 pb = { (uint16_t)FIXED_ROUND(_screenX[b]), (uint16_t)FIXED_ROUND(_screenY[b]) };
+            Vector2 pc = { (uint16_t)FIXED_ROUND(_screenX[c]), (uint16_t)FIXED_ROUND(_screenY[c]) };
+            DrawLine(pa, pb, colour);
+            DrawLine(pb, pc, colour);
+            DrawLine(pc, pa, colour);
+        }
+    }
+    if (stats) {
+        *stats = counts;
+    }
+}
 
-        uint16_t x = cube.screenPoints[face1].x + 20;
-        uint16_t y = cube.screenPoints[face1].y + 20;
+//Scale a colour cube entry's levels by the light falling on the face. Other colours are used as they are
+static uint8_t ShadeFace(uint16_t a, uint16_t b, uint16_t c, uint8_t colour)
+{
+    if (colour < CUBE_FIRST || colour > CUBE_LAST) {
+        return colour;
+    }
+    //face normal from the view space edges, then scaled down so its length fits in 32 bits
+    int64_t ux = _viewX[b] - _viewX[a], uy = _viewY[b] - _viewY[a], uz = _viewZ[b] - _viewZ[a];
+    int64_t vx = _viewX[c] - _viewX[a], vy = _viewY[c] - _viewY[a], vz = _viewZ[c] - _viewZ[a];
+    int64_t nx = uy * vz - uz * vy;
+    int64_t ny = uz * vx - ux * vz;
+    int64_t nz = ux * vy - uy * vx;
+    while (nx > 8191 || nx < -8191 || ny > 8191 || ny < -8191 || nz > 8191 || nz < -8191) {
+        nx >>= 1;
+        ny >>= 1;
+        nz >>= 1;
+    }
+    int32_t length = (int32_t)ISqrt((uint32_t)(nx * nx + ny * ny + nz * nz));
+    int32_t light = LIGHT_AMBIENT;
+    if (length > 0) {
+        int32_t facing = (int32_t)(nx * LIGHT_X + ny * LIGHT_Y + nz * LIGHT_Z) / length;
+        if (facing > 0) {
+            light += facing * (LIGHT_ONE - LIGHT_AMBIENT) / LIGHT_ONE;
+        }
+    }
+    int index = colour - CUBE_FIRST;
+    int red = index / (CUBE_LEVELS * CUBE_LEVELS);
+    int green = index / CUBE_LEVELS % CUBE_LEVELS;
+    int blue = index % CUBE_LEVELS;
+    red = (red * light + LIGHT_ONE / 2) / LIGHT_ONE;
+    green = (green * light + LIGHT_ONE / 2) / LIGHT_ONE;
+    blue = (blue * light + LIGHT_ONE / 2) / LIGHT_ONE;
+    return (uint8_t)(CUBE_FIRST + (red * CUBE_LEVELS + green) * CUBE_LEVELS + blue);
+}
 
-        // s.y = e.y = cube.points[face1].x;
-        // //DrawLine(s, e, 6);
-        // s.y = e.y = cube.points[face1].y;
-        //DrawLine(s, e, 7);
+//First pixel whose centre is at or after a position: the top-left rule, so pixels on a shared
+//edge belong to exactly one of the two triangles
+static int FirstPixel(fixed position)
+{
+    return FIXED_TO_INT(position - FIXED_HALF + FIXED_ONE - 1);
+}
 
-        start.x = x;
-        start.y = y;
+static void AddTriangle(uint16_t a, uint16_t b, uint16_t c, uint8_t colour)
+{
+    //sort the corners top to bottom
+    uint16_t t;
+    if (_screenY[b] < _screenY[a]) {
+        t = a; a = b; b = t;
+    }
+    if (_screenY[c] < _screenY[a]) {
+        t = a; a = c; c = t;
+    }
+    if (_screenY[c] < _screenY[b]) {
+        t = b; b = c; c = t;
+    }
+    int top = FirstPixel(_screenY[a]);
+    int bottom = FirstPixel(_screenY[c]);
+    if (top < 0) {
+        top = 0;
+    }
+    if (bottom > screenHeight) {
+        bottom = screenHeight;
+    }
+    //no pixel centres inside it, or nowhere left to put it
+    if (top >= bottom || _triangleCount >= SCENE_MAX_TRIANGLES) {
+        return;
+    }
 
-        x = cube.screenPoints[face2].x;
-        y = cube.screenPoints[face2].y;
+    SceneTriangle* triangle = &_triangles[_triangleCount];
+    fixed height02 = _screenY[c] - _screenY[a];
+    fixed height01 = _screenY[b] - _screenY[a];
+    fixed height12 = _screenY[c] - _screenY[b];
+    triangle->X0 = _screenX[a];
+    triangle->Y0 = _screenY[a];
+    triangle->X1 = _screenX[b];
+    triangle->Y1 = _screenY[b];
+    triangle->Slope02 = FixedDivide(_screenX[c] - _screenX[a], height02);
+    triangle->Slope01 = height01 > 0 ? FixedDivide(_screenX[b] - _screenX[a], height01) : 0;
+    triangle->Slope12 = height12 > 0 ? FixedDivide(_screenX[c] - _screenX[b], height12) : 0;
+    triangle->Depth0 = _depth[a];
+    triangle->DepthSlope02 = FixedDivide(_depth[c] - _depth[a], height02);
 
-        end.x = x;
-        end.y = y;
-        //DrawLine(s, e, 8);
+    //depth changes by the same amount per pixel on every line; find it across the widest line,
+    //the one through the middle corner
+    fixed longX = _screenX[a] + FixedMultiply(height01, triangle->Slope02);
+    fixed longDepth = _depth[a] + FixedMultiply(height01, triangle->DepthSlope02);
+    fixed width = _screenX[b] - longX;
+    triangle->DepthStepX = width > FIXED_ONE / 16 || width < -FIXED_ONE / 16 ?
+                           FixedDivide(_depth[b] - longDepth, width) : 0;
+    triangle->LongOnLeft = width > 0;
+    triangle->Top = (int16_t)top;
+    triangle->Bottom = (int16_t)bottom;
+    triangle->Colour = colour;
+    triangle->Next = _lineFirst[top];
+    _lineFirst[top] = (int16_t)_triangleCount;
+    _triangleCount++;
+}
 
-        //DrawLine(start, end, 5);
+void Draw3D_BeginScene()
+{
+    _triangleCount = 0;
+    for (int y = 0; y < SCENE_MAX_HEIGHT; y++) {
+        _lineFirst[y] = -1;
+    }
+}
 
-        // s.y = e.y = 50;
-        // DrawLine(s, e, 7);
+void Draw3D_AddSolidMesh(const Mesh* mesh, const Matrix4* transform, uint8_t colour, MeshStatistics* stats)
+{
+    MeshStatistics counts = { 0, 0, 0 };
 
-        // char *a = ToStringUint16(start.x, 10);
-        // WriteText(a, 50, 0, 1, 5);
-        // a = ToStringUint16(start.y, 10);
-        // WriteText(a, 80, 0, 1, 5);
-        // a = ToStringUint16(end.x, 10);
-        // WriteText(a, 110, 0, 1, 5);
-        // a = ToStringUint16(end.y, 10);
-        // WriteText(a, 140, 0, 1, 5);
+    if (screenWidth > SCENE_MAX_WIDTH || screenHeight > SCENE_MAX_HEIGHT || !ProjectMesh(mesh, transform)) {
+        counts.FacesRejected = mesh->FaceCount;
+    } else {
+        const uint16_t* face = mesh->Faces;
+        for (uint16_t f = 0; f < mesh->FaceCount; f++, face += 3) {
+            uint16_t a = face[0], b = face[1], c = face[2];
+            if (FaceVisible(a, b, c, &counts)) {
+                AddTriangle(a, b, c, ShadeFace(a, b, c, colour));
+            }
+        }
+    }
+    if (stats) {
+        *stats = counts;
+    }
+}
 
-        x = cube.screenPoints[face2].x;
-        y = cube.screenPoints[face2].y;
+//Resolve one triangle's span on a line against the line's depth buffer. Returns the span's ends
+static void ScanTriangle(const SceneTriangle* triangle, int y, int* lineLeft, int* lineRight)
+{
+    fixed centreY = FIXED_FROM_INT(y) + FIXED_HALF;
+    fixed down = centreY - triangle->Y0;
+    fixed longX = triangle->X0 + FixedMultiply(down, triangle->Slope02);
+    fixed shortX = centreY < triangle->Y1 ? triangle->X0 + FixedMultiply(down, triangle->Slope01) :
+                   triangle->X1 + FixedMultiply(centreY - triangle->Y1, triangle->Slope12);
+    fixed leftX = triangle->LongOnLeft ? longX : shortX;
+    fixed rightX = triangle->LongOnLeft ? shortX : longX;
+    int left = FirstPixel(leftX);
+    int right = FirstPixel(rightX);
+    if (left < 0) {
+        left = 0;
+    }
+    if (right > screenWidth) {
+        right = screenWidth;
+    }
+    if (left >= right) {
+        return;
+    }
 
-        start.x = x + 10;
-        start.y = y + 10;
+    //depth at the first pixel centre, from the long edge
+    fixed step = triangle->DepthStepX;
+    fixed depth = triangle->Depth0 + FixedMultiply(down, triangle->DepthSlope02) +
+                  FixedMultiply(FIXED_FROM_INT(left) + FIXED_HALF - longX, step);
+    uint8_t colour = triangle->Colour;
+    for (int x = left; x < right; x++) {
+        if (depth > _lineDepth[x]) {
+            _lineDepth[x] = depth;
+            _lineColour[x] = colour;
+        }
+        depth += step;
+    }
+    if (left < *lineLeft) {
+        *lineLeft = left;
+    }
+    if (right > *lineRight) {
+        *lineRight = right;
+    }
+}
 
-        x = cube.screenPoints[face3].x + 20;
-        y = cube.screenPoints[face3].y + 20;
+void Draw3D_EndScene()
+{
+    int activeCount = 0;
+    for (int y = 0; y < screenHeight && y < SCENE_MAX_HEIGHT; y++) {
+        for (int16_t i = _lineFirst[y]; i >= 0; i = _triangles[i].Next) {
+            _active[activeCount++] = i;
+        }
+        if (activeCount == 0) {
+            continue;
+        }
 
-        end.x = x + 10;
-        end.y = y + 10;
+        int lineLeft = screenWidth, lineRight = 0;
+        for (int i = 0; i < activeCount; i++) {
+            SceneTriangle* triangle = &_triangles[_active[i]];
+            ScanTriangle(triangle, y, &lineLeft, &lineRight);
+            //finished triangles leave the list; the last one takes their place
+            if (triangle->Bottom <= y + 1) {
+                _active[i--] = _active[--activeCount];
+            }
+        }
 
-        // start.x = cube.points[face2].x;
-        // start.y = cube.points[face2].y;
-        // end.x = cube.points[face3].x;
-        // end.y = cube.points[face3].y;
-        DrawLine(start, end, 5);
-        start.x = cube.points[face3].x;
-        start.y = cube.points[face3].y;
-        end.x = cube.points[face1].x;
-        end.y = cube.points[face1].y;
-        DrawLine(start, end, 5);
+        //write the winners out as runs of one colour, clearing the line behind us
+        int x = lineLeft;
+        while (x < lineRight) {
+            if (_lineDepth[x] == 0) {
+                x++;
+                continue;
+            }
+            int start = x;
+            uint8_t colour = _lineColour[x];
+            while (x < lineRight && _lineDepth[x] != 0 && _lineColour[x] == colour) {
+                _lineDepth[x++] = 0;
+            }
+            Vector2 position = { (uint16_t)start, (uint16_t)y };
+            DrawHorizontalLine(position, (uint16_t)(x - start), colour);
+        }
     }
+    _triangleCount = 0;
+}
 
-    cube.rotate++;
-}
\ No newline at end of file
+static void InstanceTransform(const MeshInstance* instance, Matrix4* transform)
+{
+    Matrix4 step;
+    Matrix4_RotationX(transform, instance->AngleX);
+    Matrix4_RotationY(&step, instance->AngleY);
+    Matrix4_Multiply(transform, &step, transform);
+    Matrix4_RotationZ(&step, instance->AngleZ);
+    Matrix4_Multiply(transform, &step, transform);
+    Matrix4_Translation(&step, instance->X, instance->Y, instance->Z);
+    Matrix4_Multiply(transform, &step, transform);
+}
+
+void DrawUserMesh(MeshInstance* instance)
+{
+    DrawUserScene(instance, 1);
+}
+
+void DrawUserScene(MeshInstance* instances, uint32_t count)
+{
+    Matrix4 transform;
+    Draw3D_BeginScene();
+    for (uint32_t i = 0; i < count; i++) {
+        MeshInstance* instance = &instances[i];
+        if (instance->Style == MESH_SOLID) {
+            InstanceTransform(instance, &transform);
+            Draw3D_AddSolidMesh(instance->Mesh, &transform, instance->Colour, &instance->Statistics);
+        }
+    }
+    Draw3D_EndScene();
+    //wireframes are not depth tested, so they go over the solid spans rather than being overwritten by them
+    for (uint32_t i = 0; i < count; i++) {
+        MeshInstance* instance = &instances[i];
+        if (instance->Style != MESH_SOLID) {
+            InstanceTransform(instance, &transform);
+            Draw3D_DrawMesh(instance->Mesh, &transform, instance->Colour, &instance->Statistics);
+        }
+    }
+}
@@ -0,0 +1,232 @@
+//	16.16 fixed point arithmetic
+//
+//	The tables were generated offline: sin(i * pi / 512) * 65536 for a quarter turn, and
+//	2^30 / (1 + i / 256) as seeds for the reciprocal of a mantissa between 1 and 2.
+
+#include <stdint.h>
+#include <fixed.h>
+
+#define SIN_TABLE_BITS		8
+#define SIN_FRACTION_BITS	(14 - SIN_TABLE_BITS)
+
+static const int32_t _sinTable[(1 << SIN_TABLE_BITS) + 1] =
+{
+	0, 402, 804, 1206, 1608, 2010, 2412, 2814, 3216, 3617, 4019, 4420,
+	4821, 5222, 5623, 6023, 6424, 6824, 7224, 7623, 8022, 8421, 8820, 9218,
+	9616, 10014, 10411, 10808, 11204, 11600, 11996, 12391, 12785, 13180, 13573, 13966,
+	14359, 14751, 15143, 15534, 15924, 16314, 16703, 17091, 17479, 17867, 18253, 18639,
+	19024, 19409, 19792, 20175, 20557, 20939, 21320, 21699, 22078, 22457, 22834, 23210,
+	23586, 23961, 24335, 24708, 25080, 25451, 25821, 26190, 26558, 26925, 27291, 27656,
+	28020, 28383, 28745, 29106, 29466, 29824, 30182, 30538, 30893, 31248, 31600, 31952,
+	32303, 32652, 33000, 33347, 33692, 34037, 34380, 34721, 35062, 35401, 35738, 36075,
+	36410, 36744, 37076, 37407, 37736, 38064, 38391, 38716, 39040, 39362, 39683, 40002,
+	40320, 40636, 40951, 41264, 41576, 41886, 42194, 42501, 42806, 43110, 43412, 43713,
+	44011, 44308, 44604, 44898, 45190, 45480, 45769, 46056, 46341, 46624, 46906, 47186,
+	47464, 47741, 48015, 48288, 48559, 48828, 49095, 49361, 49624, 49886, 50146, 50404,
+	50660, 50914, 51166, 51417, 51665, 51911, 52156, 52398, 52639, 52878, 53114, 53349,
+	53581, 53812, 54040, 54267, 54491, 54714, 54934, 55152, 55368, 55582, 55794, 56004,
+	56212, 56418, 56621, 56823, 57022, 57219, 57414, 57607, 57798, 57986, 58172, 58356,
+	58538, 58718, 58896, 59071, 59244, 59415, 59583, 59750, 59914, 60075, 60235, 60392,
+	60547, 60700, 60851, 60999, 61145, 61288, 61429, 61568, 61705, 61839, 61971, 62101,
+	62228, 62353, 62476, 62596, 62714, 62830, 62943, 63054, 63162, 63268, 63372, 63473,
+	63572, 63668, 63763, 63854, 63944, 64031, 64115, 64197, 64277, 64354, 64429, 64501,
+	64571, 64639, 64704, 64766, 64827, 64884, 64940, 64993, 65043, 65091, 65137, 65180,
+	65220, 65259, 65294, 65328, 65358, 65387, 65413, 65436, 65457, 65476, 65492, 65505,
+	65516, 65525, 65531, 65535, 65536,
+};
+
+static const uint32_t _reciprocalTable[257] =
+{
+	1073741824, 1069563840, 1065418244, 1061304660, 1057222719, 1053172057, 1049152317, 1045163144,
+	1041204193, 1037275121, 1033375590, 1029505269, 1025663832, 1021850955, 1018066322, 1014309620,
+	1010580540, 1006878780, 1003204040, 999556025, 995934445, 992339014, 988769449, 985225473,
+	981706811, 978213192, 974744351, 971300025, 967879954, 964483884, 961111563, 957762742,
+	954437177, 951134626, 947854852, 944597618, 941362695, 938149853, 934958867, 931789515,
+	928641578, 925514838, 922409084, 919324103, 916259690, 913215638, 910191745, 907187812,
+	904203641, 901239039, 898293814, 895367775, 892460737, 889572514, 886702926, 883851791,
+	881018933, 878204176, 875407347, 872628276, 869866794, 867122735, 864395934, 861686229,
+	858993459, 856317467, 853658096, 851015192, 848388602, 845778175, 843183764, 840605220,
+	838042399, 835495158, 832963354, 830446849, 827945503, 825459180, 822987745, 820531066,
+	818089009, 815661445, 813248245, 810849283, 808464432, 806093569, 803736570, 801393315,
+	799063683, 796747556, 794444818, 792155351, 789879043, 787615779, 785365448, 783127940,
+	780903145, 778690955, 776491263, 774303963, 772128952, 769966126, 767815383, 765676621,
+	763549742, 761434645, 759331235, 757239413, 755159085, 753090156, 751032533, 748986122,
+	746950834, 744926577, 742913262, 740910800, 738919105, 736938088, 734967666, 733007752,
+	731058263, 729119117, 727190230, 725271522, 723362913, 721464323, 719575673, 717696885,
+	715827883, 713968589, 712118930, 710278829, 708448214, 706627010, 704815146, 703012550,
+	701219150, 699434878, 697659662, 695893435, 694136129, 692387675, 690648007, 688917060,
+	687194767, 685481065, 683775888, 682079174, 680390859, 678710881, 677039180, 675375693,
+	673720360, 672073122, 670433919, 668802693, 667179386, 665563939, 663956297, 662356402,
+	660764199, 659179633, 657602648, 656033191, 654471207, 652916644, 651369448, 649829567,
+	648296950, 646771546, 645253303, 643742171, 642238100, 640741042, 639250946, 637767766,
+	636291451, 634821956, 633359233, 631903234, 630453915, 629011229, 627575130, 626145574,
+	624722516, 623305911, 621895717, 620491889, 619094385, 617703162, 616318177, 614939389,
+	613566757, 612200238, 610839793, 609485381, 608136962, 606794497, 605457945, 604127268,
+	602802428, 601483385, 600170102, 598862542, 597560667, 596264440, 594973825, 593688784,
+	592409282, 591135284, 589866753, 588603655, 587345955, 586093618, 584846611, 583604898,
+	582368447, 581137224, 579911196, 578690330, 577474594, 576263956, 575058383, 573857843,
+	572662306, 571471740, 570286114, 569105397, 567929560, 566758571, 565592401, 564431020,
+	563274399, 562122509, 560975320, 559832804, 558694933, 557561677, 556433010, 555308903,
+	554189329, 553074259, 551963669, 550857529, 549755814, 548658497, 547565552, 546476952,
+	545392673, 544312687, 543236970, 542165497, 541098242, 540035181, 538976288, 537921540,
+	536870912,
+};
+
+fixed FixedMultiply(fixed a, fixed b)
+{
+	int64_t product = (int64_t)a * b;
+	product >>= FIXED_SHIFT;
+	if (product > FIXED_MAX)
+	{
+		return FIXED_MAX;
+	}
+	if (product < FIXED_MIN)
+	{
+		return FIXED_MIN;
+	}
+	return (fixed)product;
+}
+
+fixed FixedDivide(fixed a, fixed b)
+{
+	uint32_t magnitudeA = a < 0 ? 0u - (uint32_t)a : (uint32_t)a;
+	uint32_t magnitudeB = b < 0 ? 0u - (uint32_t)b : (uint32_t)b;
+	int32_t quotient;
+	int32_t remainder;
+
+	// idiv faults if the quotient does not fit in 32 bits, which is exactly when
+	// |a| * 2^16 >= |b| * 2^31
+	if ((magnitudeA >> 15) >= magnitudeB)
+	{
+		return (a < 0) != (b < 0) ? FIXED_MIN : FIXED_MAX;
+	}
+	asm("idivl %4"
+		: "=a"(quotient), "=d"(remainder)
+		: "a"((uint32_t)a << FIXED_SHIFT), "d"(a >> (32 - FIXED_SHIFT)), "rm"(b));
+	return quotient;
+}
+
+fixed FixedReciprocal(fixed x)
+{
+	uint32_t magnitude = x < 0 ? 0u - (uint32_t)x : (uint32_t)x;
+	if (magnitude <= 2)
+	{
+		// 1 / (2 / 65536) is already too big
+		return x < 0 ? FIXED_MIN : FIXED_MAX;
+	}
+
+	// Normalise to a mantissa m between 1 and 2, x = m * 2^(top - 16)
+	int top = 31 - __builtin_clz(magnitude);
+	uint32_t normalised = magnitude << (31 - top);
+	uint32_t mantissa = normalised >> 1;				// 2.30
+
+	// Interpolate the seed between table entries, then refine it: r = r * (2 - m * r)
+	uint32_t index = (normalised >> 23) & 0xff;
+	uint32_t fraction = (normalised >> 15) & 0xff;
+	uint32_t seed = _reciprocalTable[index] - (((_reciprocalTable[index] - _reciprocalTable[index + 1]) * fraction) >> 8);
+	uint32_t error = (1u << 31) - (uint32_t)(((uint64_t)mantissa * seed) >> 30);
+	uint32_t reciprocal = (uint32_t)(((uint64_t)seed * error) >> 30);	// 2.30, 1/m
+
+	// 1/x = (1/m) * 2^(16 - top), which is reciprocal * 2^(2 - top) as 16.16
+	uint32_t result;
+	if (top >= 3)
+	{
+		result = (reciprocal + (1u << (top - 3))) >> (top - 2);
+	}
+	else
+	{
+		result = reciprocal << (2 - top);
+	}
+	return x < 0 ? -(fixed)result : (fixed)result;
+}
+
+// Sine over the first quarter turn, position 0 to 1 << 14
+static fixed QuarterSin(uint32_t position)
+{
+	uint32_t index = position >> SIN_FRACTION_BITS;
+	int32_t fraction = position & ((1 << SIN_FRACTION_BITS) - 1);
+	if (!fraction)
+	{
+		return _sinTable[index];
+	}
+	int32_t step = _sinTable[index + 1] - _sinTable[index];
+	return _sinTable[index] + ((step * fraction + (1 << (SIN_FRACTION_BITS - 1))) >> SIN_FRACTION_BITS);
+}
+
+fixed FixedSin(uint16_t angle)
+{
+	uint32_t position = angle & 0x3fff;
+	switch (angle >> 14)
+	{
+		case 0:
+			return QuarterSin(position);
+		case 1:
+			return QuarterSin(0x4000 - position);
+		case 2:
+			return -QuarterSin(position);
+		default:
+			return -QuarterSin(0x4000 - position);
+	}
+}
+
+fixed FixedCos(uint16_t angle)
+{
+	return FixedSin((uint16_t)(angle + FIXED_ANGLE_TURN / 4));
+}
+
+fixed FixedSqrt(fixed x)
+{
+	// sqrt(x / 2^16) * 2^16 = sqrt(x * 2^16)
+	uint64_t value;
+	uint64_t result = 0;
+	uint64_t bit = 1ull << 62;
+
+	if (x <= 0)
+	{
+		return 0;
+	}
+	value = (uint64_t)x << FIXED_SHIFT;
+	while (bit > value)
+	{
+		bit >>= 2;
+	}
+	while (bit)
+	{
+		if (value >= result + bit)
+		{
+			value -= result + bit;
+			result = (result >> 1) + bit;
+		}
+		else
+		{
+			result >>= 1;
+		}
+		bit >>= 2;
+	}
+	return (fixed)result;
+}
+
+uint32_t ISqrt(uint32_t x)
+{
+	uint32_t result = 0;
+	uint32_t bit = 1u << 30;
+
+	while (bit > x)
+	{
+		bit >>= 2;
+	}
+	while (bit)
+	{
+		if (x >= result + bit)
+		{
+			x -= result + bit;
+			result = (result >> 1) + bit;
+		}
+		else
+		{
+			result >>= 1;
+		}
+		bit >>= 2;
+	}
+	return result;
+}
@@ -78,6 +78,15 @@ ReadSuccess:
 	pop     bx
 	pop     ax
 	add     bx, word [bpbBytesPerSector]        ; Update buffer pointer to point to next location to read to
+%ifdef READ_SECTORS_PAST_64K
+	jnc		ReadSectors_Next					; Carry means BX has wrapped to the start of the segment,
+	push	ax									; so move ES on by 64KB. Only the second stage needs this,
+	mov		ax, es								; which keeps it out of the boot sector
+	add		ax, 1000h
+	mov		es, ax
+	pop		ax
+ReadSectors_Next:
+%endif
 	inc     ax                                  ; Increment LBA
 	loop    ReadSectors                         ; read next sector
 	ret
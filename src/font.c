@@ -0,0 +1,103 @@
+//Text font: one 16 bit mask per line of each glyph, leftmost pixel in bit 0.
+//Made from fonts/font9x16.pbm by host/fontconv.c (make font); edit the image, not this file
+
+#include <stdint.h>
+#include <font.h>
+
+const uint16_t FontGlyphs[FONT_GLYPH_COUNT][FONT_HEIGHT] = {
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000 }, //space
+    { 0x000, 0x000, 0x008, 0x008, 0x008, 0x008, 0x008, 0x008, 0x008, 0x008, 0x000, 0x018, 0x018, 0x000, 0x000, 0x000 }, //'!'
+    { 0x000, 0x000, 0x06c, 0x06c, 0x06c, 0x06c, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000 }, //'"'
+    { 0x000, 0x000, 0x000, 0x06c, 0x06c, 0x0fe, 0x06c, 0x06c, 0x06c, 0x0fe, 0x06c, 0x06c, 0x000, 0x000, 0x000, 0x000 }, //'#'
+    { 0x000, 0x010, 0x010, 0x03c, 0x01a, 0x01a, 0x00a, 0x01c, 0x038, 0x048, 0x048, 0x068, 0x03e, 0x008, 0x008, 0x000 }, //'$'
+    { 0x000, 0x000, 0x08e, 0x05b, 0x07b, 0x03b, 0x01e, 0x018, 0x0e8, 0x1bc, 0x1b4, 0x1b2, 0x0e3, 0x000, 0x000, 0x000 }, //'%'
+    { 0x000, 0x000, 0x03c, 0x066, 0x066, 0x066, 0x036, 0x01c, 0x0de, 0x0f3, 0x063, 0x0e3, 0x09e, 0x000, 0x000, 0x000 }, //'&'
+    { 0x000, 0x000, 0x030, 0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000 }, //'''
+    { 0x000, 0x040, 0x020, 0x030, 0x018, 0x018, 0x00c, 0x00c, 0x00c, 0x00c, 0x00c, 0x018, 0x018, 0x030, 0x020, 0x040 }, //'('
+    { 0x000, 0x004, 0x008, 0x018, 0x030, 0x030, 0x060, 0x060, 0x060, 0x060, 0x060, 0x030, 0x030, 0x018, 0x008, 0x004 }, //')'
+    { 0x000, 0x000, 0x030, 0x092, 0x0fc, 0x038, 0x0fc, 0x092, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000 }, //'*'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x030, 0x030, 0x030, 0x1fe, 0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000 }, //'+'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x038, 0x038, 0x030, 0x038, 0x00c }, //','
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x07c, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000 }, //'-'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x038, 0x038, 0x000, 0x000, 0x000 }, //'.'
+    { 0x000, 0x000, 0x040, 0x060, 0x020, 0x020, 0x030, 0x010, 0x018, 0x008, 0x008, 0x00c, 0x004, 0x004, 0x002, 0x000 }, //'/'
+    { 0x000, 0x000, 0x000, 0x078, 0x0cc, 0x086, 0x1c6, 0x1a6, 0x196, 0x18e, 0x086, 0x0cc, 0x078, 0x000, 0x000, 0x000 }, //'0'
+    { 0x000, 0x000, 0x000, 0x018, 0x014, 0x012, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x0fe, 0x000, 0x000, 0x000 }, //'1'
+    { 0x000, 0x000, 0x000, 0x03c, 0x066, 0x040, 0x040, 0x060, 0x020, 0x010, 0x018, 0x00c, 0x0fe, 0x000, 0x000, 0x000 }, //'2'
+    { 0x000, 0x000, 0x000, 0x03e, 0x060, 0x060, 0x020, 0x03c, 0x060, 0x0c0, 0x0c0, 0x060, 0x03e, 0x000, 0x000, 0x000 }, //'3'
+    { 0x000, 0x000, 0x000, 0x070, 0x078, 0x068, 0x06c, 0x064, 0x062, 0x063, 0x0ff, 0x060, 0x060, 0x000, 0x000, 0x000 }, //'4'
+    { 0x000, 0x000, 0x000, 0x03e, 0x006, 0x006, 0x006, 0x03e, 0x060, 0x040, 0x040, 0x020, 0x01e, 0x000, 0x000, 0x000 }, //'5'
+    { 0x000, 0x000, 0x000, 0x0f0, 0x01c, 0x004, 0x006, 0x0f6, 0x0ce, 0x186, 0x186, 0x0cc, 0x078, 0x000, 0x000, 0x000 }, //'6'
+    { 0x000, 0x000, 0x000, 0x0fe, 0x0c0, 0x040, 0x060, 0x020, 0x030, 0x010, 0x018, 0x008, 0x00c, 0x000, 0x000, 0x000 }, //'7'
+    { 0x000, 0x000, 0x000, 0x03c, 0x066, 0x066, 0x026, 0x03c, 0x024, 0x042, 0x042, 0x066, 0x03c, 0x000, 0x000, 0x000 }, //'8'
+    { 0x000, 0x000, 0x000, 0x078, 0x0cc, 0x186, 0x186, 0x1c6, 0x1bc, 0x180, 0x0c0, 0x060, 0x03c, 0x000, 0x000, 0x000 }, //'9'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x018, 0x018, 0x000, 0x000, 0x000, 0x018, 0x018, 0x000, 0x000, 0x000 }, //':'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x018, 0x018, 0x000, 0x000, 0x000, 0x038, 0x038, 0x030, 0x038, 0x00c }, //';'
+    { 0x000, 0x000, 0x000, 0x000, 0x040, 0x030, 0x018, 0x00c, 0x00e, 0x00c, 0x018, 0x030, 0x040, 0x000, 0x000, 0x000 }, //'<'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0fe, 0x000, 0x000, 0x0fe, 0x000, 0x000, 0x000, 0x000, 0x000 }, //'='
+    { 0x000, 0x000, 0x000, 0x000, 0x004, 0x018, 0x030, 0x060, 0x0e0, 0x060, 0x030, 0x018, 0x004, 0x000, 0x000, 0x000 }, //'>'
+    { 0x000, 0x000, 0x00c, 0x010, 0x020, 0x020, 0x020, 0x01c, 0x00c, 0x00c, 0x000, 0x00c, 0x00c, 0x000, 0x000, 0x000 }, //'?'
+    { 0x000, 0x000, 0x0f0, 0x18c, 0x104, 0x106, 0x172, 0x15b, 0x14b, 0x14b, 0x16b, 0x0fb, 0x003, 0x002, 0x046, 0x03c }, //'@'
+    { 0x000, 0x000, 0x000, 0x038, 0x06c, 0x0c6, 0x0c6, 0x0c6, 0x0fe, 0x0c6, 0x0c6, 0x0c6, 0x0c6, 0x000, 0x000, 0x000 }, //'A'
+    { 0x000, 0x000, 0x000, 0x03e, 0x066, 0x066, 0x066, 0x03e, 0x066, 0x0c6, 0x0c6, 0x066, 0x03e, 0x000, 0x000, 0x000 }, //'B'
+    { 0x000, 0x000, 0x000, 0x078, 0x08c, 0x004, 0x002, 0x002, 0x002, 0x002, 0x006, 0x08c, 0x078, 0x000, 0x000, 0x000 }, //'C'
+    { 0x000, 0x000, 0x000, 0x03e, 0x046, 0x086, 0x086, 0x086, 0x086, 0x086, 0x0c6, 0x046, 0x03e, 0x000, 0x000, 0x000 }, //'D'
+    { 0x000, 0x000, 0x000, 0x0fc, 0x00c, 0x00c, 0x00c, 0x0fc, 0x00c, 0x00c, 0x00c, 0x00c, 0x0fc, 0x000, 0x000, 0x000 }, //'E'
+    { 0x000, 0x000, 0x000, 0x0fc, 0x00c, 0x00c, 0x00c, 0x00c, 0x0fc, 0x00c, 0x00c, 0x00c, 0x00c, 0x000, 0x000, 0x000 }, //'F'
+    { 0x000, 0x000, 0x000, 0x0f0, 0x10c, 0x004, 0x002, 0x002, 0x1e2, 0x182, 0x186, 0x18c, 0x1f8, 0x000, 0x000, 0x000 }, //'G'
+    { 0x000, 0x000, 0x000, 0x0c6, 0x0c6, 0x0c6, 0x0c6, 0x0fe, 0x0c6, 0x0c6, 0x0c6, 0x0c6, 0x0c6, 0x000, 0x000, 0x000 }, //'H'
+    { 0x000, 0x000, 0x000, 0x0fc, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x0fc, 0x000, 0x000, 0x000 }, //'I'
+    { 0x000, 0x000, 0x000, 0x07e, 0x060, 0x060, 0x060, 0x060, 0x060, 0x060, 0x060, 0x032, 0x01c, 0x000, 0x000, 0x000 }, //'J'
+    { 0x000, 0x000, 0x000, 0x046, 0x066, 0x036, 0x016, 0x01e, 0x01e, 0x016, 0x036, 0x066, 0x046, 0x000, 0x000, 0x000 }, //'K'
+    { 0x000, 0x000, 0x000, 0x00c, 0x00c, 0x00c, 0x00c, 0x00c, 0x00c, 0x00c, 0x00c, 0x00c, 0x0fc, 0x000, 0x000, 0x000 }, //'L'
+    { 0x000, 0x000, 0x000, 0x183, 0x1c7, 0x1c7, 0x1af, 0x1ab, 0x1bb, 0x193, 0x183, 0x183, 0x183, 0x000, 0x000, 0x000 }, //'M'
+    { 0x000, 0x000, 0x000, 0x0c6, 0x0ce, 0x0ce, 0x0de, 0x0f6, 0x0f6, 0x0e6, 0x0e6, 0x0c6, 0x0c6, 0x000, 0x000, 0x000 }, //'N'
+    { 0x000, 0x000, 0x000, 0x03c, 0x066, 0x0c3, 0x0c3, 0x0c3, 0x0c3, 0x0c3, 0x0c3, 0x066, 0x03c, 0x000, 0x000, 0x000 }, //'O'
+    { 0x000, 0x000, 0x000, 0x03e, 0x066, 0x046, 0x046, 0x066, 0x03e, 0x006, 0x006, 0x006, 0x006, 0x000, 0x000, 0x000 }, //'P'
+    { 0x000, 0x000, 0x000, 0x01c, 0x022, 0x041, 0x041, 0x041, 0x041, 0x041, 0x041, 0x022, 0x01c, 0x018, 0x018, 0x070 }, //'Q'
+    { 0x000, 0x000, 0x000, 0x03e, 0x046, 0x046, 0x066, 0x03e, 0x036, 0x026, 0x066, 0x046, 0x0c6, 0x000, 0x000, 0x000 }, //'R'
+    { 0x000, 0x000, 0x000, 0x03c, 0x006, 0x002, 0x006, 0x00c, 0x030, 0x040, 0x040, 0x060, 0x03e, 0x000, 0x000, 0x000 }, //'S'
+    { 0x000, 0x000, 0x000, 0x1fe, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x000, 0x000, 0x000 }, //'T'
+    { 0x000, 0x000, 0x000, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x0cc, 0x078, 0x000, 0x000, 0x000 }, //'U'
+    { 0x000, 0x000, 0x000, 0x182, 0x082, 0x0c6, 0x044, 0x044, 0x06c, 0x02c, 0x028, 0x038, 0x038, 0x000, 0x000, 0x000 }, //'V'
+    { 0x000, 0x000, 0x000, 0x081, 0x081, 0x081, 0x091, 0x099, 0x0a9, 0x0a9, 0x0e7, 0x0e7, 0x0c7, 0x000, 0x000, 0x000 }, //'W'
+    { 0x000, 0x000, 0x000, 0x0c3, 0x066, 0x02c, 0x038, 0x018, 0x038, 0x02c, 0x064, 0x0c6, 0x183, 0x000, 0x000, 0x000 }, //'X'
+    { 0x000, 0x000, 0x000, 0x101, 0x102, 0x084, 0x0cc, 0x078, 0x030, 0x030, 0x030, 0x030, 0x030, 0x000, 0x000, 0x000 }, //'Y'
+    { 0x000, 0x000, 0x000, 0x0ff, 0x040, 0x060, 0x020, 0x010, 0x010, 0x008, 0x00c, 0x004, 0x0fe, 0x000, 0x000, 0x000 }, //'Z'
+    { 0x000, 0x000, 0x07c, 0x00c, 0x00c, 0x00c, 0x00c, 0x00c, 0x00c, 0x00c, 0x00c, 0x00c, 0x00c, 0x00c, 0x00c, 0x07c }, //'['
+    { 0x000, 0x000, 0x002, 0x004, 0x004, 0x00c, 0x008, 0x008, 0x018, 0x010, 0x030, 0x020, 0x020, 0x060, 0x040, 0x000 }, //'\'
+    { 0x000, 0x000, 0x07c, 0x060, 0x060, 0x060, 0x060, 0x060, 0x060, 0x060, 0x060, 0x060, 0x060, 0x060, 0x060, 0x07c }, //']'
+    { 0x000, 0x000, 0x000, 0x030, 0x038, 0x068, 0x0cc, 0x0c4, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000 }, //'^'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1ff }, //'_'
+    { 0x000, 0x000, 0x00c, 0x018, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000 }, //'`'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 0x0c4, 0x0c0, 0x0fc, 0x0c2, 0x0e2, 0x0dc, 0x000, 0x000, 0x000 }, //'a'
+    { 0x000, 0x000, 0x006, 0x006, 0x006, 0x006, 0x076, 0x04e, 0x0c6, 0x0c6, 0x0c6, 0x066, 0x03e, 0x000, 0x000, 0x000 }, //'b'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 0x00c, 0x006, 0x006, 0x006, 0x00c, 0x078, 0x000, 0x000, 0x000 }, //'c'
+    { 0x000, 0x000, 0x0c0, 0x0c0, 0x0c0, 0x0c0, 0x0f8, 0x0cc, 0x0c6, 0x0c6, 0x0c6, 0x0e6, 0x0dc, 0x000, 0x000, 0x000 }, //'d'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 0x0cc, 0x186, 0x1fe, 0x006, 0x00c, 0x0f8, 0x000, 0x000, 0x000 }, //'e'
+    { 0x000, 0x000, 0x0f0, 0x018, 0x018, 0x018, 0x07e, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x000, 0x000, 0x000 }, //'f'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1fc, 0x0c6, 0x0c6, 0x0c6, 0x03e, 0x006, 0x07e, 0x082, 0x082, 0x07c }, //'g'
+    { 0x000, 0x000, 0x006, 0x006, 0x006, 0x006, 0x076, 0x0ce, 0x0c6, 0x0c6, 0x0c6, 0x0c6, 0x0c6, 0x000, 0x000, 0x000 }, //'h'
+    { 0x000, 0x000, 0x00c, 0x00c, 0x000, 0x000, 0x01e, 0x018, 0x018, 0x018, 0x018, 0x018, 0x07e, 0x000, 0x000, 0x000 }, //'i'
+    { 0x000, 0x000, 0x030, 0x030, 0x000, 0x000, 0x03e, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x032, 0x01c }, //'j'
+    { 0x000, 0x000, 0x006, 0x006, 0x006, 0x006, 0x066, 0x036, 0x00e, 0x01e, 0x036, 0x066, 0x0c6, 0x000, 0x000, 0x000 }, //'k'
+    { 0x000, 0x000, 0x01e, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x07e, 0x000, 0x000, 0x000 }, //'l'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0de, 0x1b6, 0x1b6, 0x1b6, 0x1b6, 0x1b6, 0x1b6, 0x000, 0x000, 0x000 }, //'m'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x076, 0x0ce, 0x0c6, 0x0c6, 0x0c6, 0x0c6, 0x0c6, 0x000, 0x000, 0x000 }, //'n'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 0x0cc, 0x186, 0x186, 0x186, 0x0cc, 0x078, 0x000, 0x000, 0x000 }, //'o'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x076, 0x0ce, 0x186, 0x186, 0x186, 0x0c6, 0x07e, 0x006, 0x006, 0x006 }, //'p'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0f8, 0x0cc, 0x0c6, 0x0c6, 0x0c6, 0x0e6, 0x0dc, 0x0c0, 0x0c0, 0x0c0 }, //'q'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0ec, 0x19c, 0x18c, 0x00c, 0x00c, 0x00c, 0x00c, 0x000, 0x000, 0x000 }, //'r'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x07c, 0x006, 0x006, 0x07c, 0x0e0, 0x0c0, 0x07e, 0x000, 0x000, 0x000 }, //'s'
+    { 0x000, 0x000, 0x000, 0x018, 0x018, 0x018, 0x0fe, 0x018, 0x018, 0x018, 0x018, 0x018, 0x0f0, 0x000, 0x000, 0x000 }, //'t'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0c6, 0x0c6, 0x0c6, 0x0c6, 0x0c6, 0x0e6, 0x0dc, 0x000, 0x000, 0x000 }, //'u'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x082, 0x0c6, 0x044, 0x044, 0x028, 0x038, 0x018, 0x000, 0x000, 0x000 }, //'v'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x082, 0x082, 0x092, 0x092, 0x0aa, 0x0ee, 0x046, 0x000, 0x000, 0x000 }, //'w'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0c6, 0x06c, 0x038, 0x030, 0x068, 0x0cc, 0x186, 0x000, 0x000, 0x000 }, //'x'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x082, 0x0c6, 0x044, 0x064, 0x028, 0x038, 0x018, 0x018, 0x008, 0x007 }, //'y'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x07e, 0x020, 0x010, 0x018, 0x008, 0x004, 0x07e, 0x000, 0x000, 0x000 }, //'z'
+    { 0x000, 0x000, 0x070, 0x018, 0x018, 0x018, 0x018, 0x018, 0x00e, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x070 }, //'{'
+    { 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030 }, //'|'
+    { 0x000, 0x000, 0x00e, 0x018, 0x018, 0x018, 0x018, 0x018, 0x070, 0x010, 0x018, 0x018, 0x018, 0x018, 0x018, 0x00e }, //'}'
+    { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x11c, 0x126, 0x1c6, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000 }, //'~'
+};
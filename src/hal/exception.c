@@ -4,6 +4,7 @@
 #include <exception.h>
 #include <hal.h>
 #include <console.h>
+#include <kprintf.h>
 
 #if __GNUC__ >= 7
 // Exception handlers that make use of the new attributes provided by 
@@ -126,9 +127,7 @@ void KernelPanic(const char* message, struct interrupt_frame *frame)
 	HAL_DisableInterrupts();
 
 	ConsoleClearScreen(0x1f);
-	ConsoleWriteString((char *)message);
-	ConsoleWriteString(" at ");
-	ConsoleWriteInt(frame->ip, 16);
+	kprintf("%s at %08X", message, frame->ip);
 	for (;;);
 }
 #else
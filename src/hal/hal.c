@@ -11,6 +11,7 @@
 #include "idt.h"
 #include "pic.h"
 #include "pit.h"
+#include "serial.h"
 #include <exception.h>
 #include <console.h>
 #include "tss.h"
@@ -25,6 +26,7 @@ int  HAL_Initialise ()
 	I86_PIC_Initialise(0x20,0x28);
 	I86_PIT_Initialise();
 	I86_PIT_StartCounter(100,I86_PIT_OCW_COUNTER_0, I86_PIT_OCW_MODE_SQUAREWAVEGEN);
+	I86_Serial_Initialise();
 	HAL_InitialiseInterrupts();
 	_halInitialised = true;
 	return 0;
@@ -145,6 +147,35 @@ uint32_t HAL_GetTickCount()
 	return I86_PIT_HAL_GetTickCount();
 }
 
+// Set handler to be called (in interrupt context) on every clock tick
+void HAL_SetTickHandler(void (*handler)(uint32_t))
+{
+	I86_PIT_SetTickHandler(handler);
+}
+
+// Return the processor's time stamp counter (cycles since reset)
+uint64_t HAL_ReadTimeStampCounter()
+{
+	uint32_t low;
+	uint32_t high;
+
+	asm volatile ("rdtsc" : "=a"(low), "=d"(high));
+	return ((uint64_t)high << 32) | low;
+}
+
+// Write a string to the first serial port, turning \n into \r\n for terminals
+void HAL_SerialWriteString(const char * s)
+{
+	while (*s)
+	{
+		if (*s == '\n')
+		{
+			I86_Serial_WriteByte('\r');
+		}
+		I86_Serial_WriteByte((uint8_t)*s++);
+	}
+}
+
 // Sleep for specified number of clock ticks.
 // This uses the HALs HAL_GetTickCount() which in turn uses the PIT
 
@@ -40,9 +40,7 @@ static void IDT_Install()
 
 static __attribute__ ((interrupt)) void I86_DefaultInterruptHandler(struct interrupt_frame *frame) 
 {
-	//ConsoleWriteString("I86_DefaultInterruptHandler: Unhandled Exception at ");
-	//ConsoleWriteInt(frame->ip, 16);
-	//ConsoleWriteString("\n");
+	//kprintf("I86_DefaultInterruptHandler: Unhandled Exception at %x\n", frame->ip);
 }
 #else
 static void I86_DefaultInterruptHandler() 
@@ -21,6 +21,9 @@ static volatile uint32_t			_pit_ticks = 0;
 // Test if pit is initialized
 static bool							_pit_IsInitialised = false;
 
+// Optional handler called on every tick with the new tick count
+static void							(*_pit_tickHandler)(uint32_t) = 0;
+
 #if __GNUC__ >= 7
 
 //	PIT timer interrupt handler
@@ -29,6 +32,12 @@ __attribute__ ((interrupt)) void  I86_PIT_TimerInterruptHandler(struct interrupt
 	// Increment tick count
 	_pit_ticks++;
 
+	// Run any deferred work that is waiting on the timer
+	if (_pit_tickHandler)
+	{
+		_pit_tickHandler(_pit_ticks);
+	}
+
 	// Tell hal we are done
 	HAL_InterruptDone(0);
 }
@@ -50,6 +59,12 @@ void  I86_PIT_TimerInterruptHandler()
 	// Increment tick count
 	_pit_ticks++;
 
+	// Run any deferred work that is waiting on the timer
+	if (_pit_tickHandler)
+	{
+		_pit_tickHandler(_pit_ticks);
+	}
+
 	// Tell hal we are done
 	HAL_InterruptDone(0);
 
@@ -81,6 +96,12 @@ uint32_t I86_PIT_HAL_GetTickCount()
 	return _pit_ticks;
 }
 
+// Set handler to be called from the timer interrupt on every tick
+void I86_PIT_SetTickHandler(void (*handler)(uint32_t))
+{
+	_pit_tickHandler = handler;
+}
+
 // Send command to pit
 void I86_PIT_SendCommand(uint8_t cmd) 
 {
@@ -53,6 +53,9 @@ uint32_t I86_PIT_SetTickCount(uint32_t i);
 // Return current tick count
 uint32_t I86_PIT_HAL_GetTickCount();
 
+// Set handler to be called from the timer interrupt on every tick
+void I86_PIT_SetTickHandler(void (*handler)(uint32_t));
+
 // Start a counter. Counter continues until another call to this routine
 void I86_PIT_StartCounter(uint32_t freq, uint8_t counter, uint8_t mode);
 
@@ -0,0 +1,55 @@
+//  serial.c
+//
+//	8250/16550 UART, transmit only
+
+#include "serial.h"
+#include <hal.h>
+
+//	Registers, as offsets from the port base
+
+#define		I86_SERIAL_REG_DATA				0		// Divisor low byte when DLAB is set
+#define		I86_SERIAL_REG_INTERRUPT		1		// Divisor high byte when DLAB is set
+#define		I86_SERIAL_REG_FIFO				2
+#define		I86_SERIAL_REG_LINE_CONTROL		3
+#define		I86_SERIAL_REG_MODEM_CONTROL	4
+#define		I86_SERIAL_REG_LINE_STATUS		5
+
+#define		I86_SERIAL_LCR_DLAB				0x80
+#define		I86_SERIAL_LCR_8N1				0x03
+#define		I86_SERIAL_LSR_THR_EMPTY		0x20
+
+// Divisor of the 115200Hz UART clock
+#define		I86_SERIAL_DIVISOR				1
+
+static bool _serial_IsInitialised = false;
+
+void I86_Serial_Initialise()
+{
+	uint16_t port = I86_SERIAL_COM1;
+
+	// No interrupts, we poll
+	HAL_OutputByteToPort(port + I86_SERIAL_REG_INTERRUPT, 0x00);
+
+	// Set the baud rate divisor
+	HAL_OutputByteToPort(port + I86_SERIAL_REG_LINE_CONTROL, I86_SERIAL_LCR_DLAB);
+	HAL_OutputByteToPort(port + I86_SERIAL_REG_DATA, I86_SERIAL_DIVISOR & 0xff);
+	HAL_OutputByteToPort(port + I86_SERIAL_REG_INTERRUPT, (I86_SERIAL_DIVISOR >> 8) & 0xff);
+
+	// 8N1, enable and clear the FIFOs, then raise DTR and RTS
+	HAL_OutputByteToPort(port + I86_SERIAL_REG_LINE_CONTROL, I86_SERIAL_LCR_8N1);
+	HAL_OutputByteToPort(port + I86_SERIAL_REG_FIFO, 0xc7);
+	HAL_OutputByteToPort(port + I86_SERIAL_REG_MODEM_CONTROL, 0x03);
+
+	_serial_IsInitialised = true;
+}
+
+bool I86_Serial_IsInitialised()
+{
+	return _serial_IsInitialised;
+}
+
+void I86_Serial_WriteByte(uint8_t value)
+{
+	while (!(HAL_InputByteFromPort(I86_SERIAL_COM1 + I86_SERIAL_REG_LINE_STATUS) & I86_SERIAL_LSR_THR_EMPTY));
+	HAL_OutputByteToPort(I86_SERIAL_COM1 + I86_SERIAL_REG_DATA, value);
+}
@@ -0,0 +1,22 @@
+#ifndef _SERIAL_H_INCLUDED
+# define _SERIAL_H_INCLUDED
+//	8250/16550 UART handling
+//
+//	Output only, polled, on the first serial port. Used to get text such as
+//	benchmark results off the machine (e.g. qemu -serial stdio) while the
+//	screen is in a graphics mode.
+
+#include <stdint.h>
+
+#define		I86_SERIAL_COM1					0x3f8
+
+// Initialise minidriver: 115200 baud, 8 data bits, no parity, 1 stop bit, no interrupts
+void I86_Serial_Initialise();
+
+// Test if interface is initialized
+bool I86_Serial_IsInitialised();
+
+// Wait until the transmitter can take another byte, then send it
+void I86_Serial_WriteByte(uint8_t value);
+
+#endif
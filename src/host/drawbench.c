@@ -0,0 +1,466 @@
+//	Host build of the drawing code: golden image checksums and timings
+//
+//	Each primitive draws a fixed scene in each screen mode against the emulated
+//	VGA in hostvga.c. The displayed page is then read back and reduced to a
+//	checksum, so a change to draw.c or print.c that alters the output in any
+//	mode shows up as a changed checksum. The same scene is then drawn repeatedly
+//	to time it.
+//
+//	drawbench		checksums, time per call and plane mode VGA writes per call
+//	drawbench -c	checksums only, checked against host/drawbench.golden. Exits
+//					with 1 if any differ or are missing (make drawcheck)
+//	drawbench -g	checksums only, in the format of host/drawbench.golden
+//
+//	A change that is meant to alter the output regenerates the golden file with
+//	./drawbench -g > host/drawbench.golden, and the commit carries the new values.
+//
+//	The meshes come from meshes.dat in the current directory, as made by the
+//	makefile from the models directory.
+//
+//	The same resolution gives the same checksum in chain4 and in plane mode, so
+//	the two lines for 320x200 should always agree.
+
+#include <stdint.h>
+#include <draw.h>
+#include <print.h>
+#include <vgamodes.h>
+#include <draw3d.h>
+#include <meshfile.h>
+#include "hostvga.h"
+
+#define BENCH_ITERATIONS	200
+#define BENCH_SPRITE_SIZE	32
+#define BENCH_MESH_FILE_SIZE	65536
+#define BENCH_GOLDEN_FILE		"host/drawbench.golden"
+#define BENCH_GOLDEN_FILE_SIZE	16384
+
+typedef struct
+{
+	uint16_t	Width;
+	uint16_t	Height;
+	uint8_t		Chain4;
+	uint8_t		BackBuffer;
+} BenchMode;
+
+typedef struct
+{
+	const char *	Name;
+	void			(*Draw)();
+} BenchScene;
+
+extern uint8_t * _vgaMemory;
+
+static const BenchMode _modes[] =
+{
+	{ 320, 200, 1, 0 },
+	{ 320, 200, 0, 0 },
+	{ 320, 240, 0, 0 },
+	{ 400, 300, 0, 0 },
+	{ 320, 240, 0, 1 },
+};
+
+static uint8_t		_spritePixels[BENCH_SPRITE_SIZE * BENCH_SPRITE_SIZE];
+static Bitmap		_sprite = { BENCH_SPRITE_SIZE, BENCH_SPRITE_SIZE, _spritePixels };
+static RLESprite	_rleSprite;
+static PlanarSprite	_planarSprite;
+static uint8_t		_spriteStorage[16384];
+static uint32_t		_meshFile[BENCH_MESH_FILE_SIZE / 4];
+static const Mesh *	_cube;
+static const Mesh *	_teapot;
+static char			_golden[BENCH_GOLDEN_FILE_SIZE];
+
+static void DrawClear()
+{
+	ClearScreen(17);
+}
+
+static void DrawFill()
+{
+	Rectangle rect = { 7, 5, screenWidth - 20, screenHeight - 13 };
+	FillRectangle(rect, 42);
+	rect.x = 1;
+	rect.y = 3;
+	rect.width = 3;
+	rect.height = 50;
+	FillRectangle(rect, 43);
+}
+
+static void DrawLines()
+{
+	Vector2 centre = { screenWidth / 2, screenHeight / 2 };
+	for (int i = 0; i < 64; i++)
+	{
+		// Every slope, including the horizontal and vertical cases
+		Vector2 end;
+		end.x = i < 32 ? i * (screenWidth - 1) / 31 : (i < 48 ? 0 : screenWidth - 1);
+		end.y = i < 32 ? (i & 1) * (screenHeight - 1) : (i & 15) * (screenHeight - 1) / 15;
+		DrawLine(centre, end, (uint8_t)(i + 1));
+	}
+	Vector2 start = { 3, 9 };
+	DrawHorizontalLine(start, screenWidth - 6, 90);
+	DrawVerticalLine(start, screenHeight - 18, 91);
+}
+
+static void DrawRectangles()
+{
+	for (int i = 0; i < 20; i++)
+	{
+		Rectangle rect = { i * 7, i * 5, screenWidth - i * 14 - 1, screenHeight - i * 10 - 1 };
+		DrawRectangle(rect, (uint8_t)(i + 100));
+	}
+}
+
+static void DrawCircles()
+{
+	Vector2 centre = { screenWidth / 3, screenHeight / 2 };
+	for (uint16_t radius = 4; radius < 90; radius += 9)
+	{
+		DrawCircle(centre, radius, (uint8_t)radius);
+	}
+	centre.x = screenWidth * 2 / 3;
+	FillCircle(centre, 60, 120);
+	FillEllipse(centre, 30, 80, 121);
+}
+
+static void DrawPolygons()
+{
+	uint16_t xPoints[] = { 20, 150, 60, 140, 10 };
+	uint16_t yPoints[] = { 30, 20, 180, 60, 110 };
+	DrawPolygon(xPoints, yPoints, 5, 60);
+	FillPolygonWithRule(xPoints, yPoints, 5, 61, FILL_EVEN_ODD);
+	for (int i = 0; i < 5; i++)
+	{
+		xPoints[i] += 150;
+	}
+	FillPolygonWithRule(xPoints, yPoints, 5, 62, FILL_NON_ZERO);
+}
+
+static void DrawGradients()
+{
+	Rectangle rect = { 10, 10, 120, 90 };
+	DrawGradientRectangle(rect, 232, 255, 240, 245);
+	rect.x = 151;
+	rect.y = 53;
+	DrawGradientRectangleWithDither(rect, 255, 232, 232, 255, 1);
+}
+
+static void DrawBlits()
+{
+	for (int i = 0; i < 8; i++)
+	{
+		Vector2 position = { (uint16_t)(i * 41 - 13), (uint16_t)(i * 23 - 7) };
+		BlitBitmap(&_sprite, position);
+		position.y += 40;
+		BlitBitmapKeyed(&_sprite, position, 0);
+		position.y += 40;
+		BlitRLESprite(&_rleSprite, position);
+		position.y += 40;
+		// Planar sprites are for plane mode only; the keyed blit gives the same picture
+		if (chain4)
+		{
+			BlitBitmapKeyed(&_sprite, position, 0);
+		}
+		else
+		{
+			BlitPlanarSpriteKeyed(&_planarSprite, position, 0);
+		}
+	}
+}
+
+static void DrawCopies()
+{
+	Rectangle rect = { 0, 0, 100, 60 };
+	FillRectangle(rect, 7);
+	DrawGradientRectangle(rect, 232, 255, 255, 232);
+	Rectangle source = { 3, 2, 90, 50 };
+	Vector2 destinations[] = { { 120, 10 }, { 121, 80 }, { 2, 1 }, { 50, 30 } };
+	for (int i = 0; i < 4; i++)
+	{
+		CopyRect(source, destinations[i]);
+	}
+}
+
+static void DrawText()
+{
+	for (uint16_t y = 0; y + 8 <= screenHeight; y += 24)
+	{
+		WriteText("The quick brown fox jumps over the lazy dog 0123456789", y / 3, y, (uint8_t)(y + 1));
+	}
+}
+
+static void DrawOpaqueText()
+{
+	FillCircle((Vector2){ screenWidth / 2, screenHeight / 2 }, 80, 120);
+	for (uint16_t y = 4; y + 16 <= screenHeight; y += 20)
+	{
+		WriteTextOpaque("Opaque text over a circle: 0123456789 !?", y / 4, y, (uint8_t)(y + 1), 232);
+	}
+}
+
+// The same few strings in the same colours every frame, as a status line or help text would be
+static void DrawStaticText()
+{
+	for (uint16_t y = 0; y + 16 <= screenHeight; y += 40)
+	{
+		WriteTextOpaque("f1 to f10 to change polygon", 5, y, 5, 0);
+		WriteTextOpaque("type below", 6, y + 20, 15, 1);
+	}
+}
+
+static void DrawMeshes()
+{
+	MeshInstance meshes[] =
+	{
+		{ .Mesh = _cube, .X = FIXED_FROM_INT(-90), .Z = FIXED_FROM_INT(250), .AngleX = 3000, .AngleY = 5000, .Colour = 40, .Style = MESH_SOLID },
+		{ .Mesh = _teapot, .X = FIXED_FROM_INT(40), .Z = FIXED_FROM_INT(250), .AngleX = 1500, .AngleY = 4000, .Colour = 222, .Style = MESH_SOLID },
+		{ .Mesh = _cube, .X = FIXED_FROM_INT(20), .Z = FIXED_FROM_INT(180), .AngleZ = 9000, .Colour = 255, .Style = MESH_WIREFRAME },
+	};
+	DrawUserScene(meshes, 3);
+}
+
+static const BenchScene _scenes[] =
+{
+	{ "ClearScreen", DrawClear },
+	{ "FillRectangle", DrawFill },
+	{ "Lines", DrawLines },
+	{ "Rectangles", DrawRectangles },
+	{ "Circles", DrawCircles },
+	{ "Polygons", DrawPolygons },
+	{ "Gradients", DrawGradients },
+	{ "Blits", DrawBlits },
+	{ "CopyRect", DrawCopies },
+	{ "Text", DrawText },
+	{ "OpaqueText", DrawOpaqueText },
+	{ "StaticText", DrawStaticText },
+	{ "Meshes", DrawMeshes },
+};
+
+static void CreateSprites()
+{
+	for (int y = 0; y < BENCH_SPRITE_SIZE; y++)
+	{
+		for (int x = 0; x < BENCH_SPRITE_SIZE; x++)
+		{
+			// A ring of colour with a transparent (0) centre and corners
+			int dx = x * 2 - BENCH_SPRITE_SIZE + 1;
+			int dy = y * 2 - BENCH_SPRITE_SIZE + 1;
+			int distance = dx * dx + dy * dy;
+			_spritePixels[y * BENCH_SPRITE_SIZE + x] = distance > 300 && distance < 900 ? (uint8_t)(x * 3 + y + 1) : 0;
+		}
+	}
+	CreateRLESprite(&_rleSprite, &_sprite, 0, _spriteStorage);
+	CreatePlanarSprite(&_planarSprite, &_sprite, _spriteStorage + GetRLESpriteSize(&_sprite, 0));
+}
+
+static uint8_t LoadMeshes()
+{
+	void * file = fopen("meshes.dat", "rb");
+	if (file == 0)
+	{
+		return 0;
+	}
+	uint32_t size = (uint32_t)fread(_meshFile, 1, sizeof(_meshFile), file);
+	fclose(file);
+	MeshFile_Load(_meshFile, size);
+	_cube = MeshFile_Find("CUBE");
+	_teapot = MeshFile_Find("TEAPOT");
+	return _cube != 0 && _teapot != 0;
+}
+
+static uint8_t LoadGoldenChecksums()
+{
+	void * file = fopen(BENCH_GOLDEN_FILE, "rb");
+	if (file == 0)
+	{
+		return 0;
+	}
+	uint32_t size = (uint32_t)fread(_golden, 1, sizeof(_golden) - 1, file);
+	fclose(file);
+	_golden[size] = 0;
+	return 1;
+}
+
+static const char * SkipSpaces(const char * p)
+{
+	while (*p == ' ' || *p == '\t')
+	{
+		p++;
+	}
+	return p;
+}
+
+static const char * ReadNumber(const char * p, uint32_t base, uint32_t * value)
+{
+	*value = 0;
+	for (;;)
+	{
+		uint32_t digit;
+		if (*p >= '0' && *p <= '9')
+		{
+			digit = *p - '0';
+		}
+		else if (base == 16 && *p >= 'a' && *p <= 'f')
+		{
+			digit = *p - 'a' + 10;
+		}
+		else
+		{
+			return p;
+		}
+		*value = *value * base + digit;
+		p++;
+	}
+}
+
+// Find the checksum for a mode and scene in the golden file, whose lines are as
+// drawbench -g prints them. Returns 0 if there is no line for them
+static uint8_t FindGoldenChecksum(const BenchMode * mode, const char * name, uint32_t * checksum)
+{
+	const char * tag = mode->Chain4 ? "c4" : (mode->BackBuffer ? "bb" : "mx");
+	const char * line = _golden;
+	while (*line)
+	{
+		uint32_t width, height;
+		const char * p = ReadNumber(SkipSpaces(line), 10, &width);
+		if (*p == 'x')
+		{
+			p = SkipSpaces(ReadNumber(p + 1, 10, &height));
+			if (width == mode->Width && height == mode->Height && p[0] == tag[0] && p[1] == tag[1])
+			{
+				p = SkipSpaces(p + 2);
+				uint32_t i = 0;
+				while (name[i] && p[i] == name[i])
+				{
+					i++;
+				}
+				if (name[i] == 0 && (p[i] == ' ' || p[i] == '\t'))
+				{
+					ReadNumber(SkipSpaces(p + i), 16, checksum);
+					return 1;
+				}
+			}
+		}
+		while (*line && *line != '\n')
+		{
+			line++;
+		}
+		if (*line)
+		{
+			line++;
+		}
+	}
+	return 0;
+}
+
+static void SetMode(const BenchMode * mode)
+{
+	HostVGA_Reset();
+	screenWidth = mode->Width;
+	screenHeight = mode->Height;
+	chain4 = mode->Chain4;
+	VGA_SetGraphicsMode(mode->Width, mode->Height, mode->Chain4);
+	_vgaMemory = VGA_GetPageAddress(0);
+	EnableBackBuffer(mode->BackBuffer);
+	ResetClipRectangle();
+}
+
+// FNV-1a hash of the page being displayed
+static uint32_t ScreenChecksum()
+{
+	uint32_t pageSize = (uint32_t)(VGA_GetPageAddress(1) - VGA_GetPageAddress(0));
+	uint8_t page = VGA_GetDisplayPage();
+	uint32_t hash = 2166136261u;
+	for (uint16_t y = 0; y < screenHeight; y++)
+	{
+		for (uint16_t x = 0; x < screenWidth; x++)
+		{
+			hash = (hash ^ HostVGA_GetPixel(screenWidth, x, y, page, pageSize)) * 16777619u;
+		}
+	}
+	return hash;
+}
+
+static void RunScene(const BenchScene * scene)
+{
+	ClearScreen(0);
+	scene->Draw();
+	Present();
+}
+
+int main(int argc, char ** argv)
+{
+	uint8_t check = argc > 1 && strcmp(argv[1], "-c") == 0;
+	uint8_t checksumsOnly = check || (argc > 1 && strcmp(argv[1], "-g") == 0);
+	uint32_t failures = 0;
+
+	CreateSprites();
+	if (!LoadMeshes())
+	{
+		printf("meshes.dat is missing or has no CUBE and TEAPOT; make meshes.dat first\n");
+		return 1;
+	}
+	if (check && !LoadGoldenChecksums())
+	{
+		printf("%s is missing; run drawbench from the src directory\n", BENCH_GOLDEN_FILE);
+		return 1;
+	}
+	if (!checksumsOnly)
+	{
+		printf("%-10s %-14s %10s %12s %12s\n", "Mode", "Primitive", "Checksum", "us/call", "Writes/call");
+	}
+	for (uint32_t m = 0; m < sizeof(_modes) / sizeof(_modes[0]); m++)
+	{
+		const BenchMode * mode = &_modes[m];
+		SetMode(mode);
+		for (uint32_t s = 0; s < sizeof(_scenes) / sizeof(_scenes[0]); s++)
+		{
+			const BenchScene * scene = &_scenes[s];
+			RunScene(scene);
+			uint32_t checksum = ScreenChecksum();
+			printf("%3ux%-3u %-2s %-14s %08x", mode->Width, mode->Height,
+				mode->Chain4 ? "c4" : (mode->BackBuffer ? "bb" : "mx"), scene->Name, checksum);
+			if (checksumsOnly)
+			{
+				uint32_t expected;
+				if (!check)
+				{
+					printf("\n");
+				}
+				else if (!FindGoldenChecksum(mode, scene->Name, &expected))
+				{
+					printf("  no golden checksum\n");
+					failures++;
+				}
+				else if (expected != checksum)
+				{
+					printf("  differs, expected %08x\n", expected);
+					failures++;
+				}
+				else
+				{
+					printf("  ok\n");
+				}
+				continue;
+			}
+			uint32_t writes = HostVGA_GetMemoryWrites();
+			long start = clock();
+			for (int i = 0; i < BENCH_ITERATIONS; i++)
+			{
+				RunScene(scene);
+			}
+			long elapsed = clock() - start;
+			writes = HostVGA_GetMemoryWrites() - writes;
+			printf(" %12ld %12u\n", elapsed / BENCH_ITERATIONS, writes / BENCH_ITERATIONS);
+		}
+		EnableBackBuffer(0);
+	}
+	if (check && failures)
+	{
+		printf("%u checksums differ from %s\n", failures, BENCH_GOLDEN_FILE);
+	}
+	else if (check)
+	{
+		printf("All checksums match %s\n", BENCH_GOLDEN_FILE);
+	}
+	return failures ? 1 : 0;
+}
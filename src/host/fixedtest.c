@@ -0,0 +1,123 @@
+//	Host check of fixed.c against the C library's double precision maths
+//
+//	Each function is compared over its input range with the error bound fixed.h
+//	gives for it. Errors are in units of 1/65536, the size of one fixed point step.
+//	Prints the worst error found for each function and exits with 1 if any is
+//	over its bound (make fixedcheck).
+
+#include <stdint.h>
+#include <fixed.h>
+#include "hostvga.h"
+
+// The kernel's math.h has float versions of these, so the library's are declared here
+double sin(double x);
+double cos(double x);
+double sqrt(double x);
+
+#define FIXED_TEST_PI	3.14159265358979323846
+
+typedef struct
+{
+	const char *	Name;
+	double			Bound;
+	double			Worst;
+	int32_t			WorstInput;
+} FixedTest;
+
+static double Magnitude(double x)
+{
+	return x < 0 ? -x : x;
+}
+
+static void Record(FixedTest * test, int32_t input, fixed result, double expected)
+{
+	double error = Magnitude((double)result - expected * FIXED_ONE);
+	if (error > test->Worst)
+	{
+		test->Worst = error;
+		test->WorstInput = input;
+	}
+}
+
+// Inputs from 1 to FIXED_MAX, every value at first and then spaced out further as they
+// grow, with about 1 << shift values for each doubling. Returns 0 after the last
+static int32_t NextInput(int32_t x, int shift)
+{
+	uint32_t step = (uint32_t)x >> shift;
+	uint32_t next = (uint32_t)x + (step ? step : 1);
+	return next > (uint32_t)FIXED_MAX ? 0 : (int32_t)next;
+}
+
+static uint8_t Report(const FixedTest * test)
+{
+	uint8_t passed = test->Worst <= test->Bound;
+	printf("%-16s worst %6.3f/65536 at %11d, bound %4.1f  %s\n", test->Name, test->Worst,
+		test->WorstInput, test->Bound, passed ? "ok" : "FAILED");
+	return passed;
+}
+
+int main()
+{
+	FixedTest sinTest = { "FixedSin", 2.0 };
+	FixedTest cosTest = { "FixedCos", 2.0 };
+	FixedTest reciprocalTest = { "FixedReciprocal", 1.0 };
+	FixedTest sqrtTest = { "FixedSqrt", 1.0 };
+	FixedTest divideTest = { "FixedDivide", 1.0 };
+	FixedTest multiplyTest = { "FixedMultiply", 1.0 };
+	uint32_t failures = 0;
+
+	for (uint32_t angle = 0; angle < FIXED_ANGLE_TURN; angle++)
+	{
+		double radians = angle * 2.0 * FIXED_TEST_PI / FIXED_ANGLE_TURN;
+		Record(&sinTest, angle, FixedSin((uint16_t)angle), sin(radians));
+		Record(&cosTest, angle, FixedCos((uint16_t)angle), cos(radians));
+	}
+
+	// Below 3/65536 the reciprocal does not fit and is saturated, which is checked separately
+	for (int32_t x = 3; x; x = NextInput(x, 12))
+	{
+		Record(&reciprocalTest, x, FixedReciprocal(x), (double)FIXED_ONE / x);
+		Record(&reciprocalTest, -x, FixedReciprocal(-x), -(double)FIXED_ONE / x);
+		Record(&sqrtTest, x, FixedSqrt(x), sqrt((double)x / FIXED_ONE));
+	}
+	if (FixedReciprocal(1) != FIXED_MAX || FixedReciprocal(-2) != FIXED_MIN || FixedSqrt(-FIXED_ONE) != 0)
+	{
+		printf("FixedReciprocal or FixedSqrt out of range inputs are not saturated\n");
+		failures++;
+	}
+
+	// Quotients and products that fit, from small to large, of both signs
+	for (int32_t a = 1; a; a = NextInput(a, 7))
+	{
+		for (int32_t b = 1; b; b = NextInput(b, 7))
+		{
+			double quotient = (double)a / b;
+			double product = (double)a * b / FIXED_ONE / FIXED_ONE;
+			if (quotient * FIXED_ONE < FIXED_MAX)
+			{
+				Record(&divideTest, a, FixedDivide(a, b), quotient);
+				Record(&divideTest, a, FixedDivide(-a, b), -quotient);
+				Record(&divideTest, a, FixedDivide(a, -b), -quotient);
+			}
+			if (product * FIXED_ONE < FIXED_MAX)
+			{
+				Record(&multiplyTest, a, FixedMultiply(a, b), product);
+				Record(&multiplyTest, a, FixedMultiply(-a, b), -product);
+			}
+		}
+	}
+	if (FixedDivide(FIXED_ONE, 0) != FIXED_MAX || FixedDivide(-FIXED_ONE, 0) != FIXED_MIN ||
+		FixedDivide(FIXED_MAX, 1) != FIXED_MAX || FixedDivide(FIXED_MAX, -1) != FIXED_MIN)
+	{
+		printf("FixedDivide quotients that do not fit are not saturated\n");
+		failures++;
+	}
+
+	failures += !Report(&sinTest);
+	failures += !Report(&cosTest);
+	failures += !Report(&reciprocalTest);
+	failures += !Report(&sqrtTest);
+	failures += !Report(&divideTest);
+	failures += !Report(&multiplyTest);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,135 @@
+//	Builds font.c, the packed text font, from a 1 bit image of the glyphs
+//
+//	fontconv font.pbm font.c
+//
+//	The image is a PBM (plain P1 or raw P4) holding the glyphs for ASCII 32 to
+//	126 side by side, FONT_WIDTH pixels apart and FONT_HEIGHT high. Each line
+//	of a glyph is stored as a 16 bit mask with the leftmost pixel in bit 0, so
+//	the drawing code can find the lit pixels with a bit scan.
+//
+//	This is an ordinary host program, built with the system headers.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+
+#include "../include/font.h"
+
+static int ReadNumber(FILE * file)
+{
+	int c = fgetc(file);
+	int value = 0;
+	// Skip white space and comments
+	while (c != EOF && (isspace(c) || c == '#'))
+	{
+		if (c == '#')
+		{
+			while (c != EOF && c != '\n')
+			{
+				c = fgetc(file);
+			}
+		}
+		c = fgetc(file);
+	}
+	if (!isdigit(c))
+	{
+		return -1;
+	}
+	while (isdigit(c))
+	{
+		value = value * 10 + c - '0';
+		c = fgetc(file);
+	}
+	return value;
+}
+
+// 1 for a black (lit) pixel. Plain images are read a digit at a time, raw ones a bit at a time
+static int ReadPixel(FILE * file, int raw, int x, int * byte)
+{
+	if (!raw)
+	{
+		int c = fgetc(file);
+		while (c != EOF && c != '0' && c != '1')
+		{
+			c = fgetc(file);
+		}
+		return c == '1';
+	}
+	if (x % 8 == 0)
+	{
+		*byte = fgetc(file);
+	}
+	return (*byte >> (7 - x % 8)) & 1;
+}
+
+int main(int argc, char ** argv)
+{
+	static uint16_t glyphs[FONT_GLYPH_COUNT][FONT_HEIGHT];
+	char magic[2];
+	int byte = 0;
+
+	if (argc != 3)
+	{
+		fprintf(stderr, "usage: fontconv font.pbm font.c\n");
+		return 1;
+	}
+	FILE * image = fopen(argv[1], "rb");
+	if (image == NULL || fread(magic, 1, 2, image) != 2 || magic[0] != 'P' || (magic[1] != '1' && magic[1] != '4'))
+	{
+		fprintf(stderr, "fontconv: %s is not a PBM image\n", argv[1]);
+		return 1;
+	}
+	int raw = magic[1] == '4';
+	int width = ReadNumber(image);
+	int height = ReadNumber(image);
+	if (width < FONT_GLYPH_COUNT * FONT_WIDTH || height != FONT_HEIGHT)
+	{
+		fprintf(stderr, "fontconv: %s must be at least %d by exactly %d pixels\n", argv[1],
+				FONT_GLYPH_COUNT * FONT_WIDTH, FONT_HEIGHT);
+		return 1;
+	}
+	for (int y = 0; y < height; y++)
+	{
+		for (int x = 0; x < width; x++)
+		{
+			int glyph = x / FONT_WIDTH;
+			if (ReadPixel(image, raw, x, &byte) && glyph < FONT_GLYPH_COUNT)
+			{
+				glyphs[glyph][y] |= (uint16_t)(1 << (x % FONT_WIDTH));
+			}
+		}
+	}
+	fclose(image);
+
+	FILE * source = fopen(argv[2], "w");
+	if (source == NULL)
+	{
+		fprintf(stderr, "fontconv: cannot create %s\n", argv[2]);
+		return 1;
+	}
+	fprintf(source, "//Text font: one 16 bit mask per line of each glyph, leftmost pixel in bit 0.\n");
+	fprintf(source, "//Made from fonts/font9x16.pbm by host/fontconv.c (make font); edit the image, not this file\n\n");
+	fprintf(source, "#include <stdint.h>\n#include <font.h>\n\n");
+	fprintf(source, "const uint16_t FontGlyphs[FONT_GLYPH_COUNT][FONT_HEIGHT] = {\n");
+	for (int glyph = 0; glyph < FONT_GLYPH_COUNT; glyph++)
+	{
+		int c = FONT_FIRST + glyph;
+		fprintf(source, "    { ");
+		for (int y = 0; y < FONT_HEIGHT; y++)
+		{
+			fprintf(source, "0x%03x%s", glyphs[glyph][y], y + 1 < FONT_HEIGHT ? ", " : "");
+		}
+		if (c == ' ')
+		{
+			fprintf(source, " }, //space\n");
+		}
+		else
+		{
+			// Quoted, so a backslash doesn't continue the comment onto the next line
+			fprintf(source, " }, //'%c'\n", c);
+		}
+	}
+	fprintf(source, "};\n");
+	fclose(source);
+	return 0;
+}
@@ -0,0 +1,240 @@
+//	Emulated VGA and kernel services for building the drawing code on the host
+//
+//	Built only with HOST_FRAMEBUFFER (see the drawbench target in the makefile).
+//	The 4 planes, the latches and the registers the drawing code relies on are
+//	modelled: the sequencer map mask and memory mode (chain4), and the graphics
+//	controller read map select and write mode. Write modes 2 and 3, set/reset,
+//	the bit mask and data rotate are not used by the drawing code and are not
+//	modelled. In chain4 mode the window is plain linear memory.
+//
+//	Port writes arrive through HAL_OutputByteToPort, exactly as they would on
+//	the hardware, so the shadowed register code in vgamodes.c is exercised too.
+
+#include <stdint.h>
+#include <hal.h>
+#include <vgamemory.h>
+#include "../physicalmemorymanager.h"
+#include "hostvga.h"
+
+#define HOST_VGA_SIZE		65536L
+
+#define SEQ_MAP_MASK		2
+#define SEQ_MEMORY_MODE		4
+#define SEQ_CHAIN4			0x08
+#define GC_READ_MAP			4
+#define GC_MODE				5
+
+static uint8_t	_window[HOST_VGA_SIZE];
+static uint8_t	_planes[4][HOST_VGA_SIZE];
+static uint8_t	_latches[4];
+static uint8_t	_palette[256][3];
+
+static uint8_t	_seqIndex;
+static uint8_t	_seqRegisters[8] = { 0, 0, 0x0f, 0, 0x0e };
+static uint8_t	_gcIndex;
+static uint8_t	_gcRegisters[16];
+static uint8_t	_dacIndex;
+static uint8_t	_dacComponent;
+static uint8_t	_dacReadIndex;
+static uint8_t	_dacReadComponent;
+static uint8_t	_retrace;
+
+static uint32_t	_portWrites;
+static uint32_t	_memoryWrites;
+
+uint8_t * HostVGA_GetWindow()
+{
+	return _window;
+}
+
+static uint32_t HostVGAOffset(const volatile uint8_t * address)
+{
+	return (uint32_t)(address - _window) & (HOST_VGA_SIZE - 1);
+}
+
+uint8_t HostVGA_Read(const volatile uint8_t * address)
+{
+	uint32_t offset = HostVGAOffset(address);
+	if (_seqRegisters[SEQ_MEMORY_MODE] & SEQ_CHAIN4)
+	{
+		return _window[offset];
+	}
+	for (int plane = 0; plane < 4; plane++)
+	{
+		_latches[plane] = _planes[plane][offset];
+	}
+	return _latches[_gcRegisters[GC_READ_MAP] & 3];
+}
+
+void HostVGA_Write(volatile uint8_t * address, uint8_t value)
+{
+	uint32_t offset = HostVGAOffset(address);
+	uint8_t mask = _seqRegisters[SEQ_MAP_MASK];
+	_memoryWrites++;
+	if (_seqRegisters[SEQ_MEMORY_MODE] & SEQ_CHAIN4)
+	{
+		_window[offset] = value;
+		return;
+	}
+	for (int plane = 0; plane < 4; plane++)
+	{
+		if (mask & (1 << plane))
+		{
+			// Write mode 1 stores the latches and ignores the value written
+			_planes[plane][offset] = (_gcRegisters[GC_MODE] & 3) == 1 ? _latches[plane] : value;
+		}
+	}
+}
+
+void HostVGA_CopyTo(volatile uint8_t * destination, const uint8_t * source, uint32_t count)
+{
+	while (count--)
+	{
+		HostVGA_Write(destination++, *source++);
+	}
+}
+
+void HAL_OutputByteToPort(uint16_t portid, uint8_t value)
+{
+	_portWrites++;
+	switch (portid)
+	{
+		case 0x3c4:
+			_seqIndex = value & 7;
+			break;
+
+		case 0x3c5:
+			_seqRegisters[_seqIndex] = value;
+			break;
+
+		case 0x3ce:
+			_gcIndex = value & 15;
+			break;
+
+		case 0x3cf:
+			_gcRegisters[_gcIndex] = value;
+			break;
+
+		case 0x3c7:
+			_dacReadIndex = value;
+			_dacReadComponent = 0;
+			break;
+
+		case 0x3c8:
+			_dacIndex = value;
+			_dacComponent = 0;
+			break;
+
+		case 0x3c9:
+			_palette[_dacIndex][_dacComponent] = value & 0x3f;
+			if (++_dacComponent == 3)
+			{
+				_dacComponent = 0;
+				_dacIndex++;
+			}
+			break;
+	}
+}
+
+uint8_t HAL_InputByteFromPort(uint16_t portid)
+{
+	uint8_t value;
+	switch (portid)
+	{
+		case 0x3da:
+			// Alternate in and out of vertical retrace so that waits for it finish
+			_retrace ^= 0x08;
+			return _retrace;
+
+		case 0x3c9:
+			value = _palette[_dacReadIndex][_dacReadComponent];
+			if (++_dacReadComponent == 3)
+			{
+				_dacReadComponent = 0;
+				_dacReadIndex++;
+			}
+			return value;
+	}
+	return 0;
+}
+
+uint8_t HostVGA_GetPixel(uint16_t width, uint16_t x, uint16_t y, uint8_t page, uint32_t pageSize)
+{
+	uint32_t offset = pageSize * page;
+	if (_seqRegisters[SEQ_MEMORY_MODE] & SEQ_CHAIN4)
+	{
+		return _window[(offset + (uint32_t)y * width + x) & (HOST_VGA_SIZE - 1)];
+	}
+	return _planes[x & 3][(offset + ((uint32_t)y * width + x) / 4) & (HOST_VGA_SIZE - 1)];
+}
+
+void HostVGA_GetPaletteEntry(uint8_t index, uint8_t * rgb)
+{
+	rgb[0] = _palette[index][0];
+	rgb[1] = _palette[index][1];
+	rgb[2] = _palette[index][2];
+}
+
+void HostVGA_Reset()
+{
+	for (uint32_t i = 0; i < HOST_VGA_SIZE; i++)
+	{
+		_window[i] = 0;
+		_planes[0][i] = 0;
+		_planes[1][i] = 0;
+		_planes[2][i] = 0;
+		_planes[3][i] = 0;
+	}
+	_portWrites = 0;
+	_memoryWrites = 0;
+}
+
+uint32_t HostVGA_GetPortWrites()
+{
+	return _portWrites;
+}
+
+uint32_t HostVGA_GetMemoryWrites()
+{
+	return _memoryWrites;
+}
+
+// Kernel services the drawing code uses
+
+uint32_t HAL_GetTickCount()
+{
+	// 100Hz, like the PIT
+	return (uint32_t)(clock() / (HOST_CLOCKS_PER_SECOND / 100));
+}
+
+uint64_t HAL_ReadTimeStampCounter()
+{
+	uint32_t low;
+	uint32_t high;
+
+	asm volatile ("rdtsc" : "=a"(low), "=d"(high));
+	return ((uint64_t)high << 32) | low;
+}
+
+void HAL_EnableInterrupts()
+{
+}
+
+void HAL_DisableInterrupts()
+{
+}
+
+uint32_t PMM_GetBlockSize()
+{
+	return 4096;
+}
+
+void * PMM_AllocateBlocks(size_t size)
+{
+	return malloc(size * PMM_GetBlockSize());
+}
+
+void PMM_FreeBlocks(void * p, size_t size)
+{
+	free(p);
+}
@@ -0,0 +1,46 @@
+#ifndef _HOSTVGA_H
+#define _HOSTVGA_H
+#include <stdint.h>
+#include <size_t.h>
+
+// Emulated VGA used by the host build of the drawing code (HOST_FRAMEBUFFER).
+// The memory access side is declared in vgamemory.h.
+
+// Clear VGA memory and the write counters
+void HostVGA_Reset();
+
+// Read back a displayed pixel from the emulated memory, in either chain4 or plane mode
+uint8_t HostVGA_GetPixel(uint16_t width, uint16_t x, uint16_t y, uint8_t page, uint32_t pageSize);
+
+// Red, green and blue (0-63) last written to the DAC for a palette index
+void HostVGA_GetPaletteEntry(uint8_t index, uint8_t * rgb);
+
+// Port writes and plane mode memory writes since the last reset
+uint32_t HostVGA_GetPortWrites();
+
+uint32_t HostVGA_GetMemoryWrites();
+
+// The kernel headers stand in for the standard ones in the host build, so the few
+// C library functions it uses are declared here rather than included
+
+#define HOST_CLOCKS_PER_SECOND	1000000L
+
+void * malloc(size_t size);
+
+void free(void * p);
+
+int printf(const char * format, ...);
+
+long clock(void);
+
+int strcmp(const char * first, const char * second);
+
+// The FILE pointers of these are only passed back to the library, so void * stands in for them
+
+void * fopen(const char * path, const char * mode);
+
+size_t fread(void * buffer, size_t size, size_t count, void * file);
+
+int fclose(void * file);
+
+#endif
@@ -0,0 +1,200 @@
+//	Builds the mesh file the kernel loads from the boot disk (see meshfile.h)
+//
+//	meshconv output.dat model.obj [model.obj ...]
+//
+//	Each model is a Wavefront .obj file; only the v and f lines are used, and
+//	faces with more than 3 corners are split into a fan of triangles. Faces must
+//	be anticlockwise seen from outside, which is the .obj convention. A mesh is
+//	named after its file, upper case and without the directory or extension, so
+//	models/teapot.obj becomes TEAPOT.
+//
+//	Positions are quantised to the finest step of 1 / 2^Shift units that keeps
+//	every coordinate within 16 bits.
+//
+//	This is an ordinary host program, built with the system headers. The file
+//	is written in the host's byte order, so build it on a little endian machine
+//	such as an x86 PC.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+
+#define MESHFILE_FORMAT_ONLY
+#include "../include/meshfile.h"
+
+#define MAX_VERTICES	1024
+#define MAX_FACES		8192
+#define MAX_SHIFT		16
+
+typedef struct
+{
+	char		Name[MESHFILE_NAME_LENGTH];
+	int			VertexCount;
+	int			FaceCount;
+	double		X[MAX_VERTICES];
+	double		Y[MAX_VERTICES];
+	double		Z[MAX_VERTICES];
+	uint16_t	Faces[MAX_FACES * 3];
+} Model;
+
+static Model _model;
+
+static void MeshName(const char * path, char * name)
+{
+	const char * start = strrchr(path, '/');
+	start = start ? start + 1 : path;
+	memset(name, 0, MESHFILE_NAME_LENGTH);
+	for (int i = 0; i < MESHFILE_NAME_LENGTH && start[i] != 0 && start[i] != '.'; i++)
+	{
+		name[i] = (char)toupper((unsigned char)start[i]);
+	}
+}
+
+// An .obj index: 1 based, or negative to count back from the last vertex. Texture and normal indexes after a / are ignored
+static int ObjIndex(const char * token, int vertexCount)
+{
+	int index = atoi(token);
+	return index < 0 ? vertexCount + index : index - 1;
+}
+
+static int ReadObj(const char * path, Model * model)
+{
+	char line[1024];
+	FILE * file = fopen(path, "r");
+	if (file == NULL)
+	{
+		fprintf(stderr, "meshconv: cannot open %s\n", path);
+		return 0;
+	}
+	MeshName(path, model->Name);
+	model->VertexCount = 0;
+	model->FaceCount = 0;
+	while (fgets(line, sizeof(line), file))
+	{
+		if (line[0] == 'v' && line[1] == ' ')
+		{
+			if (model->VertexCount == MAX_VERTICES)
+			{
+				fprintf(stderr, "meshconv: %s has more than %d vertices\n", path, MAX_VERTICES);
+				fclose(file);
+				return 0;
+			}
+			int v = model->VertexCount++;
+			sscanf(line + 2, "%lf %lf %lf", &model->X[v], &model->Y[v], &model->Z[v]);
+		}
+		else if (line[0] == 'f' && line[1] == ' ')
+		{
+			int corners[64];
+			int count = 0;
+			for (char * token = strtok(line + 2, " \t\r\n"); token != NULL && count < 64; token = strtok(NULL, " \t\r\n"))
+			{
+				corners[count++] = ObjIndex(token, model->VertexCount);
+			}
+			for (int i = 2; i < count; i++)
+			{
+				if (model->FaceCount == MAX_FACES)
+				{
+					fprintf(stderr, "meshconv: %s has more than %d faces\n", path, MAX_FACES);
+					fclose(file);
+					return 0;
+				}
+				uint16_t * face = &model->Faces[model->FaceCount++ * 3];
+				face[0] = (uint16_t)corners[0];
+				face[1] = (uint16_t)corners[i - 1];
+				face[2] = (uint16_t)corners[i];
+			}
+		}
+	}
+	fclose(file);
+	for (int i = 0; i < model->FaceCount * 3; i++)
+	{
+		if (model->Faces[i] >= model->VertexCount)
+		{
+			fprintf(stderr, "meshconv: %s has a face using a vertex it does not have\n", path);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static void WriteMesh(FILE * file, const Model * model)
+{
+	MeshFileRecord record;
+	double largest = 0;
+	double radius = 0;
+	int shift = MAX_SHIFT;
+
+	for (int v = 0; v < model->VertexCount; v++)
+	{
+		double length = sqrt(model->X[v] * model->X[v] + model->Y[v] * model->Y[v] + model->Z[v] * model->Z[v]);
+		largest = fmax(largest, fmax(fabs(model->X[v]), fmax(fabs(model->Y[v]), fabs(model->Z[v]))));
+		radius = fmax(radius, length);
+	}
+	while (shift > 0 && floor(largest * (1 << shift) + 0.5) > 32767)
+	{
+		shift--;
+	}
+
+	memset(&record, 0, sizeof(record));
+	memcpy(record.Name, model->Name, MESHFILE_NAME_LENGTH);
+	record.VertexCount = (uint16_t)model->VertexCount;
+	record.FaceCount = (uint16_t)model->FaceCount;
+	record.Shift = (uint8_t)shift;
+	// Rounded up, and a step larger so that rounding the positions can't take a vertex outside it
+	record.Radius = (int32_t)ceil((radius + 1.0 / (1 << shift)) * 65536);
+	uint32_t size = sizeof(record) + model->VertexCount * 6 + model->FaceCount * 6;
+	record.Size = (size + 3) & ~3u;
+	fwrite(&record, sizeof(record), 1, file);
+
+	const double * axes[3] = { model->X, model->Y, model->Z };
+	for (int axis = 0; axis < 3; axis++)
+	{
+		for (int v = 0; v < model->VertexCount; v++)
+		{
+			int16_t position = (int16_t)floor(axes[axis][v] * (1 << shift) + 0.5);
+			fwrite(&position, sizeof(position), 1, file);
+		}
+	}
+	fwrite(model->Faces, sizeof(uint16_t), model->FaceCount * 3, file);
+	for (uint32_t i = size; i < record.Size; i++)
+	{
+		fputc(0, file);
+	}
+	printf("%-8.8s %5d vertices %5d faces, steps of 1/%d, radius %.2f\n", model->Name, model->VertexCount,
+		   model->FaceCount, 1 << shift, record.Radius / 65536.0);
+}
+
+int main(int argc, char ** argv)
+{
+	MeshFileHeader header;
+
+	if (argc < 3 || argc - 2 > MESHFILE_MAX_MESHES)
+	{
+		fprintf(stderr, "usage: meshconv output.dat model.obj [model.obj ...] (at most %d models)\n", MESHFILE_MAX_MESHES);
+		return 1;
+	}
+	FILE * file = fopen(argv[1], "wb");
+	if (file == NULL)
+	{
+		fprintf(stderr, "meshconv: cannot create %s\n", argv[1]);
+		return 1;
+	}
+	header.Magic = MESHFILE_MAGIC;
+	header.MeshCount = (uint16_t)(argc - 2);
+	header.Reserved = 0;
+	fwrite(&header, sizeof(header), 1, file);
+	for (int i = 2; i < argc; i++)
+	{
+		if (!ReadObj(argv[i], &_model))
+		{
+			fclose(file);
+			remove(argv[1]);
+			return 1;
+		}
+		WriteMesh(file, &_model);
+	}
+	fclose(file);
+	return 0;
+}
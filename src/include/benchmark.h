@@ -0,0 +1,85 @@
+#ifndef _BENCHMARK_H
+#define _BENCHMARK_H
+#include <stdint.h>
+#include <draw.h>
+
+// Number of times each primitive is drawn when it is timed
+#define BENCHMARK_ITERATIONS 20
+
+// Tick counts (PIT at 100Hz) for BENCHMARK_ITERATIONS full-screen fills
+// in the current graphics mode. The reference mode is 400x600 plane mode.
+typedef struct _SpanFillBenchmark
+{
+	uint32_t	ClearScreenTicks;
+	uint32_t	FillRectangleTicks;
+	uint32_t	FillCircleTicks;
+} SpanFillBenchmark;
+
+// Time the span fill paths used by ClearScreen, FillRectangle and FillCircle.
+// Overwrites the whole screen.
+void Benchmark_SpanFill(SpanFillBenchmark * results);
+
+// Number of radii the filled circle and ellipse are checked at
+#define BENCHMARK_RADII 4
+
+// Pixel writes against distinct pixels covered for filled circles and
+// ellipses (radiusX = radius, radiusY = radius / 2) at several radii.
+// Writes equal to pixels means nothing was drawn twice.
+typedef struct _CircleFillBenchmark
+{
+	uint16_t	Radius[BENCHMARK_RADII];
+	uint32_t	CircleWrites[BENCHMARK_RADII];
+	uint32_t	CirclePixels[BENCHMARK_RADII];
+	uint32_t	EllipseWrites[BENCHMARK_RADII];
+	uint32_t	EllipsePixels[BENCHMARK_RADII];
+} CircleFillBenchmark;
+
+// Fill circles and ellipses of increasing radius and count how many pixel
+// writes each one takes. Overwrites the whole screen.
+void Benchmark_CircleFill(CircleFillBenchmark * results);
+
+// Size of the sprite used to time the blitter
+#define BENCHMARK_SPRITE_SIZE 64
+
+// Pixels written and ticks taken to tile the screen with a sprite
+// BENCHMARK_ITERATIONS times in each BLIT_ mode. The sprite is a disc on a
+// transparent background, so the keyed modes write about 80% of its pixels.
+typedef struct _BlitBenchmark
+{
+	uint32_t	Pixels[BLIT_MODES];
+	uint32_t	Ticks[BLIT_MODES];
+	uint32_t	PixelsPerTick[BLIT_MODES];
+} BlitBenchmark;
+
+// Time each blit mode. Overwrites the whole screen.
+void Benchmark_Blit(BlitBenchmark * results);
+
+// Number of calls each maths routine is timed over
+#define BENCHMARK_MATHS_CALLS 4096
+
+// Time stamp counter cycles per call, loop included, of the float maths in math.c and
+// the 16.16 fixed point versions in fixed.c
+typedef struct _FixedBenchmark
+{
+	uint32_t	FloatSinCycles;
+	uint32_t	FixedSinCycles;
+	uint32_t	FloatDivideCycles;
+	uint32_t	FixedDivideCycles;
+	uint32_t	FixedReciprocalCycles;
+	uint32_t	FixedSqrtCycles;
+} FixedBenchmark;
+
+void Benchmark_Fixed(FixedBenchmark * results);
+
+// Number of times each primitive is drawn per mode by Benchmark_AllModes
+#define BENCHMARK_MODE_ITERATIONS 8
+
+// Switch through every screen mode VGA_SetGraphicsMode supports, chain4 and
+// plane mode, timing ClearScreen, lines of several slopes, rectangles,
+// circles, polygons and text in each. Ticks (PIT) for all iterations and time
+// stamp counter cycles per primitive are written as a table to the first
+// serial port. The original mode is restored and cleared afterwards, with the
+// back buffer and page flipping turned off.
+void Benchmark_AllModes();
+
+#endif
@@ -7,15 +7,13 @@
 
 void ConsoleWriteCharacter(unsigned char c); 
 
-// Write the null-terminated string str to the current cursor position on the screen
+// Write the null-terminated string str to the current cursor position on the screen.
+// The hardware cursor is moved once, at the end, and line feeds that run off the bottom
+// of the screen are scrolled in together
 
 void ConsoleWriteString(char* str); 
 
-// Write the unsigned integer to the screen, using the specified base, e.g. for
-// the number to be displayed as a decimal number, you would specify base 10.  For 
-// a number to be displayed as hexadecimal, you would specify base 16.
-
-void ConsoleWriteInt(unsigned int i, unsigned int base); 
+// Numbers and other formatted output are written with kprintf (see kprintf.h)
 
 // Set the attribute to be used for all subsequent calls to ConsoleWriteXXXX routines
 
@@ -43,4 +41,12 @@ int ConsoleGetHeight();
 
 void ConsoleClearScreen(const uint8_t c); 
 
+// Scroll the view back through the lines that have gone off the top of the screen
+// (lines > 0) or forward again (lines < 0). The next output returns the view to the
+// bottom. Returns false once a graphics mode has been set, as there is nothing to show.
+// Safe to call from an interrupt handler: if it interrupts output, the view moves
+// once the output has finished with the display
+
+bool ConsoleScrollView(int lines);
+
 #endif
\ No newline at end of file
@@ -1,8 +1,22 @@
+#ifndef _DRAW_H
+#define _DRAW_H
 #include <stdint.h>
 
 #define CONSOLE_HEIGHT 25
 #define CONSOLE_WIDTH 80
 
+//Polygon fill rules
+#define FILL_EVEN_ODD 0
+#define FILL_NON_ZERO 1
+
+//Blit modes used with the blit system call
+#define BLIT_OPAQUE 0
+#define BLIT_KEYED 1
+#define BLIT_RLE 2
+#define BLIT_PLANAR 3
+#define BLIT_PLANAR_KEYED 4
+#define BLIT_MODES 5
+
 uint16_t screenWidth;
 uint16_t screenHeight;
 
@@ -22,8 +36,99 @@ typedef struct {
     unsigned int height;
 } Rectangle;
 
+//An 8bpp image in system memory, rows packed one after another
+typedef struct {
+    uint16_t Width;
+    uint16_t Height;
+    uint8_t* Pixels;
+} Bitmap;
+
+//A colour keyed bitmap stored as runs of opaque pixels, so transparent pixels cost nothing to draw.
+//RowOffsets gives where each row's runs start in Runs
+typedef struct {
+    uint16_t Width;
+    uint16_t Height;
+    uint32_t* RowOffsets;
+    uint8_t* Runs;
+} RLESprite;
+
+//A bitmap split into 4 column groups (column & 3) for plane mode. Each group lands in a single
+//plane wherever the sprite is drawn, so it is copied with one map mask write
+typedef struct {
+    uint16_t Width;
+    uint16_t Height;
+    uint16_t GroupWidth[4];
+    uint8_t* Groups[4];
+} PlanarSprite;
+
+//A run of pixels on one row
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t length;
+} Span;
+
+//Present latency counters. Each flip waits for vertical retrace; the time spent waiting is
+//measured both in time stamp counter cycles (in units of 1024) and in polls of the VGA status register.
+//Present runs with interrupts off, so the tick count does not move while it waits
+typedef struct {
+    uint32_t Flips;
+    uint32_t RetraceWaits;
+    uint32_t RetraceWaitKilocycles;
+    uint32_t RetracePolls;
+} PresentStatistics;
+
 void SetPixel(uint16_t x, uint16_t y, const uint8_t colour);
 
+//Limit drawing to a rectangle, e.g. to keep a UI panel's contents inside it. Lines, spans and
+//polygons are clipped to it and anything entirely outside it costs next to nothing.
+//ClearScreen ignores it
+void SetClipRectangle(Rectangle clip);
+
+void SetUserClipRectangle(uint32_t start, uint32_t size);
+
+//Allow drawing anywhere on the screen again
+void ResetClipRectangle();
+
+//Collect the pixels drawn until the matching EndPixelBatch and, in plane mode, write them a plane
+//at a time so the map mask is set at most 4 times. Lines, circle and polygon outlines batch themselves
+void BeginPixelBatch(uint8_t colour);
+
+void EndPixelBatch();
+
+//Read back a pixel from whichever buffer is being drawn to
+uint8_t GetPixel(uint16_t x, uint16_t y);
+
+//Total pixels written by the drawing primitives so far. Used by the benchmarks to measure overdraw
+uint32_t GetPixelWriteCount();
+
+//Select which of the 4 planes are written to in plane (non chain4) mode. Bit n enables plane n
+void SetMapMask(uint8_t mask);
+
+//Fill a rectangle in plane mode, setting the map mask once per column group rather than once per pixel
+void FillPlanarRectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t colour);
+
+//Draw into a linear back buffer in RAM (1) or straight into VGA memory (0). Returns 1 if the back buffer is in use
+uint8_t EnableBackBuffer(uint8_t enable);
+
+//1 if drawing goes to the back buffer, so that it can be put back after drawing straight to VGA memory
+uint8_t GetBackBufferEnabled();
+
+//Record a changed region of the back buffer. Does nothing when drawing straight to VGA memory
+void MarkDirty(int x, int y, int width, int height);
+
+//Copy the changed regions of the back buffer to VGA memory (a plane at a time in plane mode).
+//With page flipping, the page drawn into is then displayed and drawing moves to the next page
+void Present();
+
+//Draw into a hidden page and show it with Present (plane mode only). Returns 1 if page flipping is in use
+uint8_t EnablePageFlipping(uint8_t enable);
+
+//1 if page flipping is in use
+uint8_t GetPageFlippingEnabled();
+
+void GetPresentStatistics(PresentStatistics* stats);
+
 void DrawUserLine(uint32_t start, uint32_t end, uint8_t colour);
 
 void DrawLine(Vector2 start, Vector2 end, uint8_t colour);
@@ -32,6 +137,10 @@ void DrawUserHorizontalLine(uint32_t start, uint16_t length, uint8_t colour);
 
 void DrawHorizontalLine(Vector2 start, uint16_t length, uint8_t colour);
 
+//Fill many runs in one colour, e.g. the lit runs of a line of text, clipped and marked dirty as one
+//block. Plane mode writes them a plane at a time, so the whole set costs at most 4 map mask writes
+void FillSpans(const Span* spans, uint16_t count, uint8_t colour);
+
 void DrawUserVerticalLine(uint32_t start, uint16_t length, uint8_t colour);
 
 void DrawVerticalLine(Vector2 start, uint16_t length, uint8_t colour);
@@ -44,9 +153,15 @@ void FillUserRectangle(uint32_t start, uint32_t size, uint8_t colour);
 
 void FillRectangle(Rectangle rect, uint8_t colour);
 
-//calculated distance from each corner, weights based on distance and colour
+//Blend between four corner colours. The colours are palette indexes and are interpolated as
+//numbers, so they should come from one ramp of the palette, e.g. the greys from 232 to 255
 void DrawGradientRectangle(Rectangle rect, unsigned int ColTL, unsigned int ColTR, unsigned int ColBL, unsigned int ColBR);
 
+//As DrawGradientRectangle, with ordered dithering between neighbouring indexes when dither is 1
+void DrawGradientRectangleWithDither(Rectangle rect, unsigned int ColTL, unsigned int ColTR, unsigned int ColBL, unsigned int ColBR, uint8_t dither);
+
+void DrawUserGradientRectangle(uint32_t start, uint32_t size, uint32_t corners);
+
 void ClearScreen(uint8_t colour);
 
 void DrawUserCircle(uint32_t centre, uint16_t radius, uint8_t colour);
@@ -57,6 +172,11 @@ void FillUserCircle(uint32_t centre, uint16_t radius, uint8_t colour);
 
 void FillCircle(Vector2 centre, uint16_t radius, uint8_t colour);
 
+void FillUserEllipse(uint32_t centre, uint32_t radii, uint8_t colour);
+
+//Draws a filled ellipse, one span per row
+void FillEllipse(Vector2 centre, uint16_t radiusX, uint16_t radiusY, uint8_t colour);
+
 void DrawUserPolygon(uint16_t xPoints[], uint16_t yPoints[], uint32_t sizeCol);
 
 void DrawPolygon(uint16_t xPoints[], uint16_t yPoints[], uint16_t sides, uint8_t colour);
@@ -65,4 +185,49 @@ void FillUserPolygon(uint16_t xPoints[], uint16_t yPoints[], uint32_t sizeCol);
 
 void FillPolygon(uint16_t xPoints[], uint16_t yPoints[], uint16_t sides, uint8_t colour);
 
-Vector2 Reverse32BitMergeVector2(uint32_t a);
\ No newline at end of file
+//Fill a polygon with any number of vertices using either the even-odd or the non-zero winding rule
+void FillPolygonWithRule(uint16_t xPoints[], uint16_t yPoints[], uint16_t sides, uint8_t colour, uint8_t rule);
+
+//Copy a bitmap to the screen. Positions are signed, so sprites can be partly off any edge
+void BlitBitmap(const Bitmap* bitmap, Vector2 position);
+
+//Copy a bitmap to the screen, leaving pixels of the key colour untouched
+void BlitBitmapKeyed(const Bitmap* bitmap, Vector2 position, uint8_t key);
+
+//Bytes of storage CreateRLESprite needs to encode a bitmap
+uint32_t GetRLESpriteSize(const Bitmap* bitmap, uint8_t key);
+
+//Encode a bitmap, with key as the transparent colour, into storage supplied by the caller
+void CreateRLESprite(RLESprite* sprite, const Bitmap* bitmap, uint8_t key, void* storage);
+
+void BlitRLESprite(const RLESprite* sprite, Vector2 position);
+
+//Bytes of storage CreatePlanarSprite needs to split a bitmap
+uint32_t GetPlanarSpriteSize(const Bitmap* bitmap);
+
+void CreatePlanarSprite(PlanarSprite* sprite, const Bitmap* bitmap, void* storage);
+
+void BlitPlanarSprite(const PlanarSprite* sprite, Vector2 position);
+
+void BlitPlanarSpriteKeyed(const PlanarSprite* sprite, Vector2 position, uint8_t key);
+
+//Copy a rectangle of the screen to another position on it. In plane mode the source may also be in
+//off-screen VGA memory below the screen (see VGA_GetMemoryRows; the rows past the pages in use
+//hold the glyph cache) and, when source and destination
+//start in the same plane, 4 pixels are moved per byte through the VGA latches. Overlap is allowed
+void CopyRect(Rectangle source, Vector2 destination);
+
+void CopyUserRect(uint32_t start, uint32_t size, uint32_t destination);
+
+//Opaque text from the glyph cache in off-screen VGA memory: each cell is drawn there once per colour,
+//background and plane alignment, then latch copied. With a back buffer the text is also drawn into it,
+//and the latch copy happens at Present. Returns 0, having drawn nothing, when the cache can't be used
+//(chain4, no memory past the pages in use, or too much text waiting for Present)
+uint8_t DrawCachedText(const char* text, uint16_t x, uint16_t y, uint8_t colour, uint8_t background);
+
+//sprite is a Bitmap, RLESprite or PlanarSprite depending on the BLIT_ mode in the low byte of modeKey
+void BlitUserSprite(const void* sprite, uint32_t position, uint32_t modeKey);
+
+Vector2 Reverse32BitMergeVector2(uint32_t a);
+
+#endif
@@ -3,3615 +3,103 @@
 
 #include <stdint.h>
 #include <draw.h>
+#include <fixed.h>
 
-typedef struct
-{
-    float x;
-    float y;
-    float z;
-} Vector3;
+//Fixed point 3D pipeline: model to view transform, frustum rejection, perspective projection,
+//backface culling and drawing. View space has x to the right, y up and z into the screen; the
+//camera is at the origin and projects onto the centre of the screen.
 
-//base object
-// typedef struct {
-//     Vector2[] points;
-//     Vector3[] face1;
-//     Vector3[] face2;
-//     Vector3[] face3;
-// } Object3D;
+//Most vertices a mesh can have
+#define MESH_MAX_VERTICES 1024
 
-void DrawTeapot();
+//Most visible triangles a scene can hold between Draw3D_BeginScene and Draw3D_EndScene
+#define SCENE_MAX_TRIANGLES 1024
 
-// #define TOTAL_POINTS 530
-// #define TOTAL_FACES 992
+//How a mesh instance is drawn
+#define MESH_WIREFRAME 0
+#define MESH_SOLID 1
 
-#define TOTAL_POINTS 8
-#define TOTAL_FACES 12
-typedef struct
-{
-    float rotate;
+//A 4x4 transform. Points are column vectors (p' = M p), so the translation is m[0..2][3]
+typedef struct {
+    fixed m[4][4];
+} Matrix4;
 
-    int16_t x;
-    int16_t y;
-    int16_t z;
+//A triangle mesh, normally one read from the mesh file (see meshfile.h). Positions are held as
+//separate x, y and z arrays, so the transform runs down each one, and are whole numbers of
+//1 / 2^Shift units. Faces are 3 vertex indexes each, anticlockwise seen from outside. Radius is the
+//bounding sphere about the origin, used to reject the whole mesh when it is out of view
+typedef struct {
+    uint16_t VertexCount;
+    uint16_t FaceCount;
+    uint8_t Shift;
+    fixed Radius;
+    const int16_t* X;
+    const int16_t* Y;
+    const int16_t* Z;
+    const uint16_t* Faces;
+} Mesh;
 
-    Vector3 points[TOTAL_POINTS];
-    Vector2 screenPoints[TOTAL_POINTS];
-    int16_t face1[TOTAL_FACES];
-    int16_t face2[TOTAL_FACES];
-    int16_t face3[TOTAL_FACES];
-} Cube;
+//What happened to a mesh's faces when it was last drawn
+typedef struct {
+    uint16_t FacesDrawn;
+    uint16_t FacesCulled;
+    uint16_t FacesRejected;
+} MeshStatistics;
 
-static Cube cube = {
-    .x = 10,
-    .y = 10,
-    .z = 10,
-    .rotate = 1.0f,
-    .points[0] = {.x = 100.000000, .y = 50.000000, .z = 50.000000},
-    .points[1] = {.x = 100.000000, .y = 50.000000, .z = 100.000000},
-    .points[2] = {.x = 50.000000, .y = 50.000000, .z = 100.000000},
-    .points[3] = {.x = 50.000000, .y = 50.000000, .z = 50.000000},
-    .points[4] = {.x = 100.000000, .y = 100.000000, .z = 50.000000},
-    .points[5] = {.x = 100.000000, .y = 100.000000, .z = 100.000000},
-    .points[6] = {.x = 50.000000, .y = 100.000000, .z = 100.000000},
-    .points[7] = {.x = 50.000000, .y = 100.000000, .z = 50.000000},
-    .face1[0] = 1,
-    .face2[0] = 2,
-    .face3[0] = 3,
-    .face1[1] = 1,
-    .face2[1] = 3,
-    .face3[1] = 4,
-    .face1[2] = 5,
-    .face2[2] = 8,
-    .face3[2] = 7,
-    .face1[3] = 5,
-    .face2[3] = 7,
-    .face3[3] = 6,
-    .face1[4] = 1,
-    .face2[4] = 5,
-    .face3[4] = 6,
-    .face1[5] = 1,
-    .face2[5] = 6,
-    .face3[5] = 2,
-    .face1[6] = 2,
-    .face2[6] = 6,
-    .face3[6] = 7,
-    .face1[7] = 2,
-    .face2[7] = 7,
-    .face3[7] = 3,
-    .face1[8] = 3,
-    .face2[8] = 7,
-    .face3[8] = 8,
-    .face1[9] = 3,
-    .face2[9] = 8,
-    .face3[9] = 4,
-    .face1[10] = 5,
-    .face2[10] = 1,
-    .face3[10] = 4,
-    .face1[11] = 5,
-    .face2[11] = 4,
-    .face3[11] = 8
-};
+//A mesh with its orientation and view space position, as passed to the draw mesh system call.
+//Solid meshes with a colour from the colour cube (16 to 231) are shaded by the light
+typedef struct {
+    const Mesh* Mesh;
+    uint16_t AngleX;
+    uint16_t AngleY;
+    uint16_t AngleZ;
+    fixed X;
+    fixed Y;
+    fixed Z;
+    uint8_t Colour;
+    uint8_t Style;
+    MeshStatistics Statistics;
+} MeshInstance;
 
-// typedef struct
-// {
-//     int16_t x;
-//     int16_t y;
-//     int16_t z;
+void Matrix4_Identity(Matrix4* m);
 
-//     Vector3 points[TOTAL_POINTS];
-//     Vector2 screenPoints[TOTAL_POINTS];
-//     int16_t face1[TOTAL_FACES];
-//     int16_t face2[TOTAL_FACES];
-//     int16_t face3[TOTAL_FACES];
-// } Teapot;
-// static Teapot teapot = {
-//     .points[0] = {.x = 37.030300, .y = 30.444298, .z = 14.293805},
-//     .points[1] = {.x = 37.542500, .y = 28.345697, .z = 14.511704},
-//     .points[2] = {.x = 40.626598, .y = 28.345699, .z = -1.108035},
-//     .points[3] = {.x = 40.071400, .y = 30.444300, .z = -1.108035},
-//     .points[4] = {.x = 37.624401, .y = 31.143799, .z = 14.546605},
-//     .points[5] = {.x = 40.715500, .y = 31.143801, .z = -1.108035},
-//     .points[6] = {.x = 38.833099, .y = 30.444298, .z = 15.060905},
-//     .points[7] = {.x = 42.025700, .y = 30.444300, .z = -1.108035},
-//     .points[8] = {.x = 40.164700, .y = 28.345697, .z = 15.627405},
-//     .points[9] = {.x = 43.469200, .y = 28.345699, .z = -1.108035},
-//     .points[10] = {.x = 28.691700, .y = 30.444296, .z = 26.752707},
-//     .points[11] = {.x = 29.085899, .y = 28.345695, .z = 27.146803},
-//     .points[12] = {.x = 29.149000, .y = 31.143797, .z = 27.209906},
-//     .points[13] = {.x = 30.079201, .y = 30.444296, .z = 28.140205},
-//     .points[14] = {.x = 31.104099, .y = 28.345695, .z = 29.165005},
-//     .points[15] = {.x = 16.232901, .y = 30.444294, .z = 35.091206},
-//     .points[16] = {.x = 16.450800, .y = 28.345694, .z = 35.603405},
-//     .points[17] = {.x = 16.485701, .y = 31.143795, .z = 35.685303},
-//     .points[18] = {.x = 16.999901, .y = 30.444294, .z = 36.894005},
-//     .points[19] = {.x = 17.566500, .y = 28.345694, .z = 38.225605},
-//     .points[20] = {.x = 0.831025, .y = 30.444294, .z = 38.132404},
-//     .points[21] = {.x = 0.831025, .y = 28.345694, .z = 38.687603},
-//     .points[22] = {.x = 0.831025, .y = 31.143795, .z = 38.776405},
-//     .points[23] = {.x = 0.831025, .y = 30.444294, .z = 40.086605},
-//     .points[24] = {.x = 0.831025, .y = 28.345692, .z = 41.530106},
-//     .points[25] = {.x = -15.026200, .y = 30.444294, .z = 35.091206},
-//     .points[26] = {.x = -15.868000, .y = 28.345694, .z = 35.603405},
-//     .points[27] = {.x = -14.958500, .y = 31.143795, .z = 35.685303},
-//     .points[28] = {.x = -15.354700, .y = 30.444294, .z = 36.894005},
-//     .points[29] = {.x = -15.904400, .y = 28.345694, .z = 38.225605},
-//     .points[30] = {.x = -27.434401, .y = 30.444296, .z = 26.752707},
-//     .points[31] = {.x = -28.383200, .y = 28.345695, .z = 27.146803},
-//     .points[32] = {.x = -27.606800, .y = 31.143797, .z = 27.209906},
-//     .points[33] = {.x = -28.432199, .y = 30.444296, .z = 28.140205},
-//     .points[34] = {.x = -29.442101, .y = 28.345695, .z = 29.165005},
-//     .points[35] = {.x = -35.520000, .y = 30.444298, .z = 14.293805},
-//     .points[36] = {.x = -36.240200, .y = 28.345697, .z = 14.511704},
-//     .points[37] = {.x = -36.007301, .y = 31.143799, .z = 14.546605},
-//     .points[38] = {.x = -37.176701, .y = 30.444298, .z = 15.060905},
-//     .points[39] = {.x = -38.502701, .y = 28.345697, .z = 15.627405},
-//     .points[40] = {.x = -38.409401, .y = 30.444300, .z = -1.108035},
-//     .points[41] = {.x = -38.964600, .y = 28.345699, .z = -1.108035},
-//     .points[42] = {.x = -39.053398, .y = 31.143801, .z = -1.108035},
-//     .points[43] = {.x = -40.363602, .y = 30.444300, .z = -1.108035},
-//     .points[44] = {.x = -41.807098, .y = 28.345699, .z = -1.108035},
-//     .points[45] = {.x = -35.368301, .y = 30.444302, .z = -16.509893},
-//     .points[46] = {.x = -35.880402, .y = 28.345701, .z = -16.727797},
-//     .points[47] = {.x = -35.962399, .y = 31.143803, .z = -16.762693},
-//     .points[48] = {.x = -37.171101, .y = 30.444302, .z = -17.276894},
-//     .points[49] = {.x = -38.502701, .y = 28.345703, .z = -17.843496},
-//     .points[50] = {.x = -27.029699, .y = 30.444304, .z = -28.968695},
-//     .points[51] = {.x = -27.423800, .y = 28.345705, .z = -29.362896},
-//     .points[52] = {.x = -27.486900, .y = 31.143806, .z = -29.425995},
-//     .points[53] = {.x = -28.417200, .y = 30.444305, .z = -30.356194},
-//     .points[54] = {.x = -29.442101, .y = 28.345705, .z = -31.381096},
-//     .points[55] = {.x = -14.570800, .y = 30.444305, .z = -37.307297},
-//     .points[56] = {.x = -14.788700, .y = 28.345705, .z = -37.819496},
-//     .points[57] = {.x = -14.823600, .y = 31.143806, .z = -37.901398},
-//     .points[58] = {.x = -15.337900, .y = 30.444305, .z = -39.110096},
-//     .points[59] = {.x = -15.904400, .y = 28.345705, .z = -40.441696},
-//     .points[60] = {.x = 0.831025, .y = 30.444305, .z = -40.348396},
-//     .points[61] = {.x = 0.831025, .y = 28.345705, .z = -40.903595},
-//     .points[62] = {.x = 0.831025, .y = 31.143808, .z = -40.992496},
-//     .points[63] = {.x = 0.831025, .y = 30.444307, .z = -42.302696},
-//     .points[64] = {.x = 0.831025, .y = 28.345707, .z = -43.746197},
-//     .points[65] = {.x = 16.232901, .y = 30.444305, .z = -37.307297},
-//     .points[66] = {.x = 16.450800, .y = 28.345705, .z = -37.819496},
-//     .points[67] = {.x = 16.485701, .y = 31.143806, .z = -37.901398},
-//     .points[68] = {.x = 16.999901, .y = 30.444305, .z = -39.110096},
-//     .points[69] = {.x = 17.566500, .y = 28.345705, .z = -40.441696},
-//     .points[70] = {.x = 28.691700, .y = 30.444304, .z = -28.968695},
-//     .points[71] = {.x = 29.085899, .y = 28.345705, .z = -29.362896},
-//     .points[72] = {.x = 29.149000, .y = 31.143806, .z = -29.425995},
-//     .points[73] = {.x = 30.079201, .y = 30.444305, .z = -30.356194},
-//     .points[74] = {.x = 31.104099, .y = 28.345705, .z = -31.381096},
-//     .points[75] = {.x = 37.030300, .y = 30.444302, .z = -16.509893},
-//     .points[76] = {.x = 37.542500, .y = 28.345701, .z = -16.727797},
-//     .points[77] = {.x = 37.624401, .y = 31.143803, .z = -16.762693},
-//     .points[78] = {.x = 38.833099, .y = 30.444302, .z = -17.276894},
-//     .points[79] = {.x = 40.164700, .y = 28.345703, .z = -17.843496},
-//     .points[80] = {.x = 44.979000, .y = 17.186497, .z = 17.675802},
-//     .points[81] = {.x = 48.687901, .y = 17.186501, .z = -1.108037},
-//     .points[82] = {.x = 49.178699, .y = 6.227137, .z = 19.462603},
-//     .points[83] = {.x = 53.240398, .y = 6.227140, .z = -1.108039},
-//     .points[84] = {.x = 52.149200, .y = -4.332463, .z = 20.726500},
-//     .points[85] = {.x = 56.460499, .y = -4.332460, .z = -1.108041},
-//     .points[86] = {.x = 53.275902, .y = -14.292503, .z = 21.205898},
-//     .points[87] = {.x = 57.681900, .y = -14.292500, .z = -1.108042},
-//     .points[88] = {.x = 34.809399, .y = 17.186495, .z = 32.870304},
-//     .points[89] = {.x = 38.041698, .y = 6.227134, .z = 36.102600},
-//     .points[90] = {.x = 40.327900, .y = -4.332466, .z = 38.388901},
-//     .points[91] = {.x = 41.195099, .y = -14.292506, .z = 39.256096},
-//     .points[92] = {.x = 19.614799, .y = 17.186493, .z = 43.039906},
-//     .points[93] = {.x = 21.401699, .y = 6.227132, .z = 47.239601},
-//     .points[94] = {.x = 22.665600, .y = -4.332468, .z = 50.210098},
-//     .points[95] = {.x = 23.145000, .y = -14.292508, .z = 51.336895},
-//     .points[96] = {.x = 0.831025, .y = 17.186493, .z = 46.748802},
-//     .points[97] = {.x = 0.831025, .y = 6.227131, .z = 51.301300},
-//     .points[98] = {.x = 0.831025, .y = -4.332469, .z = 54.521400},
-//     .points[99] = {.x = 0.831025, .y = -14.292509, .z = 55.742798},
-//     .points[100] = {.x = -17.952801, .y = 17.186493, .z = 43.039906},
-//     .points[101] = {.x = -19.739700, .y = 6.227132, .z = 47.239601},
-//     .points[102] = {.x = -21.003500, .y = -4.332468, .z = 50.210098},
-//     .points[103] = {.x = -21.482901, .y = -14.292508, .z = 51.336895},
-//     .points[104] = {.x = -33.147400, .y = 17.186495, .z = 32.870304},
-//     .points[105] = {.x = -36.379601, .y = 6.227134, .z = 36.102600},
-//     .points[106] = {.x = -38.665901, .y = -4.332466, .z = 38.388901},
-//     .points[107] = {.x = -39.533100, .y = -14.292506, .z = 39.256096},
-//     .points[108] = {.x = -43.316898, .y = 17.186497, .z = 17.675802},
-//     .points[109] = {.x = -47.516602, .y = 6.227137, .z = 19.462603},
-//     .points[110] = {.x = -50.487099, .y = -4.332463, .z = 20.726500},
-//     .points[111] = {.x = -51.613899, .y = -14.292503, .z = 21.205898},
-//     .points[112] = {.x = -47.025799, .y = 17.186501, .z = -1.108037},
-//     .points[113] = {.x = -51.578400, .y = 6.227140, .z = -1.108039},
-//     .points[114] = {.x = -54.798401, .y = -4.332460, .z = -1.108041},
-//     .points[115] = {.x = -56.019798, .y = -14.292500, .z = -1.108042},
-//     .points[116] = {.x = -43.316898, .y = 17.186504, .z = -19.891897},
-//     .points[117] = {.x = -47.516602, .y = 6.227143, .z = -21.678698},
-//     .points[118] = {.x = -50.487099, .y = -4.332456, .z = -22.942600},
-//     .points[119] = {.x = -51.613899, .y = -14.292496, .z = -23.422003},
-//     .points[120] = {.x = -33.147400, .y = 17.186506, .z = -35.086395},
-//     .points[121] = {.x = -36.379601, .y = 6.227146, .z = -38.318699},
-//     .points[122] = {.x = -38.665901, .y = -4.332453, .z = -40.604900},
-//     .points[123] = {.x = -39.533100, .y = -14.292493, .z = -41.472103},
-//     .points[124] = {.x = -17.952801, .y = 17.186508, .z = -45.255997},
-//     .points[125] = {.x = -19.739700, .y = 6.227148, .z = -49.455700},
-//     .points[126] = {.x = -21.003500, .y = -4.332451, .z = -52.426201},
-//     .points[127] = {.x = -21.482901, .y = -14.292491, .z = -53.552902},
-//     .points[128] = {.x = 0.831025, .y = 17.186508, .z = -48.964897},
-//     .points[129] = {.x = 0.831025, .y = 6.227149, .z = -53.517399},
-//     .points[130] = {.x = 0.831025, .y = -4.332451, .z = -56.737499},
-//     .points[131] = {.x = 0.831025, .y = -14.292490, .z = -57.958904},
-//     .points[132] = {.x = 19.614799, .y = 17.186508, .z = -45.255997},
-//     .points[133] = {.x = 21.401699, .y = 6.227148, .z = -49.455700},
-//     .points[134] = {.x = 22.665600, .y = -4.332451, .z = -52.426201},
-//     .points[135] = {.x = 23.145000, .y = -14.292491, .z = -53.552902},
-//     .points[136] = {.x = 34.809399, .y = 17.186506, .z = -35.086395},
-//     .points[137] = {.x = 38.041698, .y = 6.227146, .z = -38.318699},
-//     .points[138] = {.x = 40.327900, .y = -4.332453, .z = -40.604900},
-//     .points[139] = {.x = 41.195099, .y = -14.292493, .z = -41.472103},
-//     .points[140] = {.x = 44.979000, .y = 17.186504, .z = -19.891897},
-//     .points[141] = {.x = 49.178699, .y = 6.227143, .z = -21.678698},
-//     .points[142] = {.x = 52.149200, .y = -4.332456, .z = -22.942600},
-//     .points[143] = {.x = 53.275902, .y = -14.292496, .z = -23.422003},
-//     .points[144] = {.x = 51.227299, .y = -22.720203, .z = 20.334295},
-//     .points[145] = {.x = 55.461102, .y = -22.720200, .z = -1.108044},
-//     .points[146] = {.x = 46.720299, .y = -28.949305, .z = 18.416697},
-//     .points[147] = {.x = 50.575500, .y = -28.949301, .z = -1.108045},
-//     .points[148] = {.x = 42.213299, .y = -33.179802, .z = 16.499094},
-//     .points[149] = {.x = 45.689899, .y = -33.179798, .z = -1.108045},
-//     .points[150] = {.x = 40.164700, .y = -35.611504, .z = 15.627395},
-//     .points[151] = {.x = 43.469200, .y = -35.611500, .z = -1.108046},
-//     .points[152] = {.x = 39.618401, .y = -22.720205, .z = 37.679295},
-//     .points[153] = {.x = 36.149601, .y = -28.949306, .z = 34.210598},
-//     .points[154] = {.x = 32.680801, .y = -33.179802, .z = 30.741795},
-//     .points[155] = {.x = 31.104099, .y = -35.611504, .z = 29.164995},
-//     .points[156] = {.x = 22.273300, .y = -22.720207, .z = 49.288197},
-//     .points[157] = {.x = 20.355700, .y = -28.949308, .z = 44.781296},
-//     .points[158] = {.x = 18.438101, .y = -33.179806, .z = 40.274296},
-//     .points[159] = {.x = 17.566500, .y = -35.611507, .z = 38.225594},
-//     .points[160] = {.x = 0.831025, .y = -22.720209, .z = 53.522095},
-//     .points[161] = {.x = 0.831025, .y = -28.949308, .z = 48.636497},
-//     .points[162] = {.x = 0.831025, .y = -33.179806, .z = 43.750797},
-//     .points[163] = {.x = 0.831025, .y = -35.611507, .z = 41.530094},
-//     .points[164] = {.x = -20.611300, .y = -22.720207, .z = 49.288197},
-//     .points[165] = {.x = -18.693701, .y = -28.949308, .z = 44.781296},
-//     .points[166] = {.x = -16.776100, .y = -33.179806, .z = 40.274296},
-//     .points[167] = {.x = -15.904400, .y = -35.611507, .z = 38.225594},
-//     .points[168] = {.x = -37.956402, .y = -22.720205, .z = 37.679295},
-//     .points[169] = {.x = -34.487598, .y = -28.949306, .z = 34.210598},
-//     .points[170] = {.x = -31.018801, .y = -33.179802, .z = 30.741795},
-//     .points[171] = {.x = -29.442101, .y = -35.611504, .z = 29.164995},
-//     .points[172] = {.x = -49.565300, .y = -22.720203, .z = 20.334295},
-//     .points[173] = {.x = -45.058300, .y = -28.949305, .z = 18.416697},
-//     .points[174] = {.x = -40.551300, .y = -33.179802, .z = 16.499094},
-//     .points[175] = {.x = -38.502701, .y = -35.611504, .z = 15.627395},
-//     .points[176] = {.x = -53.799099, .y = -22.720200, .z = -1.108044},
-//     .points[177] = {.x = -48.913502, .y = -28.949301, .z = -1.108045},
-//     .points[178] = {.x = -44.027901, .y = -33.179798, .z = -1.108045},
-//     .points[179] = {.x = -41.807098, .y = -35.611500, .z = -1.108046},
-//     .points[180] = {.x = -49.565300, .y = -22.720196, .z = -22.550404},
-//     .points[181] = {.x = -45.058300, .y = -28.949297, .z = -20.632704},
-//     .points[182] = {.x = -40.551300, .y = -33.179794, .z = -18.715105},
-//     .points[183] = {.x = -38.502701, .y = -35.611496, .z = -17.843506},
-//     .points[184] = {.x = -37.956402, .y = -22.720194, .z = -39.895405},
-//     .points[185] = {.x = -34.487598, .y = -28.949295, .z = -36.426605},
-//     .points[186] = {.x = -31.018801, .y = -33.179794, .z = -32.957806},
-//     .points[187] = {.x = -29.442101, .y = -35.611496, .z = -31.381105},
-//     .points[188] = {.x = -20.611300, .y = -22.720192, .z = -51.504303},
-//     .points[189] = {.x = -18.693701, .y = -28.949293, .z = -46.997303},
-//     .points[190] = {.x = -16.776100, .y = -33.179790, .z = -42.490303},
-//     .points[191] = {.x = -15.904400, .y = -35.611492, .z = -40.441708},
-//     .points[192] = {.x = 0.831025, .y = -22.720190, .z = -55.738205},
-//     .points[193] = {.x = 0.831025, .y = -28.949293, .z = -50.852505},
-//     .points[194] = {.x = 0.831025, .y = -33.179790, .z = -45.966904},
-//     .points[195] = {.x = 0.831025, .y = -35.611492, .z = -43.746208},
-//     .points[196] = {.x = 22.273300, .y = -22.720192, .z = -51.504303},
-//     .points[197] = {.x = 20.355700, .y = -28.949293, .z = -46.997303},
-//     .points[198] = {.x = 18.438101, .y = -33.179790, .z = -42.490303},
-//     .points[199] = {.x = 17.566500, .y = -35.611492, .z = -40.441708},
-//     .points[200] = {.x = 39.618401, .y = -22.720194, .z = -39.895405},
-//     .points[201] = {.x = 36.149601, .y = -28.949295, .z = -36.426605},
-//     .points[202] = {.x = 32.680801, .y = -33.179794, .z = -32.957806},
-//     .points[203] = {.x = 31.104099, .y = -35.611496, .z = -31.381105},
-//     .points[204] = {.x = 51.227299, .y = -22.720196, .z = -22.550404},
-//     .points[205] = {.x = 46.720299, .y = -28.949297, .z = -20.632704},
-//     .points[206] = {.x = 42.213299, .y = -33.179794, .z = -18.715105},
-//     .points[207] = {.x = 40.164700, .y = -35.611496, .z = -17.843506},
-//     .points[208] = {.x = 39.273602, .y = -37.177204, .z = 15.248294},
-//     .points[209] = {.x = 42.503101, .y = -37.177200, .z = -1.108046},
-//     .points[210] = {.x = 34.510502, .y = -38.542904, .z = 13.221693},
-//     .points[211] = {.x = 37.339901, .y = -38.542900, .z = -1.108046},
-//     .points[212] = {.x = 22.741100, .y = -39.508900, .z = 8.214133},
-//     .points[213] = {.x = 24.581800, .y = -39.508900, .z = -1.108046},
-//     .points[214] = {.x = 0.831025, .y = -39.875401, .z = -1.108046},
-//     .points[215] = {.x = 30.418200, .y = -37.177204, .z = 28.479195},
-//     .points[216] = {.x = 26.752300, .y = -38.542904, .z = 24.813293},
-//     .points[217] = {.x = 17.694099, .y = -39.508904, .z = 15.754993},
-//     .points[218] = {.x = 17.187300, .y = -37.177208, .z = 37.334492},
-//     .points[219] = {.x = 15.160800, .y = -38.542904, .z = 32.571392},
-//     .points[220] = {.x = 10.153200, .y = -39.508904, .z = 20.802094},
-//     .points[221] = {.x = 0.831025, .y = -37.177208, .z = 40.564091},
-//     .points[222] = {.x = 0.831025, .y = -38.542908, .z = 35.400894},
-//     .points[223] = {.x = 0.831025, .y = -39.508904, .z = 22.642694},
-//     .points[224] = {.x = -15.525300, .y = -37.177208, .z = 37.334492},
-//     .points[225] = {.x = -13.498700, .y = -38.542904, .z = 32.571392},
-//     .points[226] = {.x = -8.491150, .y = -39.508904, .z = 20.802094},
-//     .points[227] = {.x = -28.756201, .y = -37.177204, .z = 28.479195},
-//     .points[228] = {.x = -25.090300, .y = -38.542904, .z = 24.813293},
-//     .points[229] = {.x = -16.032000, .y = -39.508904, .z = 15.754993},
-//     .points[230] = {.x = -37.611500, .y = -37.177204, .z = 15.248294},
-//     .points[231] = {.x = -32.848400, .y = -38.542904, .z = 13.221693},
-//     .points[232] = {.x = -21.079100, .y = -39.508900, .z = 8.214133},
-//     .points[233] = {.x = -40.841099, .y = -37.177200, .z = -1.108046},
-//     .points[234] = {.x = -35.677898, .y = -38.542900, .z = -1.108046},
-//     .points[235] = {.x = -22.919800, .y = -39.508900, .z = -1.108046},
-//     .points[236] = {.x = -37.611500, .y = -37.177197, .z = -17.464306},
-//     .points[237] = {.x = -32.848400, .y = -38.542896, .z = -15.437807},
-//     .points[238] = {.x = -21.079100, .y = -39.508900, .z = -10.430206},
-//     .points[239] = {.x = -28.756201, .y = -37.177197, .z = -30.695206},
-//     .points[240] = {.x = -25.090300, .y = -38.542896, .z = -27.029406},
-//     .points[241] = {.x = -16.032000, .y = -39.508896, .z = -17.971106},
-//     .points[242] = {.x = -15.525300, .y = -37.177193, .z = -39.550606},
-//     .points[243] = {.x = -13.498700, .y = -38.542896, .z = -34.787506},
-//     .points[244] = {.x = -8.491150, .y = -39.508896, .z = -23.018106},
-//     .points[245] = {.x = 0.831025, .y = -37.177193, .z = -42.780209},
-//     .points[246] = {.x = 0.831025, .y = -38.542892, .z = -37.616909},
-//     .points[247] = {.x = 0.831025, .y = -39.508896, .z = -24.858807},
-//     .points[248] = {.x = 17.187300, .y = -37.177193, .z = -39.550606},
-//     .points[249] = {.x = 15.160800, .y = -38.542896, .z = -34.787506},
-//     .points[250] = {.x = 10.153200, .y = -39.508896, .z = -23.018106},
-//     .points[251] = {.x = 30.418200, .y = -37.177197, .z = -30.695206},
-//     .points[252] = {.x = 26.752300, .y = -38.542896, .z = -27.029406},
-//     .points[253] = {.x = 17.694099, .y = -39.508896, .z = -17.971106},
-//     .points[254] = {.x = 39.273602, .y = -37.177197, .z = -17.464306},
-//     .points[255] = {.x = 34.510502, .y = -38.542896, .z = -15.437807},
-//     .points[256] = {.x = 22.741100, .y = -39.508900, .z = -10.430206},
-//     .points[257] = {.x = -58.325199, .y = 18.569901, .z = 3.688763},
-//     .points[258] = {.x = -44.205502, .y = 18.685499, .z = 3.688763},
-//     .points[259] = {.x = -44.649700, .y = 17.686100, .z = -1.108037},
-//     .points[260] = {.x = -57.929699, .y = 17.586201, .z = -1.108037},
-//     .points[261] = {.x = -68.689102, .y = 17.761101, .z = 3.688763},
-//     .points[262] = {.x = -67.745300, .y = 16.886700, .z = -1.108037},
-//     .points[263] = {.x = -75.072403, .y = 15.565699, .z = 3.688763},
-//     .points[264] = {.x = -73.830101, .y = 14.987900, .z = -1.108038},
-//     .points[265] = {.x = -77.250099, .y = 11.290399, .z = 3.688762},
-//     .points[266] = {.x = -75.917603, .y = 11.290400, .z = -1.108038},
-//     .points[267] = {.x = -59.195499, .y = 20.734100, .z = 5.287694},
-//     .points[268] = {.x = -43.228401, .y = 20.884001, .z = 5.287694},
-//     .points[269] = {.x = -70.765503, .y = 19.684799, .z = 5.287694},
-//     .points[270] = {.x = -77.805298, .y = 16.836700, .z = 5.287693},
-//     .points[271] = {.x = -80.181396, .y = 11.290399, .z = 5.287692},
-//     .points[272] = {.x = -60.065701, .y = 22.898300, .z = 3.688764},
-//     .points[273] = {.x = -42.251301, .y = 23.082500, .z = 3.688764},
-//     .points[274] = {.x = -72.841904, .y = 21.608500, .z = 3.688764},
-//     .points[275] = {.x = -80.538101, .y = 18.107700, .z = 3.688763},
-//     .points[276] = {.x = -83.112801, .y = 11.290399, .z = 3.688762},
-//     .points[277] = {.x = -60.461300, .y = 23.882000, .z = -1.108036},
-//     .points[278] = {.x = -41.807098, .y = 24.081900, .z = -1.108036},
-//     .points[279] = {.x = -73.785698, .y = 22.482901, .z = -1.108036},
-//     .points[280] = {.x = -81.780403, .y = 18.685499, .z = -1.108037},
-//     .points[281] = {.x = -84.445297, .y = 11.290400, .z = -1.108038},
-//     .points[282] = {.x = -60.065701, .y = 22.898302, .z = -5.904826},
-//     .points[283] = {.x = -42.251301, .y = 23.082502, .z = -5.904826},
-//     .points[284] = {.x = -72.841904, .y = 21.608501, .z = -5.904827},
-//     .points[285] = {.x = -80.538101, .y = 18.107702, .z = -5.904827},
-//     .points[286] = {.x = -83.112801, .y = 11.290401, .z = -5.904828},
-//     .points[287] = {.x = -59.195499, .y = 20.734102, .z = -7.503757},
-//     .points[288] = {.x = -43.228401, .y = 20.884003, .z = -7.503757},
-//     .points[289] = {.x = -70.765503, .y = 19.684801, .z = -7.503757},
-//     .points[290] = {.x = -77.805298, .y = 16.836702, .z = -7.503757},
-//     .points[291] = {.x = -80.181396, .y = 11.290401, .z = -7.503758},
-//     .points[292] = {.x = -58.325199, .y = 18.569902, .z = -5.904827},
-//     .points[293] = {.x = -44.205502, .y = 18.685501, .z = -5.904827},
-//     .points[294] = {.x = -68.689102, .y = 17.761103, .z = -5.904827},
-//     .points[295] = {.x = -75.072403, .y = 15.565701, .z = -5.904828},
-//     .points[296] = {.x = -77.250099, .y = 11.290401, .z = -5.904828},
-//     .points[297] = {.x = -76.018303, .y = 4.934770, .z = 3.688761},
-//     .points[298] = {.x = -74.807297, .y = 5.494300, .z = -1.108039},
-//     .points[299] = {.x = -72.158997, .y = -2.354621, .z = 3.688760},
-//     .points[300] = {.x = -71.298500, .y = -1.501030, .z = -1.108040},
-//     .points[301] = {.x = -65.426697, .y = -9.550331, .z = 3.688758},
-//     .points[302] = {.x = -65.124802, .y = -8.496340, .z = -1.108041},
-//     .points[303] = {.x = -55.575699, .y = -15.624901, .z = 3.688757},
-//     .points[304] = {.x = -56.019798, .y = -14.292500, .z = -1.108042},
-//     .points[305] = {.x = -78.682404, .y = 3.703829, .z = 5.287691},
-//     .points[306] = {.x = -74.052200, .y = -4.232531, .z = 5.287690},
-//     .points[307] = {.x = -66.090897, .y = -11.869101, .z = 5.287688},
-//     .points[308] = {.x = -54.598598, .y = -18.556299, .z = 5.287687},
-//     .points[309] = {.x = -81.346603, .y = 2.472879, .z = 3.688761},
-//     .points[310] = {.x = -75.945396, .y = -6.110440, .z = 3.688759},
-//     .points[311] = {.x = -66.754997, .y = -14.187801, .z = 3.688758},
-//     .points[312] = {.x = -53.621399, .y = -21.487700, .z = 3.688756},
-//     .points[313] = {.x = -82.557602, .y = 1.913360, .z = -1.108040},
-//     .points[314] = {.x = -76.805901, .y = -6.964040, .z = -1.108041},
-//     .points[315] = {.x = -67.056900, .y = -15.241800, .z = -1.108042},
-//     .points[316] = {.x = -53.177299, .y = -22.820101, .z = -1.108044},
-//     .points[317] = {.x = -81.346603, .y = 2.472881, .z = -5.904830},
-//     .points[318] = {.x = -75.945396, .y = -6.110439, .z = -5.904831},
-//     .points[319] = {.x = -66.754997, .y = -14.187799, .z = -5.904832},
-//     .points[320] = {.x = -53.621399, .y = -21.487698, .z = -5.904833},
-//     .points[321] = {.x = -78.682404, .y = 3.703831, .z = -7.503759},
-//     .points[322] = {.x = -74.052200, .y = -4.232529, .z = -7.503760},
-//     .points[323] = {.x = -66.090897, .y = -11.869099, .z = -7.503762},
-//     .points[324] = {.x = -54.598598, .y = -18.556297, .z = -7.503763},
-//     .points[325] = {.x = -76.018303, .y = 4.934771, .z = -5.904829},
-//     .points[326] = {.x = -72.158997, .y = -2.354619, .z = -5.904830},
-//     .points[327] = {.x = -65.426697, .y = -9.550329, .z = -5.904831},
-//     .points[328] = {.x = -55.575699, .y = -15.624899, .z = -5.904832},
-//     .points[329] = {.x = 63.830502, .y = 1.045189, .z = 8.420590},
-//     .points[330] = {.x = 49.154301, .y = -3.033331, .z = 9.444899},
-//     .points[331] = {.x = 49.154301, .y = 0.630882, .z = -1.108040},
-//     .points[332] = {.x = 62.789600, .y = 3.762120, .z = -1.108039},
-//     .points[333] = {.x = 70.029198, .y = 9.708139, .z = 6.167101},
-//     .points[334] = {.x = 68.696701, .y = 11.290400, .z = -1.108038},
-//     .points[335] = {.x = 73.562897, .y = 19.845100, .z = 3.913613},
-//     .points[336] = {.x = 71.939003, .y = 20.417601, .z = -1.108037},
-//     .points[337] = {.x = 80.244598, .y = 28.345699, .z = 2.889295},
-//     .points[338] = {.x = 77.579697, .y = 28.345699, .z = -1.108035},
-//     .points[339] = {.x = 66.120697, .y = -4.932062, .z = 11.596799},
-//     .points[340] = {.x = 49.154301, .y = -11.094602, .z = 12.962598},
-//     .points[341] = {.x = 72.960503, .y = 6.227139, .z = 8.592141},
-//     .points[342] = {.x = 77.135498, .y = 18.585501, .z = 5.587493},
-//     .points[343] = {.x = 86.107300, .y = 28.345699, .z = 4.221735},
-//     .points[344] = {.x = 68.410797, .y = -10.909301, .z = 8.420588},
-//     .points[345] = {.x = 49.154301, .y = -19.155901, .z = 9.444897},
-//     .points[346] = {.x = 75.891899, .y = 2.746139, .z = 6.167100},
-//     .points[347] = {.x = 80.708099, .y = 17.326000, .z = 3.913613},
-//     .points[348] = {.x = 91.970001, .y = 28.345699, .z = 2.889295},
-//     .points[349] = {.x = 69.451797, .y = -13.626200, .z = -1.108042},
-//     .points[350] = {.x = 49.154301, .y = -22.820101, .z = -1.108044},
-//     .points[351] = {.x = 77.224403, .y = 1.163860, .z = -1.108040},
-//     .points[352] = {.x = 82.332100, .y = 16.753401, .z = -1.108037},
-//     .points[353] = {.x = 94.634903, .y = 28.345699, .z = -1.108035},
-//     .points[354] = {.x = 68.410797, .y = -10.909298, .z = -10.636702},
-//     .points[355] = {.x = 49.154301, .y = -19.155897, .z = -11.661003},
-//     .points[356] = {.x = 75.891899, .y = 2.746141, .z = -8.383170},
-//     .points[357] = {.x = 80.708099, .y = 17.326002, .z = -6.129677},
-//     .points[358] = {.x = 91.970001, .y = 28.345699, .z = -5.105355},
-//     .points[359] = {.x = 66.120697, .y = -4.932057, .z = -13.812901},
-//     .points[360] = {.x = 49.154301, .y = -11.094597, .z = -15.178602},
-//     .points[361] = {.x = 72.960503, .y = 6.227142, .z = -10.808199},
-//     .points[362] = {.x = 77.135498, .y = 18.585503, .z = -7.803557},
-//     .points[363] = {.x = 86.107300, .y = 28.345701, .z = -6.437795},
-//     .points[364] = {.x = 63.830502, .y = 1.045192, .z = -10.636700},
-//     .points[365] = {.x = 49.154301, .y = -3.033328, .z = -11.661001},
-//     .points[366] = {.x = 70.029198, .y = 9.708141, .z = -8.383168},
-//     .points[367] = {.x = 73.562897, .y = 19.845102, .z = -6.129677},
-//     .points[368] = {.x = 80.244598, .y = 28.345699, .z = -5.105355},
-//     .points[369] = {.x = 82.476700, .y = 29.603399, .z = 2.639465},
-//     .points[370] = {.x = 79.622704, .y = 29.544901, .z = -1.108035},
-//     .points[371] = {.x = 83.811600, .y = 30.038300, .z = 2.089835},
-//     .points[372] = {.x = 81.132896, .y = 29.944599, .z = -1.108035},
-//     .points[373] = {.x = 83.851501, .y = 29.626801, .z = 1.540195},
-//     .points[374] = {.x = 81.577003, .y = 29.544901, .z = -1.108035},
-//     .points[375] = {.x = 82.198799, .y = 28.345699, .z = 1.290365},
-//     .points[376] = {.x = 80.422203, .y = 28.345699, .z = -1.108035},
-//     .points[377] = {.x = 88.755501, .y = 29.732201, .z = 3.888625},
-//     .points[378] = {.x = 89.704903, .y = 30.244400, .z = 3.155785},
-//     .points[379] = {.x = 88.855499, .y = 29.807199, .z = 2.422945},
-//     .points[380] = {.x = 86.107300, .y = 28.345699, .z = 2.089834},
-//     .points[381] = {.x = 95.034302, .y = 29.861099, .z = 2.639465},
-//     .points[382] = {.x = 95.598198, .y = 30.450500, .z = 2.089835},
-//     .points[383] = {.x = 93.859398, .y = 29.987499, .z = 1.540195},
-//     .points[384] = {.x = 90.015800, .y = 28.345699, .z = 1.290365},
-//     .points[385] = {.x = 97.888298, .y = 29.919600, .z = -1.108035},
-//     .points[386] = {.x = 98.276901, .y = 30.544201, .z = -1.108035},
-//     .points[387] = {.x = 96.133904, .y = 30.069500, .z = -1.108035},
-//     .points[388] = {.x = 91.792397, .y = 28.345699, .z = -1.108035},
-//     .points[389] = {.x = 95.034302, .y = 29.861099, .z = -4.855525},
-//     .points[390] = {.x = 95.598198, .y = 30.450500, .z = -4.305895},
-//     .points[391] = {.x = 93.859398, .y = 29.987499, .z = -3.756255},
-//     .points[392] = {.x = 90.015800, .y = 28.345699, .z = -3.506425},
-//     .points[393] = {.x = 88.755501, .y = 29.732203, .z = -6.104685},
-//     .points[394] = {.x = 89.704903, .y = 30.244400, .z = -5.371845},
-//     .points[395] = {.x = 88.855499, .y = 29.807199, .z = -4.639005},
-//     .points[396] = {.x = 86.107300, .y = 28.345699, .z = -4.305895},
-//     .points[397] = {.x = 82.476700, .y = 29.603399, .z = -4.855525},
-//     .points[398] = {.x = 83.811600, .y = 30.038300, .z = -4.305895},
-//     .points[399] = {.x = 83.851501, .y = 29.626801, .z = -3.756255},
-//     .points[400] = {.x = 82.198799, .y = 28.345699, .z = -3.506425},
-//     .points[401] = {.x = 9.766420, .y = 48.265701, .z = 2.702438},
-//     .points[402] = {.x = 0.831025, .y = 49.664700, .z = -1.108032},
-//     .points[403] = {.x = 10.513400, .y = 48.265701, .z = -1.108032},
-//     .points[404] = {.x = 9.356320, .y = 44.868000, .z = 2.526987},
-//     .points[405] = {.x = 10.069300, .y = 44.868000, .z = -1.108033},
-//     .points[406] = {.x = 5.994700, .y = 40.670799, .z = 1.091877},
-//     .points[407] = {.x = 6.427280, .y = 40.670799, .z = -1.108033},
-//     .points[408] = {.x = 6.075520, .y = 36.873299, .z = 1.123366},
-//     .points[409] = {.x = 6.516110, .y = 36.873299, .z = -1.108034},
-//     .points[410] = {.x = 7.714530, .y = 48.265701, .z = 5.775477},
-//     .points[411] = {.x = 7.398190, .y = 44.868000, .z = 5.459137},
-//     .points[412] = {.x = 4.807360, .y = 40.670799, .z = 2.868307},
-//     .points[413] = {.x = 4.867440, .y = 36.873299, .z = 2.928386},
-//     .points[414] = {.x = 4.641490, .y = 48.265701, .z = 7.827368},
-//     .points[415] = {.x = 4.466040, .y = 44.868000, .z = 7.417267},
-//     .points[416] = {.x = 3.030930, .y = 40.670799, .z = 4.055647},
-//     .points[417] = {.x = 3.062420, .y = 36.873299, .z = 4.136466},
-//     .points[418] = {.x = 0.831025, .y = 48.265701, .z = 8.574388},
-//     .points[419] = {.x = 0.831025, .y = 44.868000, .z = 8.130238},
-//     .points[420] = {.x = 0.831025, .y = 40.670799, .z = 4.488227},
-//     .points[421] = {.x = 0.831025, .y = 36.873299, .z = 4.577056},
-//     .points[422] = {.x = -2.979440, .y = 48.265701, .z = 7.827368},
-//     .points[423] = {.x = -2.803990, .y = 44.868000, .z = 7.417267},
-//     .points[424] = {.x = -1.368880, .y = 40.670799, .z = 4.055647},
-//     .points[425] = {.x = -1.400370, .y = 36.873299, .z = 4.136466},
-//     .points[426] = {.x = -6.052480, .y = 48.265701, .z = 5.775477},
-//     .points[427] = {.x = -5.736140, .y = 44.868000, .z = 5.459137},
-//     .points[428] = {.x = -3.145310, .y = 40.670799, .z = 2.868307},
-//     .points[429] = {.x = -3.205390, .y = 36.873299, .z = 2.928386},
-//     .points[430] = {.x = -8.104370, .y = 48.265701, .z = 2.702438},
-//     .points[431] = {.x = -7.694270, .y = 44.868000, .z = 2.526987},
-//     .points[432] = {.x = -4.332650, .y = 40.670799, .z = 1.091877},
-//     .points[433] = {.x = -4.413470, .y = 36.873299, .z = 1.123366},
-//     .points[434] = {.x = -8.851390, .y = 48.265701, .z = -1.108032},
-//     .points[435] = {.x = -8.407240, .y = 44.868000, .z = -1.108033},
-//     .points[436] = {.x = -4.765230, .y = 40.670799, .z = -1.108033},
-//     .points[437] = {.x = -4.854060, .y = 36.873299, .z = -1.108034},
-//     .points[438] = {.x = -8.104370, .y = 48.265701, .z = -4.918492},
-//     .points[439] = {.x = -7.694270, .y = 44.868000, .z = -4.743043},
-//     .points[440] = {.x = -4.332650, .y = 40.670799, .z = -3.307933},
-//     .points[441] = {.x = -4.413470, .y = 36.873299, .z = -3.339424},
-//     .points[442] = {.x = -6.052480, .y = 48.265701, .z = -7.991532},
-//     .points[443] = {.x = -5.736140, .y = 44.868000, .z = -7.675193},
-//     .points[444] = {.x = -3.145310, .y = 40.670799, .z = -5.084363},
-//     .points[445] = {.x = -3.205390, .y = 36.873299, .z = -5.144444},
-//     .points[446] = {.x = -2.979440, .y = 48.265701, .z = -10.043392},
-//     .points[447] = {.x = -2.803990, .y = 44.868000, .z = -9.633323},
-//     .points[448] = {.x = -1.368880, .y = 40.670799, .z = -6.271703},
-//     .points[449] = {.x = -1.400370, .y = 36.873299, .z = -6.352524},
-//     .points[450] = {.x = 0.831025, .y = 48.265701, .z = -10.790392},
-//     .points[451] = {.x = 0.831025, .y = 44.868000, .z = -10.346292},
-//     .points[452] = {.x = 0.831025, .y = 40.670799, .z = -6.704283},
-//     .points[453] = {.x = 0.831025, .y = 36.873299, .z = -6.793114},
-//     .points[454] = {.x = 4.641490, .y = 48.265701, .z = -10.043392},
-//     .points[455] = {.x = 4.466040, .y = 44.868000, .z = -9.633323},
-//     .points[456] = {.x = 3.030930, .y = 40.670799, .z = -6.271703},
-//     .points[457] = {.x = 3.062420, .y = 36.873299, .z = -6.352524},
-//     .points[458] = {.x = 7.714530, .y = 48.265701, .z = -7.991532},
-//     .points[459] = {.x = 7.398190, .y = 44.868000, .z = -7.675193},
-//     .points[460] = {.x = 4.807360, .y = 40.670799, .z = -5.084363},
-//     .points[461] = {.x = 4.867440, .y = 36.873299, .z = -5.144444},
-//     .points[462] = {.x = 9.766420, .y = 48.265701, .z = -4.918492},
-//     .points[463] = {.x = 9.356320, .y = 44.868000, .z = -4.743043},
-//     .points[464] = {.x = 5.994700, .y = 40.670799, .z = -3.307933},
-//     .points[465] = {.x = 6.075520, .y = 36.873299, .z = -3.339424},
-//     .points[466] = {.x = 12.795000, .y = 34.341702, .z = 3.982346},
-//     .points[467] = {.x = 13.800100, .y = 34.341702, .z = -1.108034},
-//     .points[468] = {.x = 22.464600, .y = 32.609501, .z = 8.096476},
-//     .points[469] = {.x = 24.282000, .y = 32.609501, .z = -1.108035},
-//     .points[470] = {.x = 31.150700, .y = 30.877298, .z = 11.792205},
-//     .points[471] = {.x = 33.697899, .y = 30.877300, .z = -1.108035},
-//     .points[472] = {.x = 34.920200, .y = 28.345697, .z = 13.396005},
-//     .points[473] = {.x = 37.784100, .y = 28.345699, .z = -1.108035},
-//     .points[474] = {.x = 10.039100, .y = 34.341702, .z = 8.100036},
-//     .points[475] = {.x = 17.481199, .y = 32.609497, .z = 15.542206},
-//     .points[476] = {.x = 24.166500, .y = 30.877296, .z = 22.227507},
-//     .points[477] = {.x = 27.067699, .y = 28.345695, .z = 25.128603},
-//     .points[478] = {.x = 5.921400, .y = 34.341702, .z = 10.856006},
-//     .points[479] = {.x = 10.035500, .y = 32.609497, .z = 20.525505},
-//     .points[480] = {.x = 13.731300, .y = 30.877296, .z = 29.211706},
-//     .points[481] = {.x = 15.335100, .y = 28.345694, .z = 32.981205},
-//     .points[482] = {.x = 0.831025, .y = 34.341698, .z = 11.861106},
-//     .points[483] = {.x = 0.831025, .y = 32.609497, .z = 22.342905},
-//     .points[484] = {.x = 0.831025, .y = 30.877295, .z = 31.758905},
-//     .points[485] = {.x = 0.831025, .y = 28.345694, .z = 35.845005},
-//     .points[486] = {.x = -4.259350, .y = 34.341702, .z = 10.856006},
-//     .points[487] = {.x = -8.373480, .y = 32.609497, .z = 20.525505},
-//     .points[488] = {.x = -12.069200, .y = 30.877296, .z = 29.211706},
-//     .points[489] = {.x = -13.673000, .y = 28.345694, .z = 32.981205},
-//     .points[490] = {.x = -8.377040, .y = 34.341702, .z = 8.100036},
-//     .points[491] = {.x = -15.819200, .y = 32.609497, .z = 15.542206},
-//     .points[492] = {.x = -22.504499, .y = 30.877296, .z = 22.227507},
-//     .points[493] = {.x = -25.405600, .y = 28.345695, .z = 25.128603},
-//     .points[494] = {.x = -11.133000, .y = 34.341702, .z = 3.982346},
-//     .points[495] = {.x = -20.802500, .y = 32.609501, .z = 8.096476},
-//     .points[496] = {.x = -29.488701, .y = 30.877298, .z = 11.792205},
-//     .points[497] = {.x = -33.258202, .y = 28.345697, .z = 13.396005},
-//     .points[498] = {.x = -12.138100, .y = 34.341702, .z = -1.108034},
-//     .points[499] = {.x = -22.620001, .y = 32.609501, .z = -1.108035},
-//     .points[500] = {.x = -32.035900, .y = 30.877300, .z = -1.108035},
-//     .points[501] = {.x = -36.122002, .y = 28.345699, .z = -1.108035},
-//     .points[502] = {.x = -11.133000, .y = 34.341702, .z = -6.198404},
-//     .points[503] = {.x = -20.802500, .y = 32.609501, .z = -10.312494},
-//     .points[504] = {.x = -29.488701, .y = 30.877302, .z = -14.008295},
-//     .points[505] = {.x = -33.258202, .y = 28.345701, .z = -15.612095},
-//     .points[506] = {.x = -8.377040, .y = 34.341702, .z = -10.316094},
-//     .points[507] = {.x = -15.819200, .y = 32.609505, .z = -17.758194},
-//     .points[508] = {.x = -22.504499, .y = 30.877304, .z = -24.443495},
-//     .points[509] = {.x = -25.405600, .y = 28.345703, .z = -27.344696},
-//     .points[510] = {.x = -4.259350, .y = 34.341705, .z = -13.071994},
-//     .points[511] = {.x = -8.373480, .y = 32.609505, .z = -22.741594},
-//     .points[512] = {.x = -12.069200, .y = 30.877306, .z = -31.427694},
-//     .points[513] = {.x = -13.673000, .y = 28.345705, .z = -35.197197},
-//     .points[514] = {.x = 0.831025, .y = 34.341705, .z = -14.077094},
-//     .points[515] = {.x = 0.831025, .y = 32.609505, .z = -24.558994},
-//     .points[516] = {.x = 0.831025, .y = 30.877306, .z = -33.974895},
-//     .points[517] = {.x = 0.831025, .y = 28.345705, .z = -38.061096},
-//     .points[518] = {.x = 5.921400, .y = 34.341705, .z = -13.071994},
-//     .points[519] = {.x = 10.035500, .y = 32.609505, .z = -22.741594},
-//     .points[520] = {.x = 13.731300, .y = 30.877306, .z = -31.427694},
-//     .points[521] = {.x = 15.335100, .y = 28.345705, .z = -35.197197},
-//     .points[522] = {.x = 10.039100, .y = 34.341702, .z = -10.316094},
-//     .points[523] = {.x = 17.481199, .y = 32.609505, .z = -17.758194},
-//     .points[524] = {.x = 24.166500, .y = 30.877304, .z = -24.443495},
-//     .points[525] = {.x = 27.067699, .y = 28.345703, .z = -27.344696},
-//     .points[526] = {.x = 12.795000, .y = 34.341702, .z = -6.198404},
-//     .points[527] = {.x = 22.464600, .y = 32.609501, .z = -10.312494},
-//     .points[528] = {.x = 31.150700, .y = 30.877302, .z = -14.008295},
-//     .points[529] = {.x = 34.920200, .y = 28.345701, .z = -15.612095},
-//     .face1[0] = 1,
-//     .face2[0] = 2,
-//     .face3[0] = 3,
-//     .face1[1] = 4,
-//     .face2[1] = 1,
-//     .face3[1] = 3,
-//     .face1[2] = 5,
-//     .face2[2] = 1,
-//     .face3[2] = 4,
-//     .face1[3] = 4,
-//     .face2[3] = 6,
-//     .face3[3] = 5,
-//     .face1[4] = 7,
-//     .face2[4] = 5,
-//     .face3[4] = 6,
-//     .face1[5] = 6,
-//     .face2[5] = 8,
-//     .face3[5] = 7,
-//     .face1[6] = 9,
-//     .face2[6] = 7,
-//     .face3[6] = 8,
-//     .face1[7] = 8,
-//     .face2[7] = 10,
-//     .face3[7] = 9,
-//     .face1[8] = 11,
-//     .face2[8] = 12,
-//     .face3[8] = 2,
-//     .face1[9] = 2,
-//     .face2[9] = 1,
-//     .face3[9] = 11,
-//     .face1[10] = 11,
-//     .face2[10] = 1,
-//     .face3[10] = 13,
-//     .face1[11] = 1,
-//     .face2[11] = 5,
-//     .face3[11] = 13,
-//     .face1[12] = 14,
-//     .face2[12] = 13,
-//     .face3[12] = 5,
-//     .face1[13] = 5,
-//     .face2[13] = 7,
-//     .face3[13] = 14,
-//     .face1[14] = 15,
-//     .face2[14] = 14,
-//     .face3[14] = 7,
-//     .face1[15] = 7,
-//     .face2[15] = 9,
-//     .face3[15] = 15,
-//     .face1[16] = 16,
-//     .face2[16] = 17,
-//     .face3[16] = 12,
-//     .face1[17] = 12,
-//     .face2[17] = 11,
-//     .face3[17] = 16,
-//     .face1[18] = 18,
-//     .face2[18] = 16,
-//     .face3[18] = 11,
-//     .face1[19] = 11,
-//     .face2[19] = 13,
-//     .face3[19] = 18,
-//     .face1[20] = 19,
-//     .face2[20] = 18,
-//     .face3[20] = 13,
-//     .face1[21] = 13,
-//     .face2[21] = 14,
-//     .face3[21] = 19,
-//     .face1[22] = 20,
-//     .face2[22] = 19,
-//     .face3[22] = 14,
-//     .face1[23] = 14,
-//     .face2[23] = 15,
-//     .face3[23] = 20,
-//     .face1[24] = 21,
-//     .face2[24] = 22,
-//     .face3[24] = 17,
-//     .face1[25] = 17,
-//     .face2[25] = 16,
-//     .face3[25] = 21,
-//     .face1[26] = 23,
-//     .face2[26] = 21,
-//     .face3[26] = 16,
-//     .face1[27] = 16,
-//     .face2[27] = 18,
-//     .face3[27] = 23,
-//     .face1[28] = 24,
-//     .face2[28] = 23,
-//     .face3[28] = 18,
-//     .face1[29] = 18,
-//     .face2[29] = 19,
-//     .face3[29] = 24,
-//     .face1[30] = 25,
-//     .face2[30] = 24,
-//     .face3[30] = 19,
-//     .face1[31] = 19,
-//     .face2[31] = 20,
-//     .face3[31] = 25,
-//     .face1[32] = 26,
-//     .face2[32] = 27,
-//     .face3[32] = 22,
-//     .face1[33] = 22,
-//     .face2[33] = 21,
-//     .face3[33] = 26,
-//     .face1[34] = 28,
-//     .face2[34] = 26,
-//     .face3[34] = 21,
-//     .face1[35] = 21,
-//     .face2[35] = 23,
-//     .face3[35] = 28,
-//     .face1[36] = 29,
-//     .face2[36] = 28,
-//     .face3[36] = 23,
-//     .face1[37] = 23,
-//     .face2[37] = 24,
-//     .face3[37] = 29,
-//     .face1[38] = 30,
-//     .face2[38] = 29,
-//     .face3[38] = 24,
-//     .face1[39] = 24,
-//     .face2[39] = 25,
-//     .face3[39] = 30,
-//     .face1[40] = 31,
-//     .face2[40] = 32,
-//     .face3[40] = 27,
-//     .face1[41] = 27,
-//     .face2[41] = 26,
-//     .face3[41] = 31,
-//     .face1[42] = 33,
-//     .face2[42] = 31,
-//     .face3[42] = 26,
-//     .face1[43] = 26,
-//     .face2[43] = 28,
-//     .face3[43] = 33,
-//     .face1[44] = 34,
-//     .face2[44] = 33,
-//     .face3[44] = 28,
-//     .face1[45] = 28,
-//     .face2[45] = 29,
-//     .face3[45] = 34,
-//     .face1[46] = 35,
-//     .face2[46] = 34,
-//     .face3[46] = 29,
-//     .face1[47] = 29,
-//     .face2[47] = 30,
-//     .face3[47] = 35,
-//     .face1[48] = 36,
-//     .face2[48] = 37,
-//     .face3[48] = 32,
-//     .face1[49] = 32,
-//     .face2[49] = 31,
-//     .face3[49] = 36,
-//     .face1[50] = 38,
-//     .face2[50] = 36,
-//     .face3[50] = 31,
-//     .face1[51] = 31,
-//     .face2[51] = 33,
-//     .face3[51] = 38,
-//     .face1[52] = 39,
-//     .face2[52] = 38,
-//     .face3[52] = 33,
-//     .face1[53] = 33,
-//     .face2[53] = 34,
-//     .face3[53] = 39,
-//     .face1[54] = 40,
-//     .face2[54] = 39,
-//     .face3[54] = 34,
-//     .face1[55] = 34,
-//     .face2[55] = 35,
-//     .face3[55] = 40,
-//     .face1[56] = 41,
-//     .face2[56] = 42,
-//     .face3[56] = 37,
-//     .face1[57] = 37,
-//     .face2[57] = 36,
-//     .face3[57] = 41,
-//     .face1[58] = 43,
-//     .face2[58] = 41,
-//     .face3[58] = 36,
-//     .face1[59] = 36,
-//     .face2[59] = 38,
-//     .face3[59] = 43,
-//     .face1[60] = 44,
-//     .face2[60] = 43,
-//     .face3[60] = 38,
-//     .face1[61] = 38,
-//     .face2[61] = 39,
-//     .face3[61] = 44,
-//     .face1[62] = 45,
-//     .face2[62] = 44,
-//     .face3[62] = 39,
-//     .face1[63] = 39,
-//     .face2[63] = 40,
-//     .face3[63] = 45,
-//     .face1[64] = 46,
-//     .face2[64] = 47,
-//     .face3[64] = 42,
-//     .face1[65] = 42,
-//     .face2[65] = 41,
-//     .face3[65] = 46,
-//     .face1[66] = 48,
-//     .face2[66] = 46,
-//     .face3[66] = 41,
-//     .face1[67] = 41,
-//     .face2[67] = 43,
-//     .face3[67] = 48,
-//     .face1[68] = 49,
-//     .face2[68] = 48,
-//     .face3[68] = 43,
-//     .face1[69] = 43,
-//     .face2[69] = 44,
-//     .face3[69] = 49,
-//     .face1[70] = 50,
-//     .face2[70] = 49,
-//     .face3[70] = 44,
-//     .face1[71] = 44,
-//     .face2[71] = 45,
-//     .face3[71] = 50,
-//     .face1[72] = 51,
-//     .face2[72] = 52,
-//     .face3[72] = 47,
-//     .face1[73] = 47,
-//     .face2[73] = 46,
-//     .face3[73] = 51,
-//     .face1[74] = 53,
-//     .face2[74] = 51,
-//     .face3[74] = 46,
-//     .face1[75] = 46,
-//     .face2[75] = 48,
-//     .face3[75] = 53,
-//     .face1[76] = 54,
-//     .face2[76] = 53,
-//     .face3[76] = 48,
-//     .face1[77] = 48,
-//     .face2[77] = 49,
-//     .face3[77] = 54,
-//     .face1[78] = 55,
-//     .face2[78] = 54,
-//     .face3[78] = 49,
-//     .face1[79] = 49,
-//     .face2[79] = 50,
-//     .face3[79] = 55,
-//     .face1[80] = 56,
-//     .face2[80] = 57,
-//     .face3[80] = 52,
-//     .face1[81] = 52,
-//     .face2[81] = 51,
-//     .face3[81] = 56,
-//     .face1[82] = 58,
-//     .face2[82] = 56,
-//     .face3[82] = 51,
-//     .face1[83] = 51,
-//     .face2[83] = 53,
-//     .face3[83] = 58,
-//     .face1[84] = 59,
-//     .face2[84] = 58,
-//     .face3[84] = 53,
-//     .face1[85] = 53,
-//     .face2[85] = 54,
-//     .face3[85] = 59,
-//     .face1[86] = 60,
-//     .face2[86] = 59,
-//     .face3[86] = 54,
-//     .face1[87] = 54,
-//     .face2[87] = 55,
-//     .face3[87] = 60,
-//     .face1[88] = 61,
-//     .face2[88] = 62,
-//     .face3[88] = 57,
-//     .face1[89] = 57,
-//     .face2[89] = 56,
-//     .face3[89] = 61,
-//     .face1[90] = 63,
-//     .face2[90] = 61,
-//     .face3[90] = 56,
-//     .face1[91] = 56,
-//     .face2[91] = 58,
-//     .face3[91] = 63,
-//     .face1[92] = 64,
-//     .face2[92] = 63,
-//     .face3[92] = 58,
-//     .face1[93] = 58,
-//     .face2[93] = 59,
-//     .face3[93] = 64,
-//     .face1[94] = 65,
-//     .face2[94] = 64,
-//     .face3[94] = 59,
-//     .face1[95] = 59,
-//     .face2[95] = 60,
-//     .face3[95] = 65,
-//     .face1[96] = 66,
-//     .face2[96] = 67,
-//     .face3[96] = 62,
-//     .face1[97] = 62,
-//     .face2[97] = 61,
-//     .face3[97] = 66,
-//     .face1[98] = 68,
-//     .face2[98] = 66,
-//     .face3[98] = 61,
-//     .face1[99] = 61,
-//     .face2[99] = 63,
-//     .face3[99] = 68,
-//     .face1[100] = 69,
-//     .face2[100] = 68,
-//     .face3[100] = 63,
-//     .face1[101] = 63,
-//     .face2[101] = 64,
-//     .face3[101] = 69,
-//     .face1[102] = 70,
-//     .face2[102] = 69,
-//     .face3[102] = 64,
-//     .face1[103] = 64,
-//     .face2[103] = 65,
-//     .face3[103] = 70,
-//     .face1[104] = 71,
-//     .face2[104] = 72,
-//     .face3[104] = 67,
-//     .face1[105] = 67,
-//     .face2[105] = 66,
-//     .face3[105] = 71,
-//     .face1[106] = 73,
-//     .face2[106] = 71,
-//     .face3[106] = 66,
-//     .face1[107] = 66,
-//     .face2[107] = 68,
-//     .face3[107] = 73,
-//     .face1[108] = 74,
-//     .face2[108] = 73,
-//     .face3[108] = 68,
-//     .face1[109] = 68,
-//     .face2[109] = 69,
-//     .face3[109] = 74,
-//     .face1[110] = 75,
-//     .face2[110] = 74,
-//     .face3[110] = 69,
-//     .face1[111] = 69,
-//     .face2[111] = 70,
-//     .face3[111] = 75,
-//     .face1[112] = 76,
-//     .face2[112] = 77,
-//     .face3[112] = 72,
-//     .face1[113] = 72,
-//     .face2[113] = 71,
-//     .face3[113] = 76,
-//     .face1[114] = 78,
-//     .face2[114] = 76,
-//     .face3[114] = 71,
-//     .face1[115] = 71,
-//     .face2[115] = 73,
-//     .face3[115] = 78,
-//     .face1[116] = 79,
-//     .face2[116] = 78,
-//     .face3[116] = 73,
-//     .face1[117] = 73,
-//     .face2[117] = 74,
-//     .face3[117] = 79,
-//     .face1[118] = 80,
-//     .face2[118] = 79,
-//     .face3[118] = 74,
-//     .face1[119] = 74,
-//     .face2[119] = 75,
-//     .face3[119] = 80,
-//     .face1[120] = 4,
-//     .face2[120] = 3,
-//     .face3[120] = 77,
-//     .face1[121] = 77,
-//     .face2[121] = 76,
-//     .face3[121] = 4,
-//     .face1[122] = 6,
-//     .face2[122] = 4,
-//     .face3[122] = 76,
-//     .face1[123] = 76,
-//     .face2[123] = 78,
-//     .face3[123] = 6,
-//     .face1[124] = 8,
-//     .face2[124] = 6,
-//     .face3[124] = 78,
-//     .face1[125] = 78,
-//     .face2[125] = 79,
-//     .face3[125] = 8,
-//     .face1[126] = 10,
-//     .face2[126] = 8,
-//     .face3[126] = 79,
-//     .face1[127] = 79,
-//     .face2[127] = 80,
-//     .face3[127] = 10,
-//     .face1[128] = 81,
-//     .face2[128] = 9,
-//     .face3[128] = 10,
-//     .face1[129] = 10,
-//     .face2[129] = 82,
-//     .face3[129] = 81,
-//     .face1[130] = 83,
-//     .face2[130] = 81,
-//     .face3[130] = 82,
-//     .face1[131] = 82,
-//     .face2[131] = 84,
-//     .face3[131] = 83,
-//     .face1[132] = 85,
-//     .face2[132] = 83,
-//     .face3[132] = 84,
-//     .face1[133] = 84,
-//     .face2[133] = 86,
-//     .face3[133] = 85,
-//     .face1[134] = 87,
-//     .face2[134] = 85,
-//     .face3[134] = 86,
-//     .face1[135] = 86,
-//     .face2[135] = 88,
-//     .face3[135] = 87,
-//     .face1[136] = 89,
-//     .face2[136] = 15,
-//     .face3[136] = 9,
-//     .face1[137] = 9,
-//     .face2[137] = 81,
-//     .face3[137] = 89,
-//     .face1[138] = 90,
-//     .face2[138] = 89,
-//     .face3[138] = 81,
-//     .face1[139] = 81,
-//     .face2[139] = 83,
-//     .face3[139] = 90,
-//     .face1[140] = 91,
-//     .face2[140] = 90,
-//     .face3[140] = 83,
-//     .face1[141] = 83,
-//     .face2[141] = 85,
-//     .face3[141] = 91,
-//     .face1[142] = 92,
-//     .face2[142] = 91,
-//     .face3[142] = 85,
-//     .face1[143] = 85,
-//     .face2[143] = 87,
-//     .face3[143] = 92,
-//     .face1[144] = 93,
-//     .face2[144] = 20,
-//     .face3[144] = 15,
-//     .face1[145] = 15,
-//     .face2[145] = 89,
-//     .face3[145] = 93,
-//     .face1[146] = 94,
-//     .face2[146] = 93,
-//     .face3[146] = 89,
-//     .face1[147] = 89,
-//     .face2[147] = 90,
-//     .face3[147] = 94,
-//     .face1[148] = 95,
-//     .face2[148] = 94,
-//     .face3[148] = 90,
-//     .face1[149] = 90,
-//     .face2[149] = 91,
-//     .face3[149] = 95,
-//     .face1[150] = 96,
-//     .face2[150] = 95,
-//     .face3[150] = 91,
-//     .face1[151] = 91,
-//     .face2[151] = 92,
-//     .face3[151] = 96,
-//     .face1[152] = 97,
-//     .face2[152] = 25,
-//     .face3[152] = 20,
-//     .face1[153] = 20,
-//     .face2[153] = 93,
-//     .face3[153] = 97,
-//     .face1[154] = 98,
-//     .face2[154] = 97,
-//     .face3[154] = 93,
-//     .face1[155] = 93,
-//     .face2[155] = 94,
-//     .face3[155] = 98,
-//     .face1[156] = 99,
-//     .face2[156] = 98,
-//     .face3[156] = 94,
-//     .face1[157] = 94,
-//     .face2[157] = 95,
-//     .face3[157] = 99,
-//     .face1[158] = 100,
-//     .face2[158] = 99,
-//     .face3[158] = 95,
-//     .face1[159] = 95,
-//     .face2[159] = 96,
-//     .face3[159] = 100,
-//     .face1[160] = 101,
-//     .face2[160] = 30,
-//     .face3[160] = 25,
-//     .face1[161] = 25,
-//     .face2[161] = 97,
-//     .face3[161] = 101,
-//     .face1[162] = 102,
-//     .face2[162] = 101,
-//     .face3[162] = 97,
-//     .face1[163] = 97,
-//     .face2[163] = 98,
-//     .face3[163] = 102,
-//     .face1[164] = 103,
-//     .face2[164] = 102,
-//     .face3[164] = 98,
-//     .face1[165] = 98,
-//     .face2[165] = 99,
-//     .face3[165] = 103,
-//     .face1[166] = 104,
-//     .face2[166] = 103,
-//     .face3[166] = 99,
-//     .face1[167] = 99,
-//     .face2[167] = 100,
-//     .face3[167] = 104,
-//     .face1[168] = 105,
-//     .face2[168] = 35,
-//     .face3[168] = 30,
-//     .face1[169] = 30,
-//     .face2[169] = 101,
-//     .face3[169] = 105,
-//     .face1[170] = 106,
-//     .face2[170] = 105,
-//     .face3[170] = 101,
-//     .face1[171] = 101,
-//     .face2[171] = 102,
-//     .face3[171] = 106,
-//     .face1[172] = 107,
-//     .face2[172] = 106,
-//     .face3[172] = 102,
-//     .face1[173] = 102,
-//     .face2[173] = 103,
-//     .face3[173] = 107,
-//     .face1[174] = 108,
-//     .face2[174] = 107,
-//     .face3[174] = 103,
-//     .face1[175] = 103,
-//     .face2[175] = 104,
-//     .face3[175] = 108,
-//     .face1[176] = 109,
-//     .face2[176] = 40,
-//     .face3[176] = 35,
-//     .face1[177] = 35,
-//     .face2[177] = 105,
-//     .face3[177] = 109,
-//     .face1[178] = 110,
-//     .face2[178] = 109,
-//     .face3[178] = 105,
-//     .face1[179] = 105,
-//     .face2[179] = 106,
-//     .face3[179] = 110,
-//     .face1[180] = 111,
-//     .face2[180] = 110,
-//     .face3[180] = 106,
-//     .face1[181] = 106,
-//     .face2[181] = 107,
-//     .face3[181] = 111,
-//     .face1[182] = 112,
-//     .face2[182] = 111,
-//     .face3[182] = 107,
-//     .face1[183] = 107,
-//     .face2[183] = 108,
-//     .face3[183] = 112,
-//     .face1[184] = 113,
-//     .face2[184] = 45,
-//     .face3[184] = 40,
-//     .face1[185] = 40,
-//     .face2[185] = 109,
-//     .face3[185] = 113,
-//     .face1[186] = 114,
-//     .face2[186] = 113,
-//     .face3[186] = 109,
-//     .face1[187] = 109,
-//     .face2[187] = 110,
-//     .face3[187] = 114,
-//     .face1[188] = 115,
-//     .face2[188] = 114,
-//     .face3[188] = 110,
-//     .face1[189] = 110,
-//     .face2[189] = 111,
-//     .face3[189] = 115,
-//     .face1[190] = 116,
-//     .face2[190] = 115,
-//     .face3[190] = 111,
-//     .face1[191] = 111,
-//     .face2[191] = 112,
-//     .face3[191] = 116,
-//     .face1[192] = 117,
-//     .face2[192] = 50,
-//     .face3[192] = 45,
-//     .face1[193] = 45,
-//     .face2[193] = 113,
-//     .face3[193] = 117,
-//     .face1[194] = 118,
-//     .face2[194] = 117,
-//     .face3[194] = 113,
-//     .face1[195] = 113,
-//     .face2[195] = 114,
-//     .face3[195] = 118,
-//     .face1[196] = 119,
-//     .face2[196] = 118,
-//     .face3[196] = 114,
-//     .face1[197] = 114,
-//     .face2[197] = 115,
-//     .face3[197] = 119,
-//     .face1[198] = 120,
-//     .face2[198] = 119,
-//     .face3[198] = 115,
-//     .face1[199] = 115,
-//     .face2[199] = 116,
-//     .face3[199] = 120,
-//     .face1[200] = 121,
-//     .face2[200] = 55,
-//     .face3[200] = 50,
-//     .face1[201] = 50,
-//     .face2[201] = 117,
-//     .face3[201] = 121,
-//     .face1[202] = 122,
-//     .face2[202] = 121,
-//     .face3[202] = 117,
-//     .face1[203] = 117,
-//     .face2[203] = 118,
-//     .face3[203] = 122,
-//     .face1[204] = 123,
-//     .face2[204] = 122,
-//     .face3[204] = 118,
-//     .face1[205] = 118,
-//     .face2[205] = 119,
-//     .face3[205] = 123,
-//     .face1[206] = 124,
-//     .face2[206] = 123,
-//     .face3[206] = 119,
-//     .face1[207] = 119,
-//     .face2[207] = 120,
-//     .face3[207] = 124,
-//     .face1[208] = 125,
-//     .face2[208] = 60,
-//     .face3[208] = 55,
-//     .face1[209] = 55,
-//     .face2[209] = 121,
-//     .face3[209] = 125,
-//     .face1[210] = 126,
-//     .face2[210] = 125,
-//     .face3[210] = 121,
-//     .face1[211] = 121,
-//     .face2[211] = 122,
-//     .face3[211] = 126,
-//     .face1[212] = 127,
-//     .face2[212] = 126,
-//     .face3[212] = 122,
-//     .face1[213] = 122,
-//     .face2[213] = 123,
-//     .face3[213] = 127,
-//     .face1[214] = 128,
-//     .face2[214] = 127,
-//     .face3[214] = 123,
-//     .face1[215] = 123,
-//     .face2[215] = 124,
-//     .face3[215] = 128,
-//     .face1[216] = 129,
-//     .face2[216] = 65,
-//     .face3[216] = 60,
-//     .face1[217] = 60,
-//     .face2[217] = 125,
-//     .face3[217] = 129,
-//     .face1[218] = 130,
-//     .face2[218] = 129,
-//     .face3[218] = 125,
-//     .face1[219] = 125,
-//     .face2[219] = 126,
-//     .face3[219] = 130,
-//     .face1[220] = 131,
-//     .face2[220] = 130,
-//     .face3[220] = 126,
-//     .face1[221] = 126,
-//     .face2[221] = 127,
-//     .face3[221] = 131,
-//     .face1[222] = 132,
-//     .face2[222] = 131,
-//     .face3[222] = 127,
-//     .face1[223] = 127,
-//     .face2[223] = 128,
-//     .face3[223] = 132,
-//     .face1[224] = 133,
-//     .face2[224] = 70,
-//     .face3[224] = 65,
-//     .face1[225] = 65,
-//     .face2[225] = 129,
-//     .face3[225] = 133,
-//     .face1[226] = 134,
-//     .face2[226] = 133,
-//     .face3[226] = 129,
-//     .face1[227] = 129,
-//     .face2[227] = 130,
-//     .face3[227] = 134,
-//     .face1[228] = 135,
-//     .face2[228] = 134,
-//     .face3[228] = 130,
-//     .face1[229] = 130,
-//     .face2[229] = 131,
-//     .face3[229] = 135,
-//     .face1[230] = 136,
-//     .face2[230] = 135,
-//     .face3[230] = 131,
-//     .face1[231] = 131,
-//     .face2[231] = 132,
-//     .face3[231] = 136,
-//     .face1[232] = 137,
-//     .face2[232] = 75,
-//     .face3[232] = 70,
-//     .face1[233] = 70,
-//     .face2[233] = 133,
-//     .face3[233] = 137,
-//     .face1[234] = 138,
-//     .face2[234] = 137,
-//     .face3[234] = 133,
-//     .face1[235] = 133,
-//     .face2[235] = 134,
-//     .face3[235] = 138,
-//     .face1[236] = 139,
-//     .face2[236] = 138,
-//     .face3[236] = 134,
-//     .face1[237] = 134,
-//     .face2[237] = 135,
-//     .face3[237] = 139,
-//     .face1[238] = 140,
-//     .face2[238] = 139,
-//     .face3[238] = 135,
-//     .face1[239] = 135,
-//     .face2[239] = 136,
-//     .face3[239] = 140,
-//     .face1[240] = 141,
-//     .face2[240] = 80,
-//     .face3[240] = 75,
-//     .face1[241] = 75,
-//     .face2[241] = 137,
-//     .face3[241] = 141,
-//     .face1[242] = 142,
-//     .face2[242] = 141,
-//     .face3[242] = 137,
-//     .face1[243] = 137,
-//     .face2[243] = 138,
-//     .face3[243] = 142,
-//     .face1[244] = 143,
-//     .face2[244] = 142,
-//     .face3[244] = 138,
-//     .face1[245] = 138,
-//     .face2[245] = 139,
-//     .face3[245] = 143,
-//     .face1[246] = 144,
-//     .face2[246] = 143,
-//     .face3[246] = 139,
-//     .face1[247] = 139,
-//     .face2[247] = 140,
-//     .face3[247] = 144,
-//     .face1[248] = 82,
-//     .face2[248] = 10,
-//     .face3[248] = 80,
-//     .face1[249] = 80,
-//     .face2[249] = 141,
-//     .face3[249] = 82,
-//     .face1[250] = 84,
-//     .face2[250] = 82,
-//     .face3[250] = 141,
-//     .face1[251] = 141,
-//     .face2[251] = 142,
-//     .face3[251] = 84,
-//     .face1[252] = 86,
-//     .face2[252] = 84,
-//     .face3[252] = 142,
-//     .face1[253] = 142,
-//     .face2[253] = 143,
-//     .face3[253] = 86,
-//     .face1[254] = 88,
-//     .face2[254] = 86,
-//     .face3[254] = 143,
-//     .face1[255] = 143,
-//     .face2[255] = 144,
-//     .face3[255] = 88,
-//     .face1[256] = 145,
-//     .face2[256] = 87,
-//     .face3[256] = 88,
-//     .face1[257] = 88,
-//     .face2[257] = 146,
-//     .face3[257] = 145,
-//     .face1[258] = 147,
-//     .face2[258] = 145,
-//     .face3[258] = 146,
-//     .face1[259] = 146,
-//     .face2[259] = 148,
-//     .face3[259] = 147,
-//     .face1[260] = 149,
-//     .face2[260] = 147,
-//     .face3[260] = 148,
-//     .face1[261] = 148,
-//     .face2[261] = 150,
-//     .face3[261] = 149,
-//     .face1[262] = 151,
-//     .face2[262] = 149,
-//     .face3[262] = 150,
-//     .face1[263] = 150,
-//     .face2[263] = 152,
-//     .face3[263] = 151,
-//     .face1[264] = 153,
-//     .face2[264] = 92,
-//     .face3[264] = 87,
-//     .face1[265] = 87,
-//     .face2[265] = 145,
-//     .face3[265] = 153,
-//     .face1[266] = 154,
-//     .face2[266] = 153,
-//     .face3[266] = 145,
-//     .face1[267] = 145,
-//     .face2[267] = 147,
-//     .face3[267] = 154,
-//     .face1[268] = 155,
-//     .face2[268] = 154,
-//     .face3[268] = 147,
-//     .face1[269] = 147,
-//     .face2[269] = 149,
-//     .face3[269] = 155,
-//     .face1[270] = 156,
-//     .face2[270] = 155,
-//     .face3[270] = 149,
-//     .face1[271] = 149,
-//     .face2[271] = 151,
-//     .face3[271] = 156,
-//     .face1[272] = 157,
-//     .face2[272] = 96,
-//     .face3[272] = 92,
-//     .face1[273] = 92,
-//     .face2[273] = 153,
-//     .face3[273] = 157,
-//     .face1[274] = 158,
-//     .face2[274] = 157,
-//     .face3[274] = 153,
-//     .face1[275] = 153,
-//     .face2[275] = 154,
-//     .face3[275] = 158,
-//     .face1[276] = 159,
-//     .face2[276] = 158,
-//     .face3[276] = 154,
-//     .face1[277] = 154,
-//     .face2[277] = 155,
-//     .face3[277] = 159,
-//     .face1[278] = 160,
-//     .face2[278] = 159,
-//     .face3[278] = 155,
-//     .face1[279] = 155,
-//     .face2[279] = 156,
-//     .face3[279] = 160,
-//     .face1[280] = 161,
-//     .face2[280] = 100,
-//     .face3[280] = 96,
-//     .face1[281] = 96,
-//     .face2[281] = 157,
-//     .face3[281] = 161,
-//     .face1[282] = 162,
-//     .face2[282] = 161,
-//     .face3[282] = 157,
-//     .face1[283] = 157,
-//     .face2[283] = 158,
-//     .face3[283] = 162,
-//     .face1[284] = 163,
-//     .face2[284] = 162,
-//     .face3[284] = 158,
-//     .face1[285] = 158,
-//     .face2[285] = 159,
-//     .face3[285] = 163,
-//     .face1[286] = 164,
-//     .face2[286] = 163,
-//     .face3[286] = 159,
-//     .face1[287] = 159,
-//     .face2[287] = 160,
-//     .face3[287] = 164,
-//     .face1[288] = 165,
-//     .face2[288] = 104,
-//     .face3[288] = 100,
-//     .face1[289] = 100,
-//     .face2[289] = 161,
-//     .face3[289] = 165,
-//     .face1[290] = 166,
-//     .face2[290] = 165,
-//     .face3[290] = 161,
-//     .face1[291] = 161,
-//     .face2[291] = 162,
-//     .face3[291] = 166,
-//     .face1[292] = 167,
-//     .face2[292] = 166,
-//     .face3[292] = 162,
-//     .face1[293] = 162,
-//     .face2[293] = 163,
-//     .face3[293] = 167,
-//     .face1[294] = 168,
-//     .face2[294] = 167,
-//     .face3[294] = 163,
-//     .face1[295] = 163,
-//     .face2[295] = 164,
-//     .face3[295] = 168,
-//     .face1[296] = 169,
-//     .face2[296] = 108,
-//     .face3[296] = 104,
-//     .face1[297] = 104,
-//     .face2[297] = 165,
-//     .face3[297] = 169,
-//     .face1[298] = 170,
-//     .face2[298] = 169,
-//     .face3[298] = 165,
-//     .face1[299] = 165,
-//     .face2[299] = 166,
-//     .face3[299] = 170,
-//     .face1[300] = 171,
-//     .face2[300] = 170,
-//     .face3[300] = 166,
-//     .face1[301] = 166,
-//     .face2[301] = 167,
-//     .face3[301] = 171,
-//     .face1[302] = 172,
-//     .face2[302] = 171,
-//     .face3[302] = 167,
-//     .face1[303] = 167,
-//     .face2[303] = 168,
-//     .face3[303] = 172,
-//     .face1[304] = 173,
-//     .face2[304] = 112,
-//     .face3[304] = 108,
-//     .face1[305] = 108,
-//     .face2[305] = 169,
-//     .face3[305] = 173,
-//     .face1[306] = 174,
-//     .face2[306] = 173,
-//     .face3[306] = 169,
-//     .face1[307] = 169,
-//     .face2[307] = 170,
-//     .face3[307] = 174,
-//     .face1[308] = 175,
-//     .face2[308] = 174,
-//     .face3[308] = 170,
-//     .face1[309] = 170,
-//     .face2[309] = 171,
-//     .face3[309] = 175,
-//     .face1[310] = 176,
-//     .face2[310] = 175,
-//     .face3[310] = 171,
-//     .face1[311] = 171,
-//     .face2[311] = 172,
-//     .face3[311] = 176,
-//     .face1[312] = 177,
-//     .face2[312] = 116,
-//     .face3[312] = 112,
-//     .face1[313] = 112,
-//     .face2[313] = 173,
-//     .face3[313] = 177,
-//     .face1[314] = 178,
-//     .face2[314] = 177,
-//     .face3[314] = 173,
-//     .face1[315] = 173,
-//     .face2[315] = 174,
-//     .face3[315] = 178,
-//     .face1[316] = 179,
-//     .face2[316] = 178,
-//     .face3[316] = 174,
-//     .face1[317] = 174,
-//     .face2[317] = 175,
-//     .face3[317] = 179,
-//     .face1[318] = 180,
-//     .face2[318] = 179,
-//     .face3[318] = 175,
-//     .face1[319] = 175,
-//     .face2[319] = 176,
-//     .face3[319] = 180,
-//     .face1[320] = 181,
-//     .face2[320] = 120,
-//     .face3[320] = 116,
-//     .face1[321] = 116,
-//     .face2[321] = 177,
-//     .face3[321] = 181,
-//     .face1[322] = 182,
-//     .face2[322] = 181,
-//     .face3[322] = 177,
-//     .face1[323] = 177,
-//     .face2[323] = 178,
-//     .face3[323] = 182,
-//     .face1[324] = 183,
-//     .face2[324] = 182,
-//     .face3[324] = 178,
-//     .face1[325] = 178,
-//     .face2[325] = 179,
-//     .face3[325] = 183,
-//     .face1[326] = 184,
-//     .face2[326] = 183,
-//     .face3[326] = 179,
-//     .face1[327] = 179,
-//     .face2[327] = 180,
-//     .face3[327] = 184,
-//     .face1[328] = 185,
-//     .face2[328] = 124,
-//     .face3[328] = 120,
-//     .face1[329] = 120,
-//     .face2[329] = 181,
-//     .face3[329] = 185,
-//     .face1[330] = 186,
-//     .face2[330] = 185,
-//     .face3[330] = 181,
-//     .face1[331] = 181,
-//     .face2[331] = 182,
-//     .face3[331] = 186,
-//     .face1[332] = 187,
-//     .face2[332] = 186,
-//     .face3[332] = 182,
-//     .face1[333] = 182,
-//     .face2[333] = 183,
-//     .face3[333] = 187,
-//     .face1[334] = 188,
-//     .face2[334] = 187,
-//     .face3[334] = 183,
-//     .face1[335] = 183,
-//     .face2[335] = 184,
-//     .face3[335] = 188,
-//     .face1[336] = 189,
-//     .face2[336] = 128,
-//     .face3[336] = 124,
-//     .face1[337] = 124,
-//     .face2[337] = 185,
-//     .face3[337] = 189,
-//     .face1[338] = 190,
-//     .face2[338] = 189,
-//     .face3[338] = 185,
-//     .face1[339] = 185,
-//     .face2[339] = 186,
-//     .face3[339] = 190,
-//     .face1[340] = 191,
-//     .face2[340] = 190,
-//     .face3[340] = 186,
-//     .face1[341] = 186,
-//     .face2[341] = 187,
-//     .face3[341] = 191,
-//     .face1[342] = 192,
-//     .face2[342] = 191,
-//     .face3[342] = 187,
-//     .face1[343] = 187,
-//     .face2[343] = 188,
-//     .face3[343] = 192,
-//     .face1[344] = 193,
-//     .face2[344] = 132,
-//     .face3[344] = 128,
-//     .face1[345] = 128,
-//     .face2[345] = 189,
-//     .face3[345] = 193,
-//     .face1[346] = 194,
-//     .face2[346] = 193,
-//     .face3[346] = 189,
-//     .face1[347] = 189,
-//     .face2[347] = 190,
-//     .face3[347] = 194,
-//     .face1[348] = 195,
-//     .face2[348] = 194,
-//     .face3[348] = 190,
-//     .face1[349] = 190,
-//     .face2[349] = 191,
-//     .face3[349] = 195,
-//     .face1[350] = 196,
-//     .face2[350] = 195,
-//     .face3[350] = 191,
-//     .face1[351] = 191,
-//     .face2[351] = 192,
-//     .face3[351] = 196,
-//     .face1[352] = 197,
-//     .face2[352] = 136,
-//     .face3[352] = 132,
-//     .face1[353] = 132,
-//     .face2[353] = 193,
-//     .face3[353] = 197,
-//     .face1[354] = 198,
-//     .face2[354] = 197,
-//     .face3[354] = 193,
-//     .face1[355] = 193,
-//     .face2[355] = 194,
-//     .face3[355] = 198,
-//     .face1[356] = 199,
-//     .face2[356] = 198,
-//     .face3[356] = 194,
-//     .face1[357] = 194,
-//     .face2[357] = 195,
-//     .face3[357] = 199,
-//     .face1[358] = 200,
-//     .face2[358] = 199,
-//     .face3[358] = 195,
-//     .face1[359] = 195,
-//     .face2[359] = 196,
-//     .face3[359] = 200,
-//     .face1[360] = 201,
-//     .face2[360] = 140,
-//     .face3[360] = 136,
-//     .face1[361] = 136,
-//     .face2[361] = 197,
-//     .face3[361] = 201,
-//     .face1[362] = 202,
-//     .face2[362] = 201,
-//     .face3[362] = 197,
-//     .face1[363] = 197,
-//     .face2[363] = 198,
-//     .face3[363] = 202,
-//     .face1[364] = 203,
-//     .face2[364] = 202,
-//     .face3[364] = 198,
-//     .face1[365] = 198,
-//     .face2[365] = 199,
-//     .face3[365] = 203,
-//     .face1[366] = 204,
-//     .face2[366] = 203,
-//     .face3[366] = 199,
-//     .face1[367] = 199,
-//     .face2[367] = 200,
-//     .face3[367] = 204,
-//     .face1[368] = 205,
-//     .face2[368] = 144,
-//     .face3[368] = 140,
-//     .face1[369] = 140,
-//     .face2[369] = 201,
-//     .face3[369] = 205,
-//     .face1[370] = 206,
-//     .face2[370] = 205,
-//     .face3[370] = 201,
-//     .face1[371] = 201,
-//     .face2[371] = 202,
-//     .face3[371] = 206,
-//     .face1[372] = 207,
-//     .face2[372] = 206,
-//     .face3[372] = 202,
-//     .face1[373] = 202,
-//     .face2[373] = 203,
-//     .face3[373] = 207,
-//     .face1[374] = 208,
-//     .face2[374] = 207,
-//     .face3[374] = 203,
-//     .face1[375] = 203,
-//     .face2[375] = 204,
-//     .face3[375] = 208,
-//     .face1[376] = 146,
-//     .face2[376] = 88,
-//     .face3[376] = 144,
-//     .face1[377] = 144,
-//     .face2[377] = 205,
-//     .face3[377] = 146,
-//     .face1[378] = 148,
-//     .face2[378] = 146,
-//     .face3[378] = 205,
-//     .face1[379] = 205,
-//     .face2[379] = 206,
-//     .face3[379] = 148,
-//     .face1[380] = 150,
-//     .face2[380] = 148,
-//     .face3[380] = 206,
-//     .face1[381] = 206,
-//     .face2[381] = 207,
-//     .face3[381] = 150,
-//     .face1[382] = 152,
-//     .face2[382] = 150,
-//     .face3[382] = 207,
-//     .face1[383] = 207,
-//     .face2[383] = 208,
-//     .face3[383] = 152,
-//     .face1[384] = 209,
-//     .face2[384] = 151,
-//     .face3[384] = 152,
-//     .face1[385] = 152,
-//     .face2[385] = 210,
-//     .face3[385] = 209,
-//     .face1[386] = 211,
-//     .face2[386] = 209,
-//     .face3[386] = 210,
-//     .face1[387] = 210,
-//     .face2[387] = 212,
-//     .face3[387] = 211,
-//     .face1[388] = 213,
-//     .face2[388] = 211,
-//     .face3[388] = 212,
-//     .face1[389] = 212,
-//     .face2[389] = 214,
-//     .face3[389] = 213,
-//     .face1[390] = 215,
-//     .face2[390] = 213,
-//     .face3[390] = 214,
-//     .face1[391] = 216,
-//     .face2[391] = 156,
-//     .face3[391] = 151,
-//     .face1[392] = 151,
-//     .face2[392] = 209,
-//     .face3[392] = 216,
-//     .face1[393] = 217,
-//     .face2[393] = 216,
-//     .face3[393] = 209,
-//     .face1[394] = 209,
-//     .face2[394] = 211,
-//     .face3[394] = 217,
-//     .face1[395] = 218,
-//     .face2[395] = 217,
-//     .face3[395] = 211,
-//     .face1[396] = 211,
-//     .face2[396] = 213,
-//     .face3[396] = 218,
-//     .face1[397] = 215,
-//     .face2[397] = 218,
-//     .face3[397] = 213,
-//     .face1[398] = 219,
-//     .face2[398] = 160,
-//     .face3[398] = 156,
-//     .face1[399] = 156,
-//     .face2[399] = 216,
-//     .face3[399] = 219,
-//     .face1[400] = 220,
-//     .face2[400] = 219,
-//     .face3[400] = 216,
-//     .face1[401] = 216,
-//     .face2[401] = 217,
-//     .face3[401] = 220,
-//     .face1[402] = 221,
-//     .face2[402] = 220,
-//     .face3[402] = 217,
-//     .face1[403] = 217,
-//     .face2[403] = 218,
-//     .face3[403] = 221,
-//     .face1[404] = 215,
-//     .face2[404] = 221,
-//     .face3[404] = 218,
-//     .face1[405] = 222,
-//     .face2[405] = 164,
-//     .face3[405] = 160,
-//     .face1[406] = 160,
-//     .face2[406] = 219,
-//     .face3[406] = 222,
-//     .face1[407] = 223,
-//     .face2[407] = 222,
-//     .face3[407] = 219,
-//     .face1[408] = 219,
-//     .face2[408] = 220,
-//     .face3[408] = 223,
-//     .face1[409] = 224,
-//     .face2[409] = 223,
-//     .face3[409] = 220,
-//     .face1[410] = 220,
-//     .face2[410] = 221,
-//     .face3[410] = 224,
-//     .face1[411] = 215,
-//     .face2[411] = 224,
-//     .face3[411] = 221,
-//     .face1[412] = 225,
-//     .face2[412] = 168,
-//     .face3[412] = 164,
-//     .face1[413] = 164,
-//     .face2[413] = 222,
-//     .face3[413] = 225,
-//     .face1[414] = 226,
-//     .face2[414] = 225,
-//     .face3[414] = 222,
-//     .face1[415] = 222,
-//     .face2[415] = 223,
-//     .face3[415] = 226,
-//     .face1[416] = 227,
-//     .face2[416] = 226,
-//     .face3[416] = 223,
-//     .face1[417] = 223,
-//     .face2[417] = 224,
-//     .face3[417] = 227,
-//     .face1[418] = 215,
-//     .face2[418] = 227,
-//     .face3[418] = 224,
-//     .face1[419] = 228,
-//     .face2[419] = 172,
-//     .face3[419] = 168,
-//     .face1[420] = 168,
-//     .face2[420] = 225,
-//     .face3[420] = 228,
-//     .face1[421] = 229,
-//     .face2[421] = 228,
-//     .face3[421] = 225,
-//     .face1[422] = 225,
-//     .face2[422] = 226,
-//     .face3[422] = 229,
-//     .face1[423] = 230,
-//     .face2[423] = 229,
-//     .face3[423] = 226,
-//     .face1[424] = 226,
-//     .face2[424] = 227,
-//     .face3[424] = 230,
-//     .face1[425] = 215,
-//     .face2[425] = 230,
-//     .face3[425] = 227,
-//     .face1[426] = 231,
-//     .face2[426] = 176,
-//     .face3[426] = 172,
-//     .face1[427] = 172,
-//     .face2[427] = 228,
-//     .face3[427] = 231,
-//     .face1[428] = 232,
-//     .face2[428] = 231,
-//     .face3[428] = 228,
-//     .face1[429] = 228,
-//     .face2[429] = 229,
-//     .face3[429] = 232,
-//     .face1[430] = 233,
-//     .face2[430] = 232,
-//     .face3[430] = 229,
-//     .face1[431] = 229,
-//     .face2[431] = 230,
-//     .face3[431] = 233,
-//     .face1[432] = 215,
-//     .face2[432] = 233,
-//     .face3[432] = 230,
-//     .face1[433] = 234,
-//     .face2[433] = 180,
-//     .face3[433] = 176,
-//     .face1[434] = 176,
-//     .face2[434] = 231,
-//     .face3[434] = 234,
-//     .face1[435] = 235,
-//     .face2[435] = 234,
-//     .face3[435] = 231,
-//     .face1[436] = 231,
-//     .face2[436] = 232,
-//     .face3[436] = 235,
-//     .face1[437] = 236,
-//     .face2[437] = 235,
-//     .face3[437] = 232,
-//     .face1[438] = 232,
-//     .face2[438] = 233,
-//     .face3[438] = 236,
-//     .face1[439] = 215,
-//     .face2[439] = 236,
-//     .face3[439] = 233,
-//     .face1[440] = 237,
-//     .face2[440] = 184,
-//     .face3[440] = 180,
-//     .face1[441] = 180,
-//     .face2[441] = 234,
-//     .face3[441] = 237,
-//     .face1[442] = 238,
-//     .face2[442] = 237,
-//     .face3[442] = 234,
-//     .face1[443] = 234,
-//     .face2[443] = 235,
-//     .face3[443] = 238,
-//     .face1[444] = 239,
-//     .face2[444] = 238,
-//     .face3[444] = 235,
-//     .face1[445] = 235,
-//     .face2[445] = 236,
-//     .face3[445] = 239,
-//     .face1[446] = 215,
-//     .face2[446] = 239,
-//     .face3[446] = 236,
-//     .face1[447] = 240,
-//     .face2[447] = 188,
-//     .face3[447] = 184,
-//     .face1[448] = 184,
-//     .face2[448] = 237,
-//     .face3[448] = 240,
-//     .face1[449] = 241,
-//     .face2[449] = 240,
-//     .face3[449] = 237,
-//     .face1[450] = 237,
-//     .face2[450] = 238,
-//     .face3[450] = 241,
-//     .face1[451] = 242,
-//     .face2[451] = 241,
-//     .face3[451] = 238,
-//     .face1[452] = 238,
-//     .face2[452] = 239,
-//     .face3[452] = 242,
-//     .face1[453] = 215,
-//     .face2[453] = 242,
-//     .face3[453] = 239,
-//     .face1[454] = 243,
-//     .face2[454] = 192,
-//     .face3[454] = 188,
-//     .face1[455] = 188,
-//     .face2[455] = 240,
-//     .face3[455] = 243,
-//     .face1[456] = 244,
-//     .face2[456] = 243,
-//     .face3[456] = 240,
-//     .face1[457] = 240,
-//     .face2[457] = 241,
-//     .face3[457] = 244,
-//     .face1[458] = 245,
-//     .face2[458] = 244,
-//     .face3[458] = 241,
-//     .face1[459] = 241,
-//     .face2[459] = 242,
-//     .face3[459] = 245,
-//     .face1[460] = 215,
-//     .face2[460] = 245,
-//     .face3[460] = 242,
-//     .face1[461] = 246,
-//     .face2[461] = 196,
-//     .face3[461] = 192,
-//     .face1[462] = 192,
-//     .face2[462] = 243,
-//     .face3[462] = 246,
-//     .face1[463] = 247,
-//     .face2[463] = 246,
-//     .face3[463] = 243,
-//     .face1[464] = 243,
-//     .face2[464] = 244,
-//     .face3[464] = 247,
-//     .face1[465] = 248,
-//     .face2[465] = 247,
-//     .face3[465] = 244,
-//     .face1[466] = 244,
-//     .face2[466] = 245,
-//     .face3[466] = 248,
-//     .face1[467] = 215,
-//     .face2[467] = 248,
-//     .face3[467] = 245,
-//     .face1[468] = 249,
-//     .face2[468] = 200,
-//     .face3[468] = 196,
-//     .face1[469] = 196,
-//     .face2[469] = 246,
-//     .face3[469] = 249,
-//     .face1[470] = 250,
-//     .face2[470] = 249,
-//     .face3[470] = 246,
-//     .face1[471] = 246,
-//     .face2[471] = 247,
-//     .face3[471] = 250,
-//     .face1[472] = 251,
-//     .face2[472] = 250,
-//     .face3[472] = 247,
-//     .face1[473] = 247,
-//     .face2[473] = 248,
-//     .face3[473] = 251,
-//     .face1[474] = 215,
-//     .face2[474] = 251,
-//     .face3[474] = 248,
-//     .face1[475] = 252,
-//     .face2[475] = 204,
-//     .face3[475] = 200,
-//     .face1[476] = 200,
-//     .face2[476] = 249,
-//     .face3[476] = 252,
-//     .face1[477] = 253,
-//     .face2[477] = 252,
-//     .face3[477] = 249,
-//     .face1[478] = 249,
-//     .face2[478] = 250,
-//     .face3[478] = 253,
-//     .face1[479] = 254,
-//     .face2[479] = 253,
-//     .face3[479] = 250,
-//     .face1[480] = 250,
-//     .face2[480] = 251,
-//     .face3[480] = 254,
-//     .face1[481] = 215,
-//     .face2[481] = 254,
-//     .face3[481] = 251,
-//     .face1[482] = 255,
-//     .face2[482] = 208,
-//     .face3[482] = 204,
-//     .face1[483] = 204,
-//     .face2[483] = 252,
-//     .face3[483] = 255,
-//     .face1[484] = 256,
-//     .face2[484] = 255,
-//     .face3[484] = 252,
-//     .face1[485] = 252,
-//     .face2[485] = 253,
-//     .face3[485] = 256,
-//     .face1[486] = 257,
-//     .face2[486] = 256,
-//     .face3[486] = 253,
-//     .face1[487] = 253,
-//     .face2[487] = 254,
-//     .face3[487] = 257,
-//     .face1[488] = 215,
-//     .face2[488] = 257,
-//     .face3[488] = 254,
-//     .face1[489] = 210,
-//     .face2[489] = 152,
-//     .face3[489] = 208,
-//     .face1[490] = 208,
-//     .face2[490] = 255,
-//     .face3[490] = 210,
-//     .face1[491] = 212,
-//     .face2[491] = 210,
-//     .face3[491] = 255,
-//     .face1[492] = 255,
-//     .face2[492] = 256,
-//     .face3[492] = 212,
-//     .face1[493] = 214,
-//     .face2[493] = 212,
-//     .face3[493] = 256,
-//     .face1[494] = 256,
-//     .face2[494] = 257,
-//     .face3[494] = 214,
-//     .face1[495] = 215,
-//     .face2[495] = 214,
-//     .face3[495] = 257,
-//     .face1[496] = 258,
-//     .face2[496] = 259,
-//     .face3[496] = 260,
-//     .face1[497] = 260,
-//     .face2[497] = 261,
-//     .face3[497] = 258,
-//     .face1[498] = 262,
-//     .face2[498] = 258,
-//     .face3[498] = 261,
-//     .face1[499] = 261,
-//     .face2[499] = 263,
-//     .face3[499] = 262,
-//     .face1[500] = 264,
-//     .face2[500] = 262,
-//     .face3[500] = 263,
-//     .face1[501] = 263,
-//     .face2[501] = 265,
-//     .face3[501] = 264,
-//     .face1[502] = 266,
-//     .face2[502] = 264,
-//     .face3[502] = 265,
-//     .face1[503] = 265,
-//     .face2[503] = 267,
-//     .face3[503] = 266,
-//     .face1[504] = 268,
-//     .face2[504] = 269,
-//     .face3[504] = 259,
-//     .face1[505] = 259,
-//     .face2[505] = 258,
-//     .face3[505] = 268,
-//     .face1[506] = 270,
-//     .face2[506] = 268,
-//     .face3[506] = 258,
-//     .face1[507] = 258,
-//     .face2[507] = 262,
-//     .face3[507] = 270,
-//     .face1[508] = 271,
-//     .face2[508] = 270,
-//     .face3[508] = 262,
-//     .face1[509] = 262,
-//     .face2[509] = 264,
-//     .face3[509] = 271,
-//     .face1[510] = 272,
-//     .face2[510] = 271,
-//     .face3[510] = 264,
-//     .face1[511] = 264,
-//     .face2[511] = 266,
-//     .face3[511] = 272,
-//     .face1[512] = 273,
-//     .face2[512] = 274,
-//     .face3[512] = 269,
-//     .face1[513] = 269,
-//     .face2[513] = 268,
-//     .face3[513] = 273,
-//     .face1[514] = 275,
-//     .face2[514] = 273,
-//     .face3[514] = 268,
-//     .face1[515] = 268,
-//     .face2[515] = 270,
-//     .face3[515] = 275,
-//     .face1[516] = 276,
-//     .face2[516] = 275,
-//     .face3[516] = 270,
-//     .face1[517] = 270,
-//     .face2[517] = 271,
-//     .face3[517] = 276,
-//     .face1[518] = 277,
-//     .face2[518] = 276,
-//     .face3[518] = 271,
-//     .face1[519] = 271,
-//     .face2[519] = 272,
-//     .face3[519] = 277,
-//     .face1[520] = 278,
-//     .face2[520] = 279,
-//     .face3[520] = 274,
-//     .face1[521] = 274,
-//     .face2[521] = 273,
-//     .face3[521] = 278,
-//     .face1[522] = 280,
-//     .face2[522] = 278,
-//     .face3[522] = 273,
-//     .face1[523] = 273,
-//     .face2[523] = 275,
-//     .face3[523] = 280,
-//     .face1[524] = 281,
-//     .face2[524] = 280,
-//     .face3[524] = 275,
-//     .face1[525] = 275,
-//     .face2[525] = 276,
-//     .face3[525] = 281,
-//     .face1[526] = 282,
-//     .face2[526] = 281,
-//     .face3[526] = 276,
-//     .face1[527] = 276,
-//     .face2[527] = 277,
-//     .face3[527] = 282,
-//     .face1[528] = 283,
-//     .face2[528] = 284,
-//     .face3[528] = 279,
-//     .face1[529] = 279,
-//     .face2[529] = 278,
-//     .face3[529] = 283,
-//     .face1[530] = 285,
-//     .face2[530] = 283,
-//     .face3[530] = 278,
-//     .face1[531] = 278,
-//     .face2[531] = 280,
-//     .face3[531] = 285,
-//     .face1[532] = 286,
-//     .face2[532] = 285,
-//     .face3[532] = 280,
-//     .face1[533] = 280,
-//     .face2[533] = 281,
-//     .face3[533] = 286,
-//     .face1[534] = 287,
-//     .face2[534] = 286,
-//     .face3[534] = 281,
-//     .face1[535] = 281,
-//     .face2[535] = 282,
-//     .face3[535] = 287,
-//     .face1[536] = 288,
-//     .face2[536] = 289,
-//     .face3[536] = 284,
-//     .face1[537] = 284,
-//     .face2[537] = 283,
-//     .face3[537] = 288,
-//     .face1[538] = 290,
-//     .face2[538] = 288,
-//     .face3[538] = 283,
-//     .face1[539] = 283,
-//     .face2[539] = 285,
-//     .face3[539] = 290,
-//     .face1[540] = 291,
-//     .face2[540] = 290,
-//     .face3[540] = 285,
-//     .face1[541] = 285,
-//     .face2[541] = 286,
-//     .face3[541] = 291,
-//     .face1[542] = 292,
-//     .face2[542] = 291,
-//     .face3[542] = 286,
-//     .face1[543] = 286,
-//     .face2[543] = 287,
-//     .face3[543] = 292,
-//     .face1[544] = 293,
-//     .face2[544] = 294,
-//     .face3[544] = 289,
-//     .face1[545] = 289,
-//     .face2[545] = 288,
-//     .face3[545] = 293,
-//     .face1[546] = 295,
-//     .face2[546] = 293,
-//     .face3[546] = 288,
-//     .face1[547] = 288,
-//     .face2[547] = 290,
-//     .face3[547] = 295,
-//     .face1[548] = 296,
-//     .face2[548] = 295,
-//     .face3[548] = 290,
-//     .face1[549] = 290,
-//     .face2[549] = 291,
-//     .face3[549] = 296,
-//     .face1[550] = 297,
-//     .face2[550] = 296,
-//     .face3[550] = 291,
-//     .face1[551] = 291,
-//     .face2[551] = 292,
-//     .face3[551] = 297,
-//     .face1[552] = 261,
-//     .face2[552] = 260,
-//     .face3[552] = 294,
-//     .face1[553] = 294,
-//     .face2[553] = 293,
-//     .face3[553] = 261,
-//     .face1[554] = 263,
-//     .face2[554] = 261,
-//     .face3[554] = 293,
-//     .face1[555] = 293,
-//     .face2[555] = 295,
-//     .face3[555] = 263,
-//     .face1[556] = 265,
-//     .face2[556] = 263,
-//     .face3[556] = 295,
-//     .face1[557] = 295,
-//     .face2[557] = 296,
-//     .face3[557] = 265,
-//     .face1[558] = 267,
-//     .face2[558] = 265,
-//     .face3[558] = 296,
-//     .face1[559] = 296,
-//     .face2[559] = 297,
-//     .face3[559] = 267,
-//     .face1[560] = 298,
-//     .face2[560] = 266,
-//     .face3[560] = 267,
-//     .face1[561] = 267,
-//     .face2[561] = 299,
-//     .face3[561] = 298,
-//     .face1[562] = 300,
-//     .face2[562] = 298,
-//     .face3[562] = 299,
-//     .face1[563] = 299,
-//     .face2[563] = 301,
-//     .face3[563] = 300,
-//     .face1[564] = 302,
-//     .face2[564] = 300,
-//     .face3[564] = 301,
-//     .face1[565] = 301,
-//     .face2[565] = 303,
-//     .face3[565] = 302,
-//     .face1[566] = 304,
-//     .face2[566] = 302,
-//     .face3[566] = 303,
-//     .face1[567] = 303,
-//     .face2[567] = 305,
-//     .face3[567] = 304,
-//     .face1[568] = 306,
-//     .face2[568] = 272,
-//     .face3[568] = 266,
-//     .face1[569] = 266,
-//     .face2[569] = 298,
-//     .face3[569] = 306,
-//     .face1[570] = 307,
-//     .face2[570] = 306,
-//     .face3[570] = 298,
-//     .face1[571] = 298,
-//     .face2[571] = 300,
-//     .face3[571] = 307,
-//     .face1[572] = 308,
-//     .face2[572] = 307,
-//     .face3[572] = 300,
-//     .face1[573] = 300,
-//     .face2[573] = 302,
-//     .face3[573] = 308,
-//     .face1[574] = 309,
-//     .face2[574] = 308,
-//     .face3[574] = 302,
-//     .face1[575] = 302,
-//     .face2[575] = 304,
-//     .face3[575] = 309,
-//     .face1[576] = 310,
-//     .face2[576] = 277,
-//     .face3[576] = 272,
-//     .face1[577] = 272,
-//     .face2[577] = 306,
-//     .face3[577] = 310,
-//     .face1[578] = 311,
-//     .face2[578] = 310,
-//     .face3[578] = 306,
-//     .face1[579] = 306,
-//     .face2[579] = 307,
-//     .face3[579] = 311,
-//     .face1[580] = 312,
-//     .face2[580] = 311,
-//     .face3[580] = 307,
-//     .face1[581] = 307,
-//     .face2[581] = 308,
-//     .face3[581] = 312,
-//     .face1[582] = 313,
-//     .face2[582] = 312,
-//     .face3[582] = 308,
-//     .face1[583] = 308,
-//     .face2[583] = 309,
-//     .face3[583] = 313,
-//     .face1[584] = 314,
-//     .face2[584] = 282,
-//     .face3[584] = 277,
-//     .face1[585] = 277,
-//     .face2[585] = 310,
-//     .face3[585] = 314,
-//     .face1[586] = 315,
-//     .face2[586] = 314,
-//     .face3[586] = 310,
-//     .face1[587] = 310,
-//     .face2[587] = 311,
-//     .face3[587] = 315,
-//     .face1[588] = 316,
-//     .face2[588] = 315,
-//     .face3[588] = 311,
-//     .face1[589] = 311,
-//     .face2[589] = 312,
-//     .face3[589] = 316,
-//     .face1[590] = 317,
-//     .face2[590] = 316,
-//     .face3[590] = 312,
-//     .face1[591] = 312,
-//     .face2[591] = 313,
-//     .face3[591] = 317,
-//     .face1[592] = 318,
-//     .face2[592] = 287,
-//     .face3[592] = 282,
-//     .face1[593] = 282,
-//     .face2[593] = 314,
-//     .face3[593] = 318,
-//     .face1[594] = 319,
-//     .face2[594] = 318,
-//     .face3[594] = 314,
-//     .face1[595] = 314,
-//     .face2[595] = 315,
-//     .face3[595] = 319,
-//     .face1[596] = 320,
-//     .face2[596] = 319,
-//     .face3[596] = 315,
-//     .face1[597] = 315,
-//     .face2[597] = 316,
-//     .face3[597] = 320,
-//     .face1[598] = 321,
-//     .face2[598] = 320,
-//     .face3[598] = 316,
-//     .face1[599] = 316,
-//     .face2[599] = 317,
-//     .face3[599] = 321,
-//     .face1[600] = 322,
-//     .face2[600] = 292,
-//     .face3[600] = 287,
-//     .face1[601] = 287,
-//     .face2[601] = 318,
-//     .face3[601] = 322,
-//     .face1[602] = 323,
-//     .face2[602] = 322,
-//     .face3[602] = 318,
-//     .face1[603] = 318,
-//     .face2[603] = 319,
-//     .face3[603] = 323,
-//     .face1[604] = 324,
-//     .face2[604] = 323,
-//     .face3[604] = 319,
-//     .face1[605] = 319,
-//     .face2[605] = 320,
-//     .face3[605] = 324,
-//     .face1[606] = 325,
-//     .face2[606] = 324,
-//     .face3[606] = 320,
-//     .face1[607] = 320,
-//     .face2[607] = 321,
-//     .face3[607] = 325,
-//     .face1[608] = 326,
-//     .face2[608] = 297,
-//     .face3[608] = 292,
-//     .face1[609] = 292,
-//     .face2[609] = 322,
-//     .face3[609] = 326,
-//     .face1[610] = 327,
-//     .face2[610] = 326,
-//     .face3[610] = 322,
-//     .face1[611] = 322,
-//     .face2[611] = 323,
-//     .face3[611] = 327,
-//     .face1[612] = 328,
-//     .face2[612] = 327,
-//     .face3[612] = 323,
-//     .face1[613] = 323,
-//     .face2[613] = 324,
-//     .face3[613] = 328,
-//     .face1[614] = 329,
-//     .face2[614] = 328,
-//     .face3[614] = 324,
-//     .face1[615] = 324,
-//     .face2[615] = 325,
-//     .face3[615] = 329,
-//     .face1[616] = 299,
-//     .face2[616] = 267,
-//     .face3[616] = 297,
-//     .face1[617] = 297,
-//     .face2[617] = 326,
-//     .face3[617] = 299,
-//     .face1[618] = 301,
-//     .face2[618] = 299,
-//     .face3[618] = 326,
-//     .face1[619] = 326,
-//     .face2[619] = 327,
-//     .face3[619] = 301,
-//     .face1[620] = 303,
-//     .face2[620] = 301,
-//     .face3[620] = 327,
-//     .face1[621] = 327,
-//     .face2[621] = 328,
-//     .face3[621] = 303,
-//     .face1[622] = 305,
-//     .face2[622] = 303,
-//     .face3[622] = 328,
-//     .face1[623] = 328,
-//     .face2[623] = 329,
-//     .face3[623] = 305,
-//     .face1[624] = 330,
-//     .face2[624] = 331,
-//     .face3[624] = 332,
-//     .face1[625] = 332,
-//     .face2[625] = 333,
-//     .face3[625] = 330,
-//     .face1[626] = 334,
-//     .face2[626] = 330,
-//     .face3[626] = 333,
-//     .face1[627] = 333,
-//     .face2[627] = 335,
-//     .face3[627] = 334,
-//     .face1[628] = 336,
-//     .face2[628] = 334,
-//     .face3[628] = 335,
-//     .face1[629] = 335,
-//     .face2[629] = 337,
-//     .face3[629] = 336,
-//     .face1[630] = 338,
-//     .face2[630] = 336,
-//     .face3[630] = 337,
-//     .face1[631] = 337,
-//     .face2[631] = 339,
-//     .face3[631] = 338,
-//     .face1[632] = 340,
-//     .face2[632] = 341,
-//     .face3[632] = 331,
-//     .face1[633] = 331,
-//     .face2[633] = 330,
-//     .face3[633] = 340,
-//     .face1[634] = 342,
-//     .face2[634] = 340,
-//     .face3[634] = 330,
-//     .face1[635] = 330,
-//     .face2[635] = 334,
-//     .face3[635] = 342,
-//     .face1[636] = 343,
-//     .face2[636] = 342,
-//     .face3[636] = 334,
-//     .face1[637] = 334,
-//     .face2[637] = 336,
-//     .face3[637] = 343,
-//     .face1[638] = 344,
-//     .face2[638] = 343,
-//     .face3[638] = 336,
-//     .face1[639] = 336,
-//     .face2[639] = 338,
-//     .face3[639] = 344,
-//     .face1[640] = 345,
-//     .face2[640] = 346,
-//     .face3[640] = 341,
-//     .face1[641] = 341,
-//     .face2[641] = 340,
-//     .face3[641] = 345,
-//     .face1[642] = 347,
-//     .face2[642] = 345,
-//     .face3[642] = 340,
-//     .face1[643] = 340,
-//     .face2[643] = 342,
-//     .face3[643] = 347,
-//     .face1[644] = 348,
-//     .face2[644] = 347,
-//     .face3[644] = 342,
-//     .face1[645] = 342,
-//     .face2[645] = 343,
-//     .face3[645] = 348,
-//     .face1[646] = 349,
-//     .face2[646] = 348,
-//     .face3[646] = 343,
-//     .face1[647] = 343,
-//     .face2[647] = 344,
-//     .face3[647] = 349,
-//     .face1[648] = 350,
-//     .face2[648] = 351,
-//     .face3[648] = 346,
-//     .face1[649] = 346,
-//     .face2[649] = 345,
-//     .face3[649] = 350,
-//     .face1[650] = 352,
-//     .face2[650] = 350,
-//     .face3[650] = 345,
-//     .face1[651] = 345,
-//     .face2[651] = 347,
-//     .face3[651] = 352,
-//     .face1[652] = 353,
-//     .face2[652] = 352,
-//     .face3[652] = 347,
-//     .face1[653] = 347,
-//     .face2[653] = 348,
-//     .face3[653] = 353,
-//     .face1[654] = 354,
-//     .face2[654] = 353,
-//     .face3[654] = 348,
-//     .face1[655] = 348,
-//     .face2[655] = 349,
-//     .face3[655] = 354,
-//     .face1[656] = 355,
-//     .face2[656] = 356,
-//     .face3[656] = 351,
-//     .face1[657] = 351,
-//     .face2[657] = 350,
-//     .face3[657] = 355,
-//     .face1[658] = 357,
-//     .face2[658] = 355,
-//     .face3[658] = 350,
-//     .face1[659] = 350,
-//     .face2[659] = 352,
-//     .face3[659] = 357,
-//     .face1[660] = 358,
-//     .face2[660] = 357,
-//     .face3[660] = 352,
-//     .face1[661] = 352,
-//     .face2[661] = 353,
-//     .face3[661] = 358,
-//     .face1[662] = 359,
-//     .face2[662] = 358,
-//     .face3[662] = 353,
-//     .face1[663] = 353,
-//     .face2[663] = 354,
-//     .face3[663] = 359,
-//     .face1[664] = 360,
-//     .face2[664] = 361,
-//     .face3[664] = 356,
-//     .face1[665] = 356,
-//     .face2[665] = 355,
-//     .face3[665] = 360,
-//     .face1[666] = 362,
-//     .face2[666] = 360,
-//     .face3[666] = 355,
-//     .face1[667] = 355,
-//     .face2[667] = 357,
-//     .face3[667] = 362,
-//     .face1[668] = 363,
-//     .face2[668] = 362,
-//     .face3[668] = 357,
-//     .face1[669] = 357,
-//     .face2[669] = 358,
-//     .face3[669] = 363,
-//     .face1[670] = 364,
-//     .face2[670] = 363,
-//     .face3[670] = 358,
-//     .face1[671] = 358,
-//     .face2[671] = 359,
-//     .face3[671] = 364,
-//     .face1[672] = 365,
-//     .face2[672] = 366,
-//     .face3[672] = 361,
-//     .face1[673] = 361,
-//     .face2[673] = 360,
-//     .face3[673] = 365,
-//     .face1[674] = 367,
-//     .face2[674] = 365,
-//     .face3[674] = 360,
-//     .face1[675] = 360,
-//     .face2[675] = 362,
-//     .face3[675] = 367,
-//     .face1[676] = 368,
-//     .face2[676] = 367,
-//     .face3[676] = 362,
-//     .face1[677] = 362,
-//     .face2[677] = 363,
-//     .face3[677] = 368,
-//     .face1[678] = 369,
-//     .face2[678] = 368,
-//     .face3[678] = 363,
-//     .face1[679] = 363,
-//     .face2[679] = 364,
-//     .face3[679] = 369,
-//     .face1[680] = 333,
-//     .face2[680] = 332,
-//     .face3[680] = 366,
-//     .face1[681] = 366,
-//     .face2[681] = 365,
-//     .face3[681] = 333,
-//     .face1[682] = 335,
-//     .face2[682] = 333,
-//     .face3[682] = 365,
-//     .face1[683] = 365,
-//     .face2[683] = 367,
-//     .face3[683] = 335,
-//     .face1[684] = 337,
-//     .face2[684] = 335,
-//     .face3[684] = 367,
-//     .face1[685] = 367,
-//     .face2[685] = 368,
-//     .face3[685] = 337,
-//     .face1[686] = 339,
-//     .face2[686] = 337,
-//     .face3[686] = 368,
-//     .face1[687] = 368,
-//     .face2[687] = 369,
-//     .face3[687] = 339,
-//     .face1[688] = 370,
-//     .face2[688] = 338,
-//     .face3[688] = 339,
-//     .face1[689] = 339,
-//     .face2[689] = 371,
-//     .face3[689] = 370,
-//     .face1[690] = 372,
-//     .face2[690] = 370,
-//     .face3[690] = 371,
-//     .face1[691] = 371,
-//     .face2[691] = 373,
-//     .face3[691] = 372,
-//     .face1[692] = 374,
-//     .face2[692] = 372,
-//     .face3[692] = 373,
-//     .face1[693] = 373,
-//     .face2[693] = 375,
-//     .face3[693] = 374,
-//     .face1[694] = 376,
-//     .face2[694] = 374,
-//     .face3[694] = 375,
-//     .face1[695] = 375,
-//     .face2[695] = 377,
-//     .face3[695] = 376,
-//     .face1[696] = 378,
-//     .face2[696] = 344,
-//     .face3[696] = 338,
-//     .face1[697] = 338,
-//     .face2[697] = 370,
-//     .face3[697] = 378,
-//     .face1[698] = 379,
-//     .face2[698] = 378,
-//     .face3[698] = 370,
-//     .face1[699] = 370,
-//     .face2[699] = 372,
-//     .face3[699] = 379,
-//     .face1[700] = 380,
-//     .face2[700] = 379,
-//     .face3[700] = 372,
-//     .face1[701] = 372,
-//     .face2[701] = 374,
-//     .face3[701] = 380,
-//     .face1[702] = 381,
-//     .face2[702] = 380,
-//     .face3[702] = 374,
-//     .face1[703] = 374,
-//     .face2[703] = 376,
-//     .face3[703] = 381,
-//     .face1[704] = 382,
-//     .face2[704] = 349,
-//     .face3[704] = 344,
-//     .face1[705] = 344,
-//     .face2[705] = 378,
-//     .face3[705] = 382,
-//     .face1[706] = 383,
-//     .face2[706] = 382,
-//     .face3[706] = 378,
-//     .face1[707] = 378,
-//     .face2[707] = 379,
-//     .face3[707] = 383,
-//     .face1[708] = 384,
-//     .face2[708] = 383,
-//     .face3[708] = 379,
-//     .face1[709] = 379,
-//     .face2[709] = 380,
-//     .face3[709] = 384,
-//     .face1[710] = 385,
-//     .face2[710] = 384,
-//     .face3[710] = 380,
-//     .face1[711] = 380,
-//     .face2[711] = 381,
-//     .face3[711] = 385,
-//     .face1[712] = 386,
-//     .face2[712] = 354,
-//     .face3[712] = 349,
-//     .face1[713] = 349,
-//     .face2[713] = 382,
-//     .face3[713] = 386,
-//     .face1[714] = 387,
-//     .face2[714] = 386,
-//     .face3[714] = 382,
-//     .face1[715] = 382,
-//     .face2[715] = 383,
-//     .face3[715] = 387,
-//     .face1[716] = 388,
-//     .face2[716] = 387,
-//     .face3[716] = 383,
-//     .face1[717] = 383,
-//     .face2[717] = 384,
-//     .face3[717] = 388,
-//     .face1[718] = 389,
-//     .face2[718] = 388,
-//     .face3[718] = 384,
-//     .face1[719] = 384,
-//     .face2[719] = 385,
-//     .face3[719] = 389,
-//     .face1[720] = 390,
-//     .face2[720] = 359,
-//     .face3[720] = 354,
-//     .face1[721] = 354,
-//     .face2[721] = 386,
-//     .face3[721] = 390,
-//     .face1[722] = 391,
-//     .face2[722] = 390,
-//     .face3[722] = 386,
-//     .face1[723] = 386,
-//     .face2[723] = 387,
-//     .face3[723] = 391,
-//     .face1[724] = 392,
-//     .face2[724] = 391,
-//     .face3[724] = 387,
-//     .face1[725] = 387,
-//     .face2[725] = 388,
-//     .face3[725] = 392,
-//     .face1[726] = 393,
-//     .face2[726] = 392,
-//     .face3[726] = 388,
-//     .face1[727] = 388,
-//     .face2[727] = 389,
-//     .face3[727] = 393,
-//     .face1[728] = 394,
-//     .face2[728] = 364,
-//     .face3[728] = 359,
-//     .face1[729] = 359,
-//     .face2[729] = 390,
-//     .face3[729] = 394,
-//     .face1[730] = 395,
-//     .face2[730] = 394,
-//     .face3[730] = 390,
-//     .face1[731] = 390,
-//     .face2[731] = 391,
-//     .face3[731] = 395,
-//     .face1[732] = 396,
-//     .face2[732] = 395,
-//     .face3[732] = 391,
-//     .face1[733] = 391,
-//     .face2[733] = 392,
-//     .face3[733] = 396,
-//     .face1[734] = 397,
-//     .face2[734] = 396,
-//     .face3[734] = 392,
-//     .face1[735] = 392,
-//     .face2[735] = 393,
-//     .face3[735] = 397,
-//     .face1[736] = 398,
-//     .face2[736] = 369,
-//     .face3[736] = 364,
-//     .face1[737] = 364,
-//     .face2[737] = 394,
-//     .face3[737] = 398,
-//     .face1[738] = 399,
-//     .face2[738] = 398,
-//     .face3[738] = 394,
-//     .face1[739] = 394,
-//     .face2[739] = 395,
-//     .face3[739] = 399,
-//     .face1[740] = 400,
-//     .face2[740] = 399,
-//     .face3[740] = 395,
-//     .face1[741] = 395,
-//     .face2[741] = 396,
-//     .face3[741] = 400,
-//     .face1[742] = 401,
-//     .face2[742] = 400,
-//     .face3[742] = 396,
-//     .face1[743] = 396,
-//     .face2[743] = 397,
-//     .face3[743] = 401,
-//     .face1[744] = 371,
-//     .face2[744] = 339,
-//     .face3[744] = 369,
-//     .face1[745] = 369,
-//     .face2[745] = 398,
-//     .face3[745] = 371,
-//     .face1[746] = 373,
-//     .face2[746] = 371,
-//     .face3[746] = 398,
-//     .face1[747] = 398,
-//     .face2[747] = 399,
-//     .face3[747] = 373,
-//     .face1[748] = 375,
-//     .face2[748] = 373,
-//     .face3[748] = 399,
-//     .face1[749] = 399,
-//     .face2[749] = 400,
-//     .face3[749] = 375,
-//     .face1[750] = 377,
-//     .face2[750] = 375,
-//     .face3[750] = 400,
-//     .face1[751] = 400,
-//     .face2[751] = 401,
-//     .face3[751] = 377,
-//     .face1[752] = 403,
-//     .face2[752] = 404,
-//     .face3[752] = 402,
-//     .face1[753] = 405,
-//     .face2[753] = 402,
-//     .face3[753] = 404,
-//     .face1[754] = 404,
-//     .face2[754] = 406,
-//     .face3[754] = 405,
-//     .face1[755] = 407,
-//     .face2[755] = 405,
-//     .face3[755] = 406,
-//     .face1[756] = 406,
-//     .face2[756] = 408,
-//     .face3[756] = 407,
-//     .face1[757] = 409,
-//     .face2[757] = 407,
-//     .face3[757] = 408,
-//     .face1[758] = 408,
-//     .face2[758] = 410,
-//     .face3[758] = 409,
-//     .face1[759] = 403,
-//     .face2[759] = 402,
-//     .face3[759] = 411,
-//     .face1[760] = 412,
-//     .face2[760] = 411,
-//     .face3[760] = 402,
-//     .face1[761] = 402,
-//     .face2[761] = 405,
-//     .face3[761] = 412,
-//     .face1[762] = 413,
-//     .face2[762] = 412,
-//     .face3[762] = 405,
-//     .face1[763] = 405,
-//     .face2[763] = 407,
-//     .face3[763] = 413,
-//     .face1[764] = 414,
-//     .face2[764] = 413,
-//     .face3[764] = 407,
-//     .face1[765] = 407,
-//     .face2[765] = 409,
-//     .face3[765] = 414,
-//     .face1[766] = 403,
-//     .face2[766] = 411,
-//     .face3[766] = 415,
-//     .face1[767] = 416,
-//     .face2[767] = 415,
-//     .face3[767] = 411,
-//     .face1[768] = 411,
-//     .face2[768] = 412,
-//     .face3[768] = 416,
-//     .face1[769] = 417,
-//     .face2[769] = 416,
-//     .face3[769] = 412,
-//     .face1[770] = 412,
-//     .face2[770] = 413,
-//     .face3[770] = 417,
-//     .face1[771] = 418,
-//     .face2[771] = 417,
-//     .face3[771] = 413,
-//     .face1[772] = 413,
-//     .face2[772] = 414,
-//     .face3[772] = 418,
-//     .face1[773] = 403,
-//     .face2[773] = 415,
-//     .face3[773] = 419,
-//     .face1[774] = 420,
-//     .face2[774] = 419,
-//     .face3[774] = 415,
-//     .face1[775] = 415,
-//     .face2[775] = 416,
-//     .face3[775] = 420,
-//     .face1[776] = 421,
-//     .face2[776] = 420,
-//     .face3[776] = 416,
-//     .face1[777] = 416,
-//     .face2[777] = 417,
-//     .face3[777] = 421,
-//     .face1[778] = 422,
-//     .face2[778] = 421,
-//     .face3[778] = 417,
-//     .face1[779] = 417,
-//     .face2[779] = 418,
-//     .face3[779] = 422,
-//     .face1[780] = 403,
-//     .face2[780] = 419,
-//     .face3[780] = 423,
-//     .face1[781] = 424,
-//     .face2[781] = 423,
-//     .face3[781] = 419,
-//     .face1[782] = 419,
-//     .face2[782] = 420,
-//     .face3[782] = 424,
-//     .face1[783] = 425,
-//     .face2[783] = 424,
-//     .face3[783] = 420,
-//     .face1[784] = 420,
-//     .face2[784] = 421,
-//     .face3[784] = 425,
-//     .face1[785] = 426,
-//     .face2[785] = 425,
-//     .face3[785] = 421,
-//     .face1[786] = 421,
-//     .face2[786] = 422,
-//     .face3[786] = 426,
-//     .face1[787] = 403,
-//     .face2[787] = 423,
-//     .face3[787] = 427,
-//     .face1[788] = 428,
-//     .face2[788] = 427,
-//     .face3[788] = 423,
-//     .face1[789] = 423,
-//     .face2[789] = 424,
-//     .face3[789] = 428,
-//     .face1[790] = 429,
-//     .face2[790] = 428,
-//     .face3[790] = 424,
-//     .face1[791] = 424,
-//     .face2[791] = 425,
-//     .face3[791] = 429,
-//     .face1[792] = 430,
-//     .face2[792] = 429,
-//     .face3[792] = 425,
-//     .face1[793] = 425,
-//     .face2[793] = 426,
-//     .face3[793] = 430,
-//     .face1[794] = 403,
-//     .face2[794] = 427,
-//     .face3[794] = 431,
-//     .face1[795] = 432,
-//     .face2[795] = 431,
-//     .face3[795] = 427,
-//     .face1[796] = 427,
-//     .face2[796] = 428,
-//     .face3[796] = 432,
-//     .face1[797] = 433,
-//     .face2[797] = 432,
-//     .face3[797] = 428,
-//     .face1[798] = 428,
-//     .face2[798] = 429,
-//     .face3[798] = 433,
-//     .face1[799] = 434,
-//     .face2[799] = 433,
-//     .face3[799] = 429,
-//     .face1[800] = 429,
-//     .face2[800] = 430,
-//     .face3[800] = 434,
-//     .face1[801] = 403,
-//     .face2[801] = 431,
-//     .face3[801] = 435,
-//     .face1[802] = 436,
-//     .face2[802] = 435,
-//     .face3[802] = 431,
-//     .face1[803] = 431,
-//     .face2[803] = 432,
-//     .face3[803] = 436,
-//     .face1[804] = 437,
-//     .face2[804] = 436,
-//     .face3[804] = 432,
-//     .face1[805] = 432,
-//     .face2[805] = 433,
-//     .face3[805] = 437,
-//     .face1[806] = 438,
-//     .face2[806] = 437,
-//     .face3[806] = 433,
-//     .face1[807] = 433,
-//     .face2[807] = 434,
-//     .face3[807] = 438,
-//     .face1[808] = 403,
-//     .face2[808] = 435,
-//     .face3[808] = 439,
-//     .face1[809] = 440,
-//     .face2[809] = 439,
-//     .face3[809] = 435,
-//     .face1[810] = 435,
-//     .face2[810] = 436,
-//     .face3[810] = 440,
-//     .face1[811] = 441,
-//     .face2[811] = 440,
-//     .face3[811] = 436,
-//     .face1[812] = 436,
-//     .face2[812] = 437,
-//     .face3[812] = 441,
-//     .face1[813] = 442,
-//     .face2[813] = 441,
-//     .face3[813] = 437,
-//     .face1[814] = 437,
-//     .face2[814] = 438,
-//     .face3[814] = 442,
-//     .face1[815] = 403,
-//     .face2[815] = 439,
-//     .face3[815] = 443,
-//     .face1[816] = 444,
-//     .face2[816] = 443,
-//     .face3[816] = 439,
-//     .face1[817] = 439,
-//     .face2[817] = 440,
-//     .face3[817] = 444,
-//     .face1[818] = 445,
-//     .face2[818] = 444,
-//     .face3[818] = 440,
-//     .face1[819] = 440,
-//     .face2[819] = 441,
-//     .face3[819] = 445,
-//     .face1[820] = 446,
-//     .face2[820] = 445,
-//     .face3[820] = 441,
-//     .face1[821] = 441,
-//     .face2[821] = 442,
-//     .face3[821] = 446,
-//     .face1[822] = 403,
-//     .face2[822] = 443,
-//     .face3[822] = 447,
-//     .face1[823] = 448,
-//     .face2[823] = 447,
-//     .face3[823] = 443,
-//     .face1[824] = 443,
-//     .face2[824] = 444,
-//     .face3[824] = 448,
-//     .face1[825] = 449,
-//     .face2[825] = 448,
-//     .face3[825] = 444,
-//     .face1[826] = 444,
-//     .face2[826] = 445,
-//     .face3[826] = 449,
-//     .face1[827] = 450,
-//     .face2[827] = 449,
-//     .face3[827] = 445,
-//     .face1[828] = 445,
-//     .face2[828] = 446,
-//     .face3[828] = 450,
-//     .face1[829] = 403,
-//     .face2[829] = 447,
-//     .face3[829] = 451,
-//     .face1[830] = 452,
-//     .face2[830] = 451,
-//     .face3[830] = 447,
-//     .face1[831] = 447,
-//     .face2[831] = 448,
-//     .face3[831] = 452,
-//     .face1[832] = 453,
-//     .face2[832] = 452,
-//     .face3[832] = 448,
-//     .face1[833] = 448,
-//     .face2[833] = 449,
-//     .face3[833] = 453,
-//     .face1[834] = 454,
-//     .face2[834] = 453,
-//     .face3[834] = 449,
-//     .face1[835] = 449,
-//     .face2[835] = 450,
-//     .face3[835] = 454,
-//     .face1[836] = 403,
-//     .face2[836] = 451,
-//     .face3[836] = 455,
-//     .face1[837] = 456,
-//     .face2[837] = 455,
-//     .face3[837] = 451,
-//     .face1[838] = 451,
-//     .face2[838] = 452,
-//     .face3[838] = 456,
-//     .face1[839] = 457,
-//     .face2[839] = 456,
-//     .face3[839] = 452,
-//     .face1[840] = 452,
-//     .face2[840] = 453,
-//     .face3[840] = 457,
-//     .face1[841] = 458,
-//     .face2[841] = 457,
-//     .face3[841] = 453,
-//     .face1[842] = 453,
-//     .face2[842] = 454,
-//     .face3[842] = 458,
-//     .face1[843] = 403,
-//     .face2[843] = 455,
-//     .face3[843] = 459,
-//     .face1[844] = 460,
-//     .face2[844] = 459,
-//     .face3[844] = 455,
-//     .face1[845] = 455,
-//     .face2[845] = 456,
-//     .face3[845] = 460,
-//     .face1[846] = 461,
-//     .face2[846] = 460,
-//     .face3[846] = 456,
-//     .face1[847] = 456,
-//     .face2[847] = 457,
-//     .face3[847] = 461,
-//     .face1[848] = 462,
-//     .face2[848] = 461,
-//     .face3[848] = 457,
-//     .face1[849] = 457,
-//     .face2[849] = 458,
-//     .face3[849] = 462,
-//     .face1[850] = 403,
-//     .face2[850] = 459,
-//     .face3[850] = 463,
-//     .face1[851] = 464,
-//     .face2[851] = 463,
-//     .face3[851] = 459,
-//     .face1[852] = 459,
-//     .face2[852] = 460,
-//     .face3[852] = 464,
-//     .face1[853] = 465,
-//     .face2[853] = 464,
-//     .face3[853] = 460,
-//     .face1[854] = 460,
-//     .face2[854] = 461,
-//     .face3[854] = 465,
-//     .face1[855] = 466,
-//     .face2[855] = 465,
-//     .face3[855] = 461,
-//     .face1[856] = 461,
-//     .face2[856] = 462,
-//     .face3[856] = 466,
-//     .face1[857] = 403,
-//     .face2[857] = 463,
-//     .face3[857] = 404,
-//     .face1[858] = 406,
-//     .face2[858] = 404,
-//     .face3[858] = 463,
-//     .face1[859] = 463,
-//     .face2[859] = 464,
-//     .face3[859] = 406,
-//     .face1[860] = 408,
-//     .face2[860] = 406,
-//     .face3[860] = 464,
-//     .face1[861] = 464,
-//     .face2[861] = 465,
-//     .face3[861] = 408,
-//     .face1[862] = 410,
-//     .face2[862] = 408,
-//     .face3[862] = 465,
-//     .face1[863] = 465,
-//     .face2[863] = 466,
-//     .face3[863] = 410,
-//     .face1[864] = 467,
-//     .face2[864] = 409,
-//     .face3[864] = 410,
-//     .face1[865] = 410,
-//     .face2[865] = 468,
-//     .face3[865] = 467,
-//     .face1[866] = 469,
-//     .face2[866] = 467,
-//     .face3[866] = 468,
-//     .face1[867] = 468,
-//     .face2[867] = 470,
-//     .face3[867] = 469,
-//     .face1[868] = 471,
-//     .face2[868] = 469,
-//     .face3[868] = 470,
-//     .face1[869] = 470,
-//     .face2[869] = 472,
-//     .face3[869] = 471,
-//     .face1[870] = 473,
-//     .face2[870] = 471,
-//     .face3[870] = 472,
-//     .face1[871] = 472,
-//     .face2[871] = 474,
-//     .face3[871] = 473,
-//     .face1[872] = 475,
-//     .face2[872] = 414,
-//     .face3[872] = 409,
-//     .face1[873] = 409,
-//     .face2[873] = 467,
-//     .face3[873] = 475,
-//     .face1[874] = 476,
-//     .face2[874] = 475,
-//     .face3[874] = 467,
-//     .face1[875] = 467,
-//     .face2[875] = 469,
-//     .face3[875] = 476,
-//     .face1[876] = 477,
-//     .face2[876] = 476,
-//     .face3[876] = 469,
-//     .face1[877] = 469,
-//     .face2[877] = 471,
-//     .face3[877] = 477,
-//     .face1[878] = 478,
-//     .face2[878] = 477,
-//     .face3[878] = 471,
-//     .face1[879] = 471,
-//     .face2[879] = 473,
-//     .face3[879] = 478,
-//     .face1[880] = 479,
-//     .face2[880] = 418,
-//     .face3[880] = 414,
-//     .face1[881] = 414,
-//     .face2[881] = 475,
-//     .face3[881] = 479,
-//     .face1[882] = 480,
-//     .face2[882] = 479,
-//     .face3[882] = 475,
-//     .face1[883] = 475,
-//     .face2[883] = 476,
-//     .face3[883] = 480,
-//     .face1[884] = 481,
-//     .face2[884] = 480,
-//     .face3[884] = 476,
-//     .face1[885] = 476,
-//     .face2[885] = 477,
-//     .face3[885] = 481,
-//     .face1[886] = 482,
-//     .face2[886] = 481,
-//     .face3[886] = 477,
-//     .face1[887] = 477,
-//     .face2[887] = 478,
-//     .face3[887] = 482,
-//     .face1[888] = 483,
-//     .face2[888] = 422,
-//     .face3[888] = 418,
-//     .face1[889] = 418,
-//     .face2[889] = 479,
-//     .face3[889] = 483,
-//     .face1[890] = 484,
-//     .face2[890] = 483,
-//     .face3[890] = 479,
-//     .face1[891] = 479,
-//     .face2[891] = 480,
-//     .face3[891] = 484,
-//     .face1[892] = 485,
-//     .face2[892] = 484,
-//     .face3[892] = 480,
-//     .face1[893] = 480,
-//     .face2[893] = 481,
-//     .face3[893] = 485,
-//     .face1[894] = 486,
-//     .face2[894] = 485,
-//     .face3[894] = 481,
-//     .face1[895] = 481,
-//     .face2[895] = 482,
-//     .face3[895] = 486,
-//     .face1[896] = 487,
-//     .face2[896] = 426,
-//     .face3[896] = 422,
-//     .face1[897] = 422,
-//     .face2[897] = 483,
-//     .face3[897] = 487,
-//     .face1[898] = 488,
-//     .face2[898] = 487,
-//     .face3[898] = 483,
-//     .face1[899] = 483,
-//     .face2[899] = 484,
-//     .face3[899] = 488,
-//     .face1[900] = 489,
-//     .face2[900] = 488,
-//     .face3[900] = 484,
-//     .face1[901] = 484,
-//     .face2[901] = 485,
-//     .face3[901] = 489,
-//     .face1[902] = 490,
-//     .face2[902] = 489,
-//     .face3[902] = 485,
-//     .face1[903] = 485,
-//     .face2[903] = 486,
-//     .face3[903] = 490,
-//     .face1[904] = 491,
-//     .face2[904] = 430,
-//     .face3[904] = 426,
-//     .face1[905] = 426,
-//     .face2[905] = 487,
-//     .face3[905] = 491,
-//     .face1[906] = 492,
-//     .face2[906] = 491,
-//     .face3[906] = 487,
-//     .face1[907] = 487,
-//     .face2[907] = 488,
-//     .face3[907] = 492,
-//     .face1[908] = 493,
-//     .face2[908] = 492,
-//     .face3[908] = 488,
-//     .face1[909] = 488,
-//     .face2[909] = 489,
-//     .face3[909] = 493,
-//     .face1[910] = 494,
-//     .face2[910] = 493,
-//     .face3[910] = 489,
-//     .face1[911] = 489,
-//     .face2[911] = 490,
-//     .face3[911] = 494,
-//     .face1[912] = 495,
-//     .face2[912] = 434,
-//     .face3[912] = 430,
-//     .face1[913] = 430,
-//     .face2[913] = 491,
-//     .face3[913] = 495,
-//     .face1[914] = 496,
-//     .face2[914] = 495,
-//     .face3[914] = 491,
-//     .face1[915] = 491,
-//     .face2[915] = 492,
-//     .face3[915] = 496,
-//     .face1[916] = 497,
-//     .face2[916] = 496,
-//     .face3[916] = 492,
-//     .face1[917] = 492,
-//     .face2[917] = 493,
-//     .face3[917] = 497,
-//     .face1[918] = 498,
-//     .face2[918] = 497,
-//     .face3[918] = 493,
-//     .face1[919] = 493,
-//     .face2[919] = 494,
-//     .face3[919] = 498,
-//     .face1[920] = 499,
-//     .face2[920] = 438,
-//     .face3[920] = 434,
-//     .face1[921] = 434,
-//     .face2[921] = 495,
-//     .face3[921] = 499,
-//     .face1[922] = 500,
-//     .face2[922] = 499,
-//     .face3[922] = 495,
-//     .face1[923] = 495,
-//     .face2[923] = 496,
-//     .face3[923] = 500,
-//     .face1[924] = 501,
-//     .face2[924] = 500,
-//     .face3[924] = 496,
-//     .face1[925] = 496,
-//     .face2[925] = 497,
-//     .face3[925] = 501,
-//     .face1[926] = 502,
-//     .face2[926] = 501,
-//     .face3[926] = 497,
-//     .face1[927] = 497,
-//     .face2[927] = 498,
-//     .face3[927] = 502,
-//     .face1[928] = 503,
-//     .face2[928] = 442,
-//     .face3[928] = 438,
-//     .face1[929] = 438,
-//     .face2[929] = 499,
-//     .face3[929] = 503,
-//     .face1[930] = 504,
-//     .face2[930] = 503,
-//     .face3[930] = 499,
-//     .face1[931] = 499,
-//     .face2[931] = 500,
-//     .face3[931] = 504,
-//     .face1[932] = 505,
-//     .face2[932] = 504,
-//     .face3[932] = 500,
-//     .face1[933] = 500,
-//     .face2[933] = 501,
-//     .face3[933] = 505,
-//     .face1[934] = 506,
-//     .face2[934] = 505,
-//     .face3[934] = 501,
-//     .face1[935] = 501,
-//     .face2[935] = 502,
-//     .face3[935] = 506,
-//     .face1[936] = 507,
-//     .face2[936] = 446,
-//     .face3[936] = 442,
-//     .face1[937] = 442,
-//     .face2[937] = 503,
-//     .face3[937] = 507,
-//     .face1[938] = 508,
-//     .face2[938] = 507,
-//     .face3[938] = 503,
-//     .face1[939] = 503,
-//     .face2[939] = 504,
-//     .face3[939] = 508,
-//     .face1[940] = 509,
-//     .face2[940] = 508,
-//     .face3[940] = 504,
-//     .face1[941] = 504,
-//     .face2[941] = 505,
-//     .face3[941] = 509,
-//     .face1[942] = 510,
-//     .face2[942] = 509,
-//     .face3[942] = 505,
-//     .face1[943] = 505,
-//     .face2[943] = 506,
-//     .face3[943] = 510,
-//     .face1[944] = 511,
-//     .face2[944] = 450,
-//     .face3[944] = 446,
-//     .face1[945] = 446,
-//     .face2[945] = 507,
-//     .face3[945] = 511,
-//     .face1[946] = 512,
-//     .face2[946] = 511,
-//     .face3[946] = 507,
-//     .face1[947] = 507,
-//     .face2[947] = 508,
-//     .face3[947] = 512,
-//     .face1[948] = 513,
-//     .face2[948] = 512,
-//     .face3[948] = 508,
-//     .face1[949] = 508,
-//     .face2[949] = 509,
-//     .face3[949] = 513,
-//     .face1[950] = 514,
-//     .face2[950] = 513,
-//     .face3[950] = 509,
-//     .face1[951] = 509,
-//     .face2[951] = 510,
-//     .face3[951] = 514,
-//     .face1[952] = 515,
-//     .face2[952] = 454,
-//     .face3[952] = 450,
-//     .face1[953] = 450,
-//     .face2[953] = 511,
-//     .face3[953] = 515,
-//     .face1[954] = 516,
-//     .face2[954] = 515,
-//     .face3[954] = 511,
-//     .face1[955] = 511,
-//     .face2[955] = 512,
-//     .face3[955] = 516,
-//     .face1[956] = 517,
-//     .face2[956] = 516,
-//     .face3[956] = 512,
-//     .face1[957] = 512,
-//     .face2[957] = 513,
-//     .face3[957] = 517,
-//     .face1[958] = 518,
-//     .face2[958] = 517,
-//     .face3[958] = 513,
-//     .face1[959] = 513,
-//     .face2[959] = 514,
-//     .face3[959] = 518,
-//     .face1[960] = 519,
-//     .face2[960] = 458,
-//     .face3[960] = 454,
-//     .face1[961] = 454,
-//     .face2[961] = 515,
-//     .face3[961] = 519,
-//     .face1[962] = 520,
-//     .face2[962] = 519,
-//     .face3[962] = 515,
-//     .face1[963] = 515,
-//     .face2[963] = 516,
-//     .face3[963] = 520,
-//     .face1[964] = 521,
-//     .face2[964] = 520,
-//     .face3[964] = 516,
-//     .face1[965] = 516,
-//     .face2[965] = 517,
-//     .face3[965] = 521,
-//     .face1[966] = 522,
-//     .face2[966] = 521,
-//     .face3[966] = 517,
-//     .face1[967] = 517,
-//     .face2[967] = 518,
-//     .face3[967] = 522,
-//     .face1[968] = 523,
-//     .face2[968] = 462,
-//     .face3[968] = 458,
-//     .face1[969] = 458,
-//     .face2[969] = 519,
-//     .face3[969] = 523,
-//     .face1[970] = 524,
-//     .face2[970] = 523,
-//     .face3[970] = 519,
-//     .face1[971] = 519,
-//     .face2[971] = 520,
-//     .face3[971] = 524,
-//     .face1[972] = 525,
-//     .face2[972] = 524,
-//     .face3[972] = 520,
-//     .face1[973] = 520,
-//     .face2[973] = 521,
-//     .face3[973] = 525,
-//     .face1[974] = 526,
-//     .face2[974] = 525,
-//     .face3[974] = 521,
-//     .face1[975] = 521,
-//     .face2[975] = 522,
-//     .face3[975] = 526,
-//     .face1[976] = 527,
-//     .face2[976] = 466,
-//     .face3[976] = 462,
-//     .face1[977] = 462,
-//     .face2[977] = 523,
-//     .face3[977] = 527,
-//     .face1[978] = 528,
-//     .face2[978] = 527,
-//     .face3[978] = 523,
-//     .face1[979] = 523,
-//     .face2[979] = 524,
-//     .face3[979] = 528,
-//     .face1[980] = 529,
-//     .face2[980] = 528,
-//     .face3[980] = 524,
-//     .face1[981] = 524,
-//     .face2[981] = 525,
-//     .face3[981] = 529,
-//     .face1[982] = 530,
-//     .face2[982] = 529,
-//     .face3[982] = 525,
-//     .face1[983] = 525,
-//     .face2[983] = 526,
-//     .face3[983] = 530,
-//     .face1[984] = 468,
-//     .face2[984] = 410,
-//     .face3[984] = 466,
-//     .face1[985] = 466,
-//     .face2[985] = 527,
-//     .face3[985] = 468,
-//     .face1[986] = 470,
-//     .face2[986] = 468,
-//     .face3[986] = 527,
-//     .face1[987] = 527,
-//     .face2[987] = 528,
-//     .face3[987] = 470,
-//     .face1[988] = 472,
-//     .face2[988] = 470,
-//     .face3[988] = 528,
-//     .face1[989] = 528,
-//     .face2[989] = 529,
-//     .face3[989] = 472,
-//     .face1[990] = 474,
-//     .face2[990] = 472,
-//     .face3[990] = 529,
-//     .face1[991] = 529,
-//     .face2[991] = 530,
-//     .face3[991] = 474};
+//result = a * b, i.e. b is applied first. result may be the same as a or b
+void Matrix4_Multiply(Matrix4* result, const Matrix4* a, const Matrix4* b);
 
-// Teapot LoadTeapot();
+void Matrix4_RotationX(Matrix4* m, uint16_t angle);
 
-#endif
\ No newline at end of file
+void Matrix4_RotationY(Matrix4* m, uint16_t angle);
+
+void Matrix4_RotationZ(Matrix4* m, uint16_t angle);
+
+void Matrix4_Translation(Matrix4* m, fixed x, fixed y, fixed z);
+
+//Focal length in pixels (how far the screen is from the eye) and the near and far clip distances
+void Draw3D_SetCamera(uint16_t focal, fixed nearZ, fixed farZ);
+
+//Transform count points held as separate x, y and z arrays in 1 / 2^shift units into 16.16 fixed
+//point. Ignores the bottom row of the matrix
+void Draw3D_TransformVertices(const Matrix4* m, const int16_t* x, const int16_t* y, const int16_t* z, uint16_t count,
+                              uint8_t shift, fixed* outX, fixed* outY, fixed* outZ);
+
+//Draw a mesh in wireframe. stats may be 0
+void Draw3D_DrawMesh(const Mesh* mesh, const Matrix4* transform, uint8_t colour, MeshStatistics* stats);
+
+//Start collecting solid triangles for one frame
+void Draw3D_BeginScene();
+
+//Add a mesh's visible faces to the scene, flat shaded when colour is in the colour cube. stats may be 0
+void Draw3D_AddSolidMesh(const Mesh* mesh, const Matrix4* transform, uint8_t colour, MeshStatistics* stats);
+
+//Rasterise the scene a scanline at a time. Each line is resolved against a one line depth buffer
+//first, so every pixel is written to the screen once however many triangles cover it
+void Draw3D_EndScene();
+
+//Rotates about x, then y, then z, then moves to the instance's position
+void DrawUserMesh(MeshInstance* instance);
+
+//Draws count instances as one scene, so solid meshes hide each other correctly. Wireframe meshes
+//are drawn afterwards, on top of the solid ones
+void DrawUserScene(MeshInstance* instances, uint32_t count);
+
+#endif
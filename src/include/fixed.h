@@ -0,0 +1,51 @@
+#ifndef _FIXED_H
+#define _FIXED_H
+#include <stdint.h>
+
+// 16.16 fixed point arithmetic, for code that would otherwise need floating point.
+//
+// The kernel is built without SSE and without the compiler's 64-bit division helpers, so
+// these use 32 and 64-bit integer multiplies, table lookups and (for division) idiv directly.
+// Results that do not fit are saturated to FIXED_MAX or FIXED_MIN.
+
+typedef int32_t fixed;
+
+#define FIXED_SHIFT 16
+#define FIXED_ONE (1 << FIXED_SHIFT)
+#define FIXED_HALF (1 << (FIXED_SHIFT - 1))
+#define FIXED_MAX INT32_MAX
+#define FIXED_MIN INT32_MIN
+
+#define FIXED_FROM_INT(i) ((fixed)((uint32_t)(i) << FIXED_SHIFT))
+// Rounds towards minus infinity
+#define FIXED_TO_INT(f) ((f) >> FIXED_SHIFT)
+#define FIXED_ROUND(f) (((f) + FIXED_HALF) >> FIXED_SHIFT)
+#define FIXED_FROM_FLOAT(f) ((fixed)((f) * (float)FIXED_ONE))
+#define FIXED_TO_FLOAT(f) ((float)(f) / (float)FIXED_ONE)
+
+// Angles are binary: a whole turn is FIXED_ANGLE_TURN, so they wrap round for free in a uint16_t
+#define FIXED_ANGLE_TURN 65536
+#define FIXED_ANGLE_FROM_DEGREES(d) ((uint16_t)((int32_t)(d) * FIXED_ANGLE_TURN / 360))
+
+fixed FixedMultiply(fixed a, fixed b);
+
+// a / b. Dividing by 0 gives FIXED_MAX or FIXED_MIN, depending on the sign of a
+fixed FixedDivide(fixed a, fixed b);
+
+// 1 / x from a table and one Newton-Raphson step, to within 1/65536. Cheaper
+// than FixedDivide when several values are divided by the same number, e.g. a perspective divide
+fixed FixedReciprocal(fixed x);
+
+// From a quarter wave table of 257 entries with linear interpolation; within 2/65536 of the
+// true value
+fixed FixedSin(uint16_t angle);
+
+fixed FixedCos(uint16_t angle);
+
+// Square root of a non-negative value; negative values give 0
+fixed FixedSqrt(fixed x);
+
+// Integer square root, rounded down
+uint32_t ISqrt(uint32_t x);
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef _FONT_H
+#define _FONT_H
+
+#include <stdint.h>
+
+//Text font for ASCII 32 (space) to 126 (~). Each glyph is FONT_HEIGHT lines of one 16 bit mask,
+//with the leftmost pixel in bit 0, so lit pixels can be found with a bit scan. font.c is
+//generated from fonts/font9x16.pbm by host/fontconv.c
+
+#define FONT_WIDTH 9
+#define FONT_HEIGHT 16
+#define FONT_FIRST 32
+#define FONT_LAST 126
+#define FONT_GLYPH_COUNT (FONT_LAST - FONT_FIRST + 1)
+
+extern const uint16_t FontGlyphs[FONT_GLYPH_COUNT][FONT_HEIGHT];
+
+#endif
@@ -50,6 +50,15 @@ const char *  HAL_GetCPUVendor();
 // Return current tick count 
 uint32_t HAL_GetTickCount();
 
+// Set handler to be called (in interrupt context) on every clock tick
+void HAL_SetTickHandler(void (*handler)(uint32_t));
+
+// Return the processor's time stamp counter
+uint64_t HAL_ReadTimeStampCounter();
+
+// Write a string to the first serial port
+void HAL_SerialWriteString(const char * s);
+
 // Wait for a specified number of tick counts
 void HAL_Sleep(uint32_t tickCount); 
 
@@ -0,0 +1,92 @@
+#ifndef _IORING_H
+#define _IORING_H
+#include <stdint.h>
+
+// Asynchronous I/O rings shared between user mode and the kernel.
+//
+// User code places requests in the submission ring and tells the kernel about
+// them with a single User_IORingEnter call. The kernel posts the results to the
+// completion ring, either straight away or later from the keyboard or timer
+// interrupt. User code polls the completion ring without making a system call,
+// so it can carry on rendering while it waits for input.
+
+// Number of entries in each ring. Must be a power of two.
+#define IORING_ENTRIES			32
+
+// Submission opcodes
+
+// Does nothing, completes with a result of 0
+#define IORING_OP_NOP			0
+
+// Completes with the keycode of the next key pressed
+#define IORING_OP_READKEY		1
+
+// Executes Count DrawCommands pointed to by Param. Completes with the number executed
+#define IORING_OP_DRAWBATCH		2
+
+// Completes when the tick count reaches Param. Completes with the tick count
+#define IORING_OP_SLEEP			3
+
+// Result posted for an unknown opcode or when there is no room to hold a pending request
+#define IORING_RESULT_INVALID	-1
+#define IORING_RESULT_BUSY		-2
+
+typedef struct _IORingSubmission
+{
+	uint8_t		Opcode;
+	uint8_t		Reserved;
+	uint16_t	Count;
+	uint32_t	Param;
+	uint32_t	UserData;		// Returned untouched in the completion
+} IORingSubmission;
+
+typedef struct _IORingCompletion
+{
+	uint32_t	UserData;
+	int32_t		Result;
+} IORingCompletion;
+
+// A single call in a draw batch. Call is the index used with int 0x81 and the
+// parameters are packed exactly as the User_Draw routines pack them
+typedef struct _DrawCommand
+{
+	uint32_t	Call;
+	uint32_t	Param1;
+	uint32_t	Param2;
+	uint32_t	Param3;
+} DrawCommand;
+
+typedef struct _IORing
+{
+	volatile uint32_t	SubmissionHead;		// Advanced by the kernel
+	volatile uint32_t	SubmissionTail;		// Advanced by user code
+	volatile uint32_t	CompletionHead;		// Advanced by user code
+	volatile uint32_t	CompletionTail;		// Advanced by the kernel
+	volatile uint32_t	CompletionOverflow;	// Completions dropped because the ring was full
+	IORingSubmission	Submissions[IORING_ENTRIES];
+	IORingCompletion	Completions[IORING_ENTRIES];
+} IORing;
+
+// Kernel side (called through the system call interface)
+
+// Reset the rings and return the address of the shared ring structure
+IORing * IORing_Setup();
+
+// Consume all queued submissions. Returns the number of submissions consumed
+int IORing_Enter();
+
+// User side (these only touch the shared memory and do not trap)
+
+// Return the next free submission entry, or 0 if the submission ring is full
+IORingSubmission * IORing_GetSubmission(IORing * ring);
+
+// Make the entry returned by IORing_GetSubmission visible to the kernel
+void IORing_Submit(IORing * ring);
+
+// Return the oldest completion, or 0 if there are none
+IORingCompletion * IORing_PeekCompletion(IORing * ring);
+
+// Release the completion returned by IORing_PeekCompletion
+void IORing_AdvanceCompletion(IORing * ring);
+
+#endif
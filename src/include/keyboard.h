@@ -209,6 +209,10 @@ bool KeyboardSelfTest();
 // Wait for a raw key to be pressed
 keycode	KeyboardGetCharacter();
 
+// Install a handler that is called (in interrupt context) for each key pressed.
+// If the handler returns true the key is consumed and not returned by KeyboardGetLastKey
+void KeyboardSetKeyHandler(bool (*handler)(keycode));
+
 // Prepare keyboard driver for use
 void KeyboardInstall(int irq); 
 
@@ -0,0 +1,42 @@
+#ifndef _KPRINTF_H
+#define _KPRINTF_H
+#include <stdint.h>
+#include <stdarg.h>
+#include <size_t.h>
+
+// Formatted output for the kernel and user code.  The format understands
+//
+//		%d %i	signed decimal
+//		%u		unsigned decimal
+//		%x %X	unsigned hexadecimal, lower or upper case
+//		%p		pointer, as 0x and 8 hexadecimal digits
+//		%s		string ("(null)" for a null pointer)
+//		%c		character
+//		%%		a percent sign
+//
+// each optionally preceded by a '-' to left align, a '0' to pad numbers with zeros
+// and a field width (a number, or * to take it from the arguments).  An 'l' before
+// the conversion is accepted and ignored, since int and long are both 32 bits.
+
+// Format into buffer, which holds size bytes.  The result is always terminated, and is
+// cut short if it does not fit.  Returns the number of characters stored, not counting
+// the terminator
+
+int kvsnprintf(char * buffer, size_t size, const char * format, va_list args);
+
+int ksnprintf(char * buffer, size_t size, const char * format, ...);
+
+// Longest output kprintf and kserialprintf produce from one call; anything more is cut off
+
+#define KPRINTF_BUFFER_SIZE		256
+
+// Format into a buffer on the stack and write the result to the console with a single
+// ConsoleWriteString, so the cursor and any scrolling are dealt with once per call
+
+int kprintf(const char * format, ...);
+
+// The same, written to the first serial port
+
+int kserialprintf(const char * format, ...);
+
+#endif
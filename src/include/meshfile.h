@@ -0,0 +1,52 @@
+#ifndef _MESHFILE_H
+#define _MESHFILE_H
+
+#include <stdint.h>
+
+//	The mesh file the boot loader reads from the disk (MESHES.DAT), made from Wavefront .obj
+//	models by host/meshconv.c. It is a header followed by one record per mesh, each laid out as
+//
+//		MeshFileRecord
+//		int16_t X[VertexCount], Y[VertexCount], Z[VertexCount]
+//		uint16_t Faces[FaceCount * 3]		corners of each face in turn, anticlockwise seen from outside
+//		padding to a multiple of 4 bytes
+//
+//	Positions are quantised to steps of 1 / 2^Shift units, so a mesh costs 6 bytes per vertex and
+//	6 per face, and the pipeline reads the file where it was loaded instead of copying it.
+
+#define MESHFILE_MAGIC			0x3148534D		// "MSH1"
+#define MESHFILE_NAME_LENGTH	8
+#define MESHFILE_MAX_MESHES		16
+
+typedef struct _MeshFileHeader
+{
+	uint32_t	Magic;
+	uint16_t	MeshCount;
+	uint16_t	Reserved;
+} MeshFileHeader;
+
+typedef struct _MeshFileRecord
+{
+	char		Name[MESHFILE_NAME_LENGTH];		// Upper case, padded with zeros
+	uint16_t	VertexCount;
+	uint16_t	FaceCount;
+	uint8_t		Shift;
+	uint8_t		Reserved[3];
+	int32_t		Radius;							// Bounding sphere about the origin, 16.16
+	uint32_t	Size;							// Bytes from the start of this record to the next
+} MeshFileRecord;
+
+#ifndef MESHFILE_FORMAT_ONLY
+
+#include <draw3d.h>
+
+// Check a mesh file in memory and set up a Mesh for each record. Returns the number of meshes
+// found; a damaged file stops at the last good record
+uint16_t MeshFile_Load(const void * data, uint32_t size);
+
+// The mesh with this name, or 0 if the file did not have it
+const Mesh * MeshFile_Find(const char * name);
+
+#endif
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef _PALETTE_H
+#define _PALETTE_H
+#include <stdint.h>
+
+// The 256 colour palette, kept in a RAM shadow copy.
+//
+// Entries are changed in the shadow copy and only the entries that changed are sent to the
+// DAC, in as few runs as possible, when Palette_Flush is called (Present does this). Uploads
+// wait for vertical retrace so changes never show part way down the screen. Colour cycles
+// rotate a range of entries at a fixed rate, animating whatever is drawn in those colours
+// without touching VGA memory.
+
+// Maximum number of colour cycles running at once
+#define PALETTE_MAX_CYCLES 8
+
+// Load the shadow copy from the DAC, so entries never set through this module are known too
+void Palette_Initialise();
+
+// Set an entry (6 bits per component)
+void Palette_SetEntry(uint8_t index, uint8_t red, uint8_t green, uint8_t blue);
+
+// Set count entries starting at first from 3 bytes (red, green, blue) per entry
+void Palette_SetRange(uint8_t first, uint16_t count, const uint8_t * rgb);
+
+void Palette_GetEntry(uint8_t index, uint8_t * rgb);
+
+// Rotate entries first to first + count - 1 up by one entry every ticksPerStep ticks.
+// Returns 0 if the range is too small or PALETTE_MAX_CYCLES cycles are already running
+uint8_t Palette_AddCycle(uint8_t first, uint16_t count, uint16_t ticksPerStep);
+
+// Stop all colour cycles, leaving the entries where they are
+void Palette_StopCycles();
+
+// Advance the colour cycles and upload the changed entries. When waitForRetrace is 0 the
+// caller has just waited for vertical retrace itself. Does nothing if nothing has changed
+void Palette_Flush(uint8_t waitForRetrace);
+
+// System call versions. colour is 0x00RRGGBB; range is first << 16 | count
+void SetUserPaletteEntry(uint32_t index, uint32_t colour);
+
+void AddUserPaletteCycle(uint32_t range, uint32_t ticksPerStep);
+
+void UpdatePalette();
+
+#endif
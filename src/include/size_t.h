@@ -8,7 +8,7 @@ extern "C"
 {
 #endif
 
-typedef unsigned size_t;
+typedef __SIZE_TYPE__ size_t;
 
 #ifdef __cplusplus
 }
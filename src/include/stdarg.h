@@ -0,0 +1,13 @@
+#ifndef __STDARG_H
+#define	__STDARG_H
+
+// Standard C variable argument lists, using the compiler's built in support
+
+typedef __builtin_va_list va_list;
+
+#define va_start(list, last)	__builtin_va_start(list, last)
+#define va_arg(list, type)		__builtin_va_arg(list, type)
+#define va_copy(to, from)		__builtin_va_copy(to, from)
+#define va_end(list)			__builtin_va_end(list)
+
+#endif
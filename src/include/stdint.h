@@ -46,8 +46,8 @@ typedef unsigned long long  uint_fast64_t;
 
 // Integer types capable of holding object pointers 
 
-typedef int 				intptr_t;
-typedef unsigned int		uintptr_t;
+typedef __INTPTR_TYPE__		intptr_t;
+typedef __UINTPTR_TYPE__	uintptr_t;
 
 //  Greatest-width integer types 
 
@@ -1,6 +1,11 @@
 #ifndef _SYSAPI_H
 #define _SYSAPI_H
 
+#include <stdint.h>
+
 void InitialiseSysCalls(); 
 
+// Call a draw routine using its int 0x81 index and packed parameters. Returns false if the index is invalid
+bool SysCall_InvokeDrawCall(uint32_t index, uint32_t param1, uint32_t param2, uint32_t param3);
+
 #endif
\ No newline at end of file
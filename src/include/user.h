@@ -1,10 +1,15 @@
 #ifndef _USER_H
 #define _USER_H
 #include <keyboard.h>
+#include <ioring.h>
+#include <benchmark.h>
+#include <draw.h>
+#include <draw3d.h>
 
 void User_ConsoleWriteCharacter(unsigned char c); 
 void User_ConsoleWriteString(char* str); 
-void User_ConsoleWriteInt(unsigned int i, unsigned int base); 
+// kprintf for user code: formats with kvsnprintf, then makes a single ConsoleWriteString call
+int User_Printf(const char* format, ...);
 void User_ConsoleClearScreen(const uint8_t c); 
 void User_ConsoleGotoXY(unsigned int x, unsigned int y); 
 
@@ -18,9 +23,35 @@ void User_DrawVerticalLine(uint16_t startX, uint16_t startY, uint16_t length, ui
 void User_DrawCircle(uint16_t centreX, uint16_t centreY, uint16_t radius, uint8_t colour);
 void User_FillCircle(uint16_t centreX, uint16_t centreY, uint16_t radius, uint8_t colour);
 void User_DrawPolygon(uint16_t* xPoints, uint16_t* yPoints, uint16_t sides, uint8_t colour);
+void User_FillEllipse(uint16_t centreX, uint16_t centreY, uint16_t radiusX, uint16_t radiusY, uint8_t colour);
 void User_FillPolygon(uint16_t* xPoints, uint16_t* yPoints, uint16_t sides, uint8_t colour);
+void User_FillPolygonWithRule(uint16_t* xPoints, uint16_t* yPoints, uint16_t sides, uint8_t colour, uint8_t rule);
+void User_SetClipRectangle(uint16_t startX, uint16_t startY, uint16_t width, uint16_t height);
+void User_ResetClipRectangle();
+void User_Blit(const void* sprite, int16_t x, int16_t y, uint8_t mode, uint8_t key);
+void User_CopyRect(uint16_t sourceX, uint16_t sourceY, uint16_t width, uint16_t height, int16_t destinationX, int16_t destinationY);
+void User_DrawGradientRectangle(uint16_t startX, uint16_t startY, uint16_t width, uint16_t height, uint8_t topLeft, uint8_t topRight, uint8_t bottomLeft, uint8_t bottomRight, uint8_t dither);
+void User_SetPaletteEntry(uint8_t index, uint8_t red, uint8_t green, uint8_t blue);
+void User_CyclePalette(uint8_t first, uint16_t count, uint16_t ticksPerStep);
+void User_StopPaletteCycles();
+void User_UpdatePalette();
+void User_DrawMesh(MeshInstance* instance);
+void User_DrawScene(MeshInstance* instances, uint16_t count);
+void User_BenchmarkBlit(BlitBenchmark* results);
+void User_BenchmarkAllModes();
+void User_BenchmarkFixed(FixedBenchmark* results);
+void User_BenchmarkSpanFill(SpanFillBenchmark* results);
+void User_BenchmarkCircleFill(CircleFillBenchmark* results);
+void User_EnableBackBuffer(uint8_t enable);
+void User_Present();
+void User_EnablePageFlipping(uint8_t enable);
+void User_GetPresentStatistics(PresentStatistics* stats);
 
 void User_WriteCharacter(char c, uint16_t x, uint16_t y, uint8_t colour);
 void User_WriteText(char* str, uint16_t x, uint16_t y, uint8_t colour);
+void User_WriteTextOpaque(char* str, uint16_t x, uint16_t y, uint8_t colour, uint8_t background);
+
+IORing* User_IORingSetup();
+int User_IORingEnter();
 
 #endif
\ No newline at end of file
@@ -0,0 +1,40 @@
+#ifndef _VGAMEMORY_H
+#define _VGAMEMORY_H
+#include <stdint.h>
+#include <string.h>
+
+// Access to plane mode VGA memory.
+//
+// In plane mode a byte of VGA memory is really 4 bytes, one in each plane. Which
+// planes a write goes to depends on the map mask, which plane a read comes from
+// depends on the read map select, and every read also loads the latches. The
+// drawing code reaches plane mode memory only through these macros, so that it
+// can be built for the host against an emulated VGA (HOST_FRAMEBUFFER, see
+// host/hostvga.c). In the kernel they are plain memory accesses.
+//
+// Chain4 memory and the back buffer are ordinary linear memory and are accessed directly.
+
+#ifdef HOST_FRAMEBUFFER
+
+// Start of the 64k window the emulated VGA memory is addressed through
+uint8_t * HostVGA_GetWindow();
+
+uint8_t HostVGA_Read(const volatile uint8_t * address);
+
+void HostVGA_Write(volatile uint8_t * address, uint8_t value);
+
+void HostVGA_CopyTo(volatile uint8_t * destination, const uint8_t * source, uint32_t count);
+
+#define VGA_READ(address)					HostVGA_Read(address)
+#define VGA_WRITE(address, value)			HostVGA_Write(address, value)
+#define VGA_COPY_TO(destination, source, count)	HostVGA_CopyTo(destination, source, count)
+
+#else
+
+#define VGA_READ(address)					(*(address))
+#define VGA_WRITE(address, value)			(*(address) = (value))
+#define VGA_COPY_TO(destination, source, count)	memcpy(destination, source, count)
+
+#endif
+
+#endif
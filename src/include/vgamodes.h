@@ -4,4 +4,60 @@
 
 int VGA_SetGraphicsMode(uint16_t width, uint16_t height, uint8_t chain4);
 
+// Page flipping support. Plane mode can hold up to 3 pages in VGA memory, depending on resolution
+
+uint8_t VGA_GetPageCount();
+
+uint8_t * VGA_GetPageAddress(uint8_t page);
+
+// Rows of VGA memory from the start of a page, including off-screen rows past the last page
+uint16_t VGA_GetMemoryRows(uint8_t page);
+
+uint8_t VGA_GetDisplayPage();
+
+// Successful mode switches so far. Off-screen VGA memory may have been overwritten when this changes
+uint32_t VGA_GetModeSetCount();
+
+// Display the given page. Waits for vertical retrace so the flip is tear-free
+void VGA_SetDisplayPage(uint8_t page);
+
+// Wait until the start of the next vertical retrace
+void VGA_WaitForVerticalRetrace();
+
+// Present latency counters
+void VGA_GetRetraceStatistics(uint32_t * waits, uint64_t * cycles, uint32_t * polls);
+
+// Shadowed VGA registers. Writes that would leave a register unchanged are skipped,
+// since port I/O is far slower than memory. Counters are kept for each port
+
+#define VGA_PORT_SEQ_INDEX	0	// 0x3c4
+#define VGA_PORT_SEQ_DATA	1	// 0x3c5
+#define VGA_PORT_GC_INDEX	2	// 0x3ce
+#define VGA_PORT_GC_DATA	3	// 0x3cf
+#define VGA_PORT_DAC_INDEX	4	// 0x3c8
+#define VGA_SHADOWED_PORTS	5
+
+typedef struct _VGAPortStatistics
+{
+	uint32_t	Issued[VGA_SHADOWED_PORTS];
+	uint32_t	Elided[VGA_SHADOWED_PORTS];
+} VGAPortStatistics;
+
+void VGA_SetSequencerRegister(uint8_t index, uint8_t value);
+
+void VGA_SetGraphicsControllerRegister(uint8_t index, uint8_t value);
+
+void VGA_SetPaletteEntry(uint8_t index, uint8_t red, uint8_t green, uint8_t blue);
+
+// Upload or read back consecutive palette entries, 3 bytes (red, green, blue) each, in one
+// string I/O instruction. Use these through the palette module (palette.h) in preference
+void VGA_SetPaletteRange(uint8_t first, uint16_t count, const uint8_t * rgb);
+
+void VGA_GetPaletteRange(uint8_t first, uint16_t count, uint8_t * rgb);
+
+// Forget the shadowed values so the next write to each register goes to the hardware
+void VGA_InvalidateShadowRegisters();
+
+void VGA_GetPortStatistics(VGAPortStatistics * stats);
+
 #endif
@@ -0,0 +1,227 @@
+//	Asynchronous submission/completion rings for user I/O
+//
+//	There is a single producer and a single consumer on each ring. User code
+//	produces submissions and consumes completions; the kernel does the reverse.
+//	Completions are posted either from IORing_Enter (which runs with interrupts
+//	disabled since it is reached through an interrupt gate) or from the keyboard
+//	and timer interrupt handlers, so the kernel side never races with itself.
+
+#include <stdint.h>
+#include <hal.h>
+#include <keyboard.h>
+#include <sysapi.h>
+#include <ioring.h>
+
+#define IORING_MASK			(IORING_ENTRIES - 1)
+
+// Maximum number of requests that can be waiting on a key press or on the timer
+#define MAX_PENDING_KEYS	8
+#define MAX_PENDING_SLEEPS	8
+
+// Compiler barrier used to make sure an entry is written before the index that publishes it
+#define IORING_BARRIER()	asm volatile("" : : : "memory")
+
+typedef struct _PendingSleep
+{
+	uint32_t	UserData;
+	uint32_t	WakeTick;
+} PendingSleep;
+
+static IORing			_ring;
+
+// Requests waiting for a key press, in the order they were submitted
+static uint32_t			_pendingKeys[MAX_PENDING_KEYS];
+static uint32_t			_pendingKeyHead = 0;
+static uint32_t			_pendingKeyCount = 0;
+
+// Requests waiting for the tick count to reach a given value
+static PendingSleep		_pendingSleeps[MAX_PENDING_SLEEPS];
+static uint32_t			_pendingSleepCount = 0;
+
+static void IORingPostCompletion(uint32_t userData, int32_t result)
+{
+	if (_ring.CompletionTail - _ring.CompletionHead >= IORING_ENTRIES)
+	{
+		// User code is not keeping up. Count the loss so that it can find out
+		_ring.CompletionOverflow++;
+		return;
+	}
+	IORingCompletion * completion = &_ring.Completions[_ring.CompletionTail & IORING_MASK];
+	completion->UserData = userData;
+	completion->Result = result;
+	IORING_BARRIER();
+	_ring.CompletionTail++;
+}
+
+// Called from the keyboard interrupt handler
+static bool IORingKeyHandler(keycode key)
+{
+	if (_pendingKeyCount == 0)
+	{
+		// Nobody is waiting, so leave the key for KeyboardGetCharacter
+		return false;
+	}
+	uint32_t userData = _pendingKeys[_pendingKeyHead];
+	_pendingKeyHead = (_pendingKeyHead + 1) % MAX_PENDING_KEYS;
+	_pendingKeyCount--;
+	IORingPostCompletion(userData, key);
+	return true;
+}
+
+// Called from the timer interrupt handler
+static void IORingTickHandler(uint32_t ticks)
+{
+	uint32_t i = 0;
+	while (i < _pendingSleepCount)
+	{
+		if (ticks >= _pendingSleeps[i].WakeTick)
+		{
+			IORingPostCompletion(_pendingSleeps[i].UserData, ticks);
+			// Move the last entry into this slot and check it on the next pass
+			_pendingSleeps[i] = _pendingSleeps[--_pendingSleepCount];
+		}
+		else
+		{
+			i++;
+		}
+	}
+}
+
+static void IORingReadKey(IORingSubmission * submission)
+{
+	keycode key = KeyboardGetLastKey();
+	if (key != KEY_UNKNOWN && _pendingKeyCount == 0)
+	{
+		// A key is already waiting, so complete straight away
+		KeyboardDiscardLastKey();
+		IORingPostCompletion(submission->UserData, key);
+	}
+	else if (_pendingKeyCount < MAX_PENDING_KEYS)
+	{
+		_pendingKeys[(_pendingKeyHead + _pendingKeyCount) % MAX_PENDING_KEYS] = submission->UserData;
+		_pendingKeyCount++;
+	}
+	else
+	{
+		IORingPostCompletion(submission->UserData, IORING_RESULT_BUSY);
+	}
+}
+
+static void IORingSleep(IORingSubmission * submission)
+{
+	uint32_t ticks = HAL_GetTickCount();
+	if (ticks >= submission->Param)
+	{
+		IORingPostCompletion(submission->UserData, ticks);
+	}
+	else if (_pendingSleepCount < MAX_PENDING_SLEEPS)
+	{
+		_pendingSleeps[_pendingSleepCount].UserData = submission->UserData;
+		_pendingSleeps[_pendingSleepCount].WakeTick = submission->Param;
+		_pendingSleepCount++;
+	}
+	else
+	{
+		IORingPostCompletion(submission->UserData, IORING_RESULT_BUSY);
+	}
+}
+
+static void IORingDrawBatch(IORingSubmission * submission)
+{
+	DrawCommand * commands = (DrawCommand *)submission->Param;
+	int executed = 0;
+	if (commands)
+	{
+		for (int i = 0; i < submission->Count; i++)
+		{
+			if (SysCall_InvokeDrawCall(commands[i].Call, commands[i].Param1, commands[i].Param2, commands[i].Param3))
+			{
+				executed++;
+			}
+		}
+	}
+	IORingPostCompletion(submission->UserData, executed);
+}
+
+IORing * IORing_Setup()
+{
+	_ring.SubmissionHead = 0;
+	_ring.SubmissionTail = 0;
+	_ring.CompletionHead = 0;
+	_ring.CompletionTail = 0;
+	_ring.CompletionOverflow = 0;
+	_pendingKeyHead = 0;
+	_pendingKeyCount = 0;
+	_pendingSleepCount = 0;
+
+	KeyboardSetKeyHandler(IORingKeyHandler);
+	HAL_SetTickHandler(IORingTickHandler);
+	return &_ring;
+}
+
+int IORing_Enter()
+{
+	int consumed = 0;
+	while (_ring.SubmissionHead != _ring.SubmissionTail)
+	{
+		// Take a copy so that user code can reuse the slot as soon as we move the head on
+		IORingSubmission submission = _ring.Submissions[_ring.SubmissionHead & IORING_MASK];
+		_ring.SubmissionHead++;
+		consumed++;
+
+		switch (submission.Opcode)
+		{
+			case IORING_OP_NOP:
+				IORingPostCompletion(submission.UserData, 0);
+				break;
+
+			case IORING_OP_READKEY:
+				IORingReadKey(&submission);
+				break;
+
+			case IORING_OP_DRAWBATCH:
+				IORingDrawBatch(&submission);
+				break;
+
+			case IORING_OP_SLEEP:
+				IORingSleep(&submission);
+				break;
+
+			default:
+				IORingPostCompletion(submission.UserData, IORING_RESULT_INVALID);
+				break;
+		}
+	}
+	return consumed;
+}
+
+IORingSubmission * IORing_GetSubmission(IORing * ring)
+{
+	if (ring->SubmissionTail - ring->SubmissionHead >= IORING_ENTRIES)
+	{
+		return 0;
+	}
+	return &ring->Submissions[ring->SubmissionTail & IORING_MASK];
+}
+
+void IORing_Submit(IORing * ring)
+{
+	IORING_BARRIER();
+	ring->SubmissionTail++;
+}
+
+IORingCompletion * IORing_PeekCompletion(IORing * ring)
+{
+	if (ring->CompletionHead == ring->CompletionTail)
+	{
+		return 0;
+	}
+	IORING_BARRIER();
+	return &ring->Completions[ring->CompletionHead & IORING_MASK];
+}
+
+void IORing_AdvanceCompletion(IORing * ring)
+{
+	IORING_BARRIER();
+	ring->CompletionHead++;
+}
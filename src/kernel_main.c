@@ -9,9 +9,14 @@
 #include <sysapi.h>
 #include <user.h>
 #include <vgamodes.h>
+#include <palette.h>
 #include <print.h>
 #include <draw.h>
 #include <math.h>
+#include <fixed.h>
+#include <draw3d.h>
+#include <meshfile.h>
+#include <kprintf.h>
 
 #define PI 3.14159265
 #define PI_2 6.2831853
@@ -57,6 +62,12 @@ void InitialisePhysicalMemory()
 
 	// Reserve two block for the kernel stack and make unavailable
 	PMM_MarkRegionAsUnavailable(0x80000 - stackSize, stackSize);
+
+	// The meshes the boot loader read from the disk are used where they were loaded, so keep them
+	if (_bootInfo->MeshFileSize != 0)
+	{
+		PMM_MarkRegionAsUnavailable(_bootInfo->MeshFileAddress, _bootInfo->MeshFileSize);
+	}
 }
 
 uint16_t ChooseResolutionWidth()
@@ -123,6 +134,7 @@ uint16_t ChooseResolutionHeight()
 }
 
 void CreateColourPalette() {
+	//entries are collected in the palette's shadow copy and uploaded together at the end
 	//6 portions of each colour to get a fair representation
 	uint8_t coloursIndex[] = {0, 12, 24, 36, 48, 60};
 	uint8_t length = 6;
@@ -131,31 +143,185 @@ void CreateColourPalette() {
 	for (i = 0; i < length; i++) {
 		for (j = 0; j < length; j++) {
 			for (k = 0; k < length; k++) {
-				HAL_OutputByteToPort(0x3C8, (i*length*length) + (j*length) + k + 16);
-				HAL_OutputByteToPort(0X3C9, coloursIndex[i]);
-				HAL_OutputByteToPort(0X3C9, coloursIndex[j]);
-				HAL_OutputByteToPort(0X3C9, coloursIndex[k]);
+				Palette_SetEntry((i*length*length) + (j*length) + k + 16, coloursIndex[i], coloursIndex[j], coloursIndex[k]);
 			}
 		}
 	}
-	//white to black for remaining
-	for (i = 232; i < 255; i++) {
-		HAL_OutputByteToPort(0x3C8, i);
-		HAL_OutputByteToPort(0X3C9, i * 3);
-		HAL_OutputByteToPort(0X3C9, i * 3);
-		HAL_OutputByteToPort(0X3C9, i * 3);
+	//black to white for remaining, an even ramp that gradients can interpolate along
+	for (i = 232; i < 256; i++) {
+		uint8_t grey = (i - 232) * 63 / 23;
+		Palette_SetEntry(i, grey, grey, grey);
+	}
+	Palette_Flush(1);
+}
+
+void DrawDemoScreen()
+{
+	User_ClearScreen(screenColour);
+
+	// //Colour palette demo
+	for (int i = 0; i < 255; i++) {
+		User_DrawLine(0,i, 50, i, i);
+	}
+
+	//Drawing UI borders
+	User_DrawHorizontalLine(0, 260, screenWidth, 5);
+	User_DrawVerticalLine(60, 0, 260, 5);
+	User_DrawVerticalLine(130, 0, 260, 5);
+	User_DrawVerticalLine(230, 0, 260, 5);
+
+	//Rectangle demos
+	User_DrawRectangle(70, 10, 50, 70, 25);
+	User_FillRectangle(70, 90, 50, 50, 15);
+	User_DrawRectangle(70, 150, 50, 30, 75);
+	User_FillRectangle(70, 190, 50, 65, 165);
+
+	//Circle demos
+	User_FillCircle(160, 30, 20, 45);
+	User_FillCircle(190, 45, 25, 145);
+	User_DrawCircle(180, 110, 40, 77);
+	User_DrawCircle(165, 160, 25, 201);
+
+	//Gradient demos along the grey ramp, plain and dithered
+	User_DrawGradientRectangle(140, 195, 40, 60, 232, 255, 240, 232, 0);
+	User_DrawGradientRectangle(185, 195, 40, 60, 232, 255, 240, 232, 1);
+
+	User_WriteTextOpaque("f1 to f10 to change polygon  type below", 10, 261, 5, screenColour);
+	User_Present();
+}
+
+void ShowSpanFillBenchmark()
+{
+	//times the span fills (this overwrites the screen), then shows the tick counts
+	SpanFillBenchmark results;
+	PresentStatistics present;
+	CircleFillBenchmark circles;
+	VGAPortStatistics ports;
+	BlitBenchmark blits;
+	FixedBenchmark maths;
+	char* blitNames[BLIT_MODES] = { "opaque", "keyed", "rle", "planar", "planar key" };
+	char number[11];
+	int i, y;
+	User_BenchmarkSpanFill(&results);
+	User_BenchmarkCircleFill(&circles);
+	User_BenchmarkBlit(&blits);
+	User_BenchmarkFixed(&maths);
+	User_GetPresentStatistics(&present);
+
+	User_ClearScreen(screenColour);
+	User_WriteText("clear", 10, 10, 5);
+	ksnprintf(number, sizeof(number), "%u", results.ClearScreenTicks);
+	User_WriteText(number, 120, 10, 5);
+	User_WriteText("rectangle", 10, 30, 5);
+	ksnprintf(number, sizeof(number), "%u", results.FillRectangleTicks);
+	User_WriteText(number, 120, 30, 5);
+	User_WriteText("circle", 10, 50, 5);
+	ksnprintf(number, sizeof(number), "%u", results.FillCircleTicks);
+	User_WriteText(number, 120, 50, 5);
+	User_WriteText("ticks for 20 fills  any key", 10, 80, 5);
+	//time spent waiting for vertical retrace when flipping pages
+	User_WriteText("flips", 10, 110, 5);
+	ksnprintf(number, sizeof(number), "%u", present.Flips);
+	User_WriteText(number, 120, 110, 5);
+	User_WriteText("retrace kcycles", 10, 130, 5);
+	ksnprintf(number, sizeof(number), "%u", present.RetraceWaitKilocycles);
+	User_WriteText(number, 220, 130, 5);
+	//pixel writes and pixels covered by a filled circle at each radius. equal means no overdraw
+	for (i = 0, y = 160; i < BENCHMARK_RADII && y + 16 < screenHeight; i++, y += 20) {
+		ksnprintf(number, sizeof(number), "%u", circles.Radius[i]);
+		User_WriteText(number, 10, y, 5);
+		ksnprintf(number, sizeof(number), "%u", circles.CircleWrites[i]);
+		User_WriteText(number, 70, y, 5);
+		ksnprintf(number, sizeof(number), "%u", circles.CirclePixels[i]);
+		User_WriteText(number, 190, y, 5);
+	}
+	//map mask writes sent to the VGA and skipped because the mask was already set
+	VGA_GetPortStatistics(&ports);
+	if (y + 16 < screenHeight) {
+		ksnprintf(number, sizeof(number), "%u", ports.Issued[VGA_PORT_SEQ_DATA]);
+		User_WriteText(number, 10, y + 10, 5);
+		ksnprintf(number, sizeof(number), "%u", ports.Elided[VGA_PORT_SEQ_DATA]);
+		User_WriteText(number, 130, y + 10, 5);
+	}
+	//cycles per call of the float and fixed point maths, in a column on the right where there is room
+	if (screenWidth >= 400) {
+		char* mathsNames[6] = { "sin float", "sin fixed", "div float", "div fixed", "recip fixed", "sqrt fixed" };
+		uint32_t mathsCycles[6] = { maths.FloatSinCycles, maths.FixedSinCycles, maths.FloatDivideCycles,
+									maths.FixedDivideCycles, maths.FixedReciprocalCycles, maths.FixedSqrtCycles };
+		for (i = 0; i < 6; i++) {
+			User_WriteText(mathsNames[i], 260, 10 + i * 20, 5);
+			ksnprintf(number, sizeof(number), "%u", mathsCycles[i]);
+			User_WriteText(number, 360, 10 + i * 20, 5);
+		}
+	}
+	//sprite blitter throughput in pixels per tick
+	for (i = 0, y += 40; i < BLIT_MODES && y + 16 < screenHeight; i++, y += 20) {
+		User_WriteText(blitNames[i], 10, y, 5);
+		ksnprintf(number, sizeof(number), "%u", blits.PixelsPerTick[i]);
+		User_WriteText(number, 130, y, 5);
+	}
+	User_Present();
+}
+
+void Show3DDemo(IORing *ring)
+{
+	//spin a flat shaded cube and teapot until a key is pressed, then show the frame rate and how many
+	//of the teapot's triangles were filled each second. Colours come from the colour cube so they can be lit
+	MeshInstance meshes[2] = {
+		{ .Mesh = MeshFile_Find("CUBE"), .X = FIXED_FROM_INT(-90), .Z = FIXED_FROM_INT(250), .Colour = 40, .Style = MESH_SOLID },
+		{ .Mesh = MeshFile_Find("TEAPOT"), .X = FIXED_FROM_INT(70), .Z = FIXED_FROM_INT(320), .Colour = 222, .Style = MESH_SOLID },
+	};
+	MeshInstance *cube = &meshes[0], *teapot = &meshes[1];
+	if (cube->Mesh == 0 || teapot->Mesh == 0) {
+		User_WriteText("MESHES.DAT was not on the boot disk", 10, 10, 5);
+		User_Present();
+		return;
+	}
+	uint32_t frames = 0, triangles = 0, ticks;
+	uint32_t start = HAL_GetTickCount();
+	char number[11];
+	while (!IORing_PeekCompletion(ring)) {
+		User_ClearScreen(0);
+		cube->AngleX += 300;
+		cube->AngleY += 500;
+		teapot->AngleX += 150;
+		teapot->AngleY += 400;
+		User_DrawScene(meshes, 2);
+		User_Present();
+		frames++;
+		triangles += teapot->Statistics.FacesDrawn;
+	}
+	ticks = HAL_GetTickCount() - start;
+	if (ticks == 0) {
+		ticks = 1;
 	}
+	ksnprintf(number, sizeof(number), "%u", frames * 100 / ticks);
+	//the last frame is still on screen, so the results get a background of their own
+	User_WriteTextOpaque(number, 10, 10, 5, 0);
+	User_WriteTextOpaque("frames per second", 60, 10, 5, 0);
+	ksnprintf(number, sizeof(number), "%u", teapot->Statistics.FacesDrawn);
+	User_WriteTextOpaque(number, 10, 30, 5, 0);
+	User_WriteTextOpaque("teapot faces drawn", 60, 30, 5, 0);
+	//triangles * 100 would overflow after a few minutes, so halve the count and the ticks together
+	//until it fits. The rate keeps its precision, where dividing the ticks by 100 would not
+	while (triangles > 0xFFFFFFFF / 100 && ticks > 1) {
+		triangles >>= 1;
+		ticks >>= 1;
+	}
+	ksnprintf(number, sizeof(number), "%u", triangles * 100 / ticks);
+	User_WriteTextOpaque(number, 10, 50, 5, 0);
+	User_WriteTextOpaque("teapot triangles per second", 60, 50, 5, 0);
+	User_Present();
 }
 
 void Initialise()
 {
 	ConsoleClearScreen(0x1F);
-	ConsoleWriteString("UODOS 32-bit Kernel. Kernel size is ");
-	ConsoleWriteInt(_bootInfo->KernelSize, 10);
-	ConsoleWriteString(" bytes\n");
+	kprintf("UODOS 32-bit Kernel. Kernel size is %u bytes\n", _bootInfo->KernelSize);
 	HAL_Initialise();
 	InitialisePhysicalMemory();
 	VMM_Initialise();
+	kprintf("%u meshes loaded\n", MeshFile_Load((const void *)_bootInfo->MeshFileAddress, _bootInfo->MeshFileSize));
 	KeyboardInstall(33);
 	InitialiseSysCalls();
 }
@@ -178,33 +344,13 @@ void main(BootInfo *bootInfo)
 	VGA_SetGraphicsMode(width, height, chain4);
 	//VGA_SetGraphicsMode(320, 200,1); //for testing chain 4 enabled
 
+	Palette_Initialise();
 	CreateColourPalette();
-	User_ClearScreen(screenColour);
-
-	// //Colour palette demo
-	for (int i = 0; i < 255; i++) {
-		User_DrawLine(0,i, 50, i, i);
-	}
-
-	//Drawing UI borders
-	User_DrawHorizontalLine(0, 260, screenWidth, 5);
-	User_DrawVerticalLine(60, 0, 260, 5);
-	User_DrawVerticalLine(130, 0, 260, 5);
-	User_DrawVerticalLine(230, 0, 260, 5);
-
-	//Rectangle demos
-	User_DrawRectangle(70, 10, 50, 70, 25);
-	User_FillRectangle(70, 90, 50, 50, 15);
-	User_DrawRectangle(70, 150, 50, 30, 75);
-	User_FillRectangle(70, 190, 50, 65, 165);
-
-	//Circle demos
-	User_FillCircle(160, 30, 20, 45);
-	User_FillCircle(190, 45, 25, 145);
-	User_DrawCircle(180, 110, 40, 77);
-	User_DrawCircle(165, 160, 25, 201);
-
-	User_WriteText("f1 to f10 to change polygon  type below", 10, 261, 5);
+	//render into RAM and copy only the changed regions to the screen, so redraws don't flicker
+	User_EnableBackBuffer(1);
+	//and when more than one screen fits in VGA memory, flip between pages at vertical retrace
+	User_EnablePageFlipping(1);
+	DrawDemoScreen();
 
 	//declare variables outside loop as optimization
 	int i = 0;
@@ -216,20 +362,85 @@ void main(BootInfo *bootInfo)
 			 polyCentreY2 = 180,
 			 polySize = 2,
 			 textX = 0;
+	uint8_t cycling = 0;
 
 	uint16_t xPoints[64];
 	uint16_t yPoints1[64];
 	uint16_t yPoints2[64];
 
-	float angle = 0.0f,
-    	  theta,
-		  rcos,
+	//angles are fixed point binary angles (a whole turn is FIXED_ANGLE_TURN) so no floats are needed
+	uint16_t angle = 0,
+			 theta;
+	fixed rcos,
 		  rsin;
 
-	while (1) {
-		keycode k = KeyboardGetCharacter();
+	//Keys are read through the asynchronous I/O ring, so the loop never blocks inside the kernel
+	IORing *ring = User_IORingSetup();
+	IORingSubmission *request = IORing_GetSubmission(ring);
+	request->Opcode = IORING_OP_READKEY;
+	IORing_Submit(ring);
+	User_IORingEnter();
 
-		if (k == KEY_F1 || k == KEY_F2 || k == KEY_F3 || k == KEY_F4 || k == KEY_F5 || 
+	while (1) {
+		IORingCompletion *completion = IORing_PeekCompletion(ring);
+		if (!completion) {
+			//no key yet, any per-frame rendering would go here
+			if (cycling) {
+				User_UpdatePalette();
+			}
+			continue;
+		}
+		keycode k = completion->Result;
+		IORing_AdvanceCompletion(ring);
+
+		//queue the request for the next key before handling this one
+		request = IORing_GetSubmission(ring);
+		request->Opcode = IORING_OP_READKEY;
+		IORing_Submit(ring);
+		User_IORingEnter();
+
+		if (k == KEY_TAB) {
+			//benchmark the fill routines, then wait for a key before restoring the demo
+			ShowSpanFillBenchmark();
+			while (!IORing_PeekCompletion(ring));
+			IORing_AdvanceCompletion(ring);
+			request = IORing_GetSubmission(ring);
+			request->Opcode = IORING_OP_READKEY;
+			IORing_Submit(ring);
+			User_IORingEnter();
+			DrawDemoScreen();
+			textX = 0;
+		} else if (k == KEY_INSERT) {
+			//3D demo until a key is pressed, then its frame rate until another
+			Show3DDemo(ring);
+			for (i = 0; i < 2; i++) {
+				while (!IORing_PeekCompletion(ring));
+				IORing_AdvanceCompletion(ring);
+				request = IORing_GetSubmission(ring);
+				request->Opcode = IORING_OP_READKEY;
+				IORing_Submit(ring);
+				User_IORingEnter();
+			}
+			DrawDemoScreen();
+			textX = 0;
+		} else if (k == KEY_HOME) {
+			//time every primitive in every mode, with the results going to the serial port.
+			//this switches modes, so the demo is set up again afterwards
+			User_BenchmarkAllModes();
+			User_EnableBackBuffer(1);
+			User_EnablePageFlipping(1);
+			DrawDemoScreen();
+			textX = 0;
+		} else if (k == KEY_END) {
+			//cycle the grey ramp, animating the gradients without redrawing them
+			cycling = !cycling;
+			if (cycling) {
+				User_CyclePalette(232, 24, 5);
+			} else {
+				User_StopPaletteCycles();
+				CreateColourPalette();
+			}
+		} else if (k == KEY_F1 || k == KEY_F2 || k == KEY_F3 || k == KEY_F4 || k == KEY_F5 || 
 			k == KEY_F6 || k == KEY_F7 || k == KEY_F8 || k == KEY_F9 || k == KEY_F10) {
 			//manipulate the polygons in different ways
 			if (k == KEY_F1 && polySize < 63) {
@@ -251,29 +462,33 @@ void main(BootInfo *bootInfo)
 			} else if (k == KEY_F8) {
 				r--;
 			} else if (k == KEY_F9) {
-				angle += 0.314f; //~5% rotation
+				angle += FIXED_ANGLE_TURN / 20; //5% rotation
 			} else if (k == KEY_F10) {
-				angle -= 0.314f;
+				angle -= FIXED_ANGLE_TURN / 20;
 			}
 
 			//Reset the polygon region
 			User_FillRectangle(231, 0, polyWidth, 259, screenColour);
 			//Generate the points of a regular polygon, similar to how a circle may be drawn with triangles, but much lower number of edges.
 			for (i = 0; i < polySize; i++) {
-				theta = (PI_2/polySize) * i;
-				rcos = r * cos(theta + angle);
-				rsin = r * sin(theta + angle);
-				xPoints[i] = polyCentreX + rcos;
-				yPoints1[i] = polyCentreY1 + rsin;
-				yPoints2[i] = polyCentreY2 + rsin;
+				theta = (uint16_t)(FIXED_ANGLE_TURN * i / polySize);
+				rcos = r * FixedCos(theta + angle);
+				rsin = r * FixedSin(theta + angle);
+				xPoints[i] = FIXED_TO_INT(FIXED_FROM_INT(polyCentreX) + rcos);
+				yPoints1[i] = FIXED_TO_INT(FIXED_FROM_INT(polyCentreY1) + rsin);
+				yPoints2[i] = FIXED_TO_INT(FIXED_FROM_INT(polyCentreY2) + rsin);
 			}
-			//Draw Polygons
+			//Draw Polygons, keeping them inside their panel however far they are moved
+			User_SetClipRectangle(231, 0, polyWidth, 259);
 			User_FillPolygon(xPoints, yPoints1, polySize, polySize * 4 - 3);
 			User_DrawPolygon(xPoints, yPoints2, polySize, polySize * 4);
+			User_ResetClipRectangle();
+			User_Present();
 		} else {
 			//Convert key and output it to screen (will display nothing if not in current character set)
 			char c = KeyboardConvertKeyToASCII(k);
 			User_WriteCharacter(c, textX, 279, 5);
+			User_Present();
 			textX += 10;
 		}
 	}
@@ -5,6 +5,7 @@
 #include <hal.h>
 #include <keyboard.h>
 #include <exception.h>
+#include <console.h>
 
 // keyboard encoder 
 
@@ -102,6 +103,9 @@ static bool _keyboardResendResult = false;
 // Set if keyboard is disabled
 static bool _keyboardDisabled = false;
 
+// Called from the interrupt handler for every key pressed. Returns true if it consumed the key
+static bool (*_keyHandler)(keycode) = 0;
+
 // Original XT scan code set. Array index == make code
 static int _keyboardScancode[] = 
 {
@@ -179,8 +183,14 @@ static int _keyboardScancode[] =
 	KEY_HOME,		//0x47
 	KEY_KP_8,		//0x48	//keypad up arrow
 	KEY_PAGEUP,		//0x49
+	KEY_KP_MINUS,	//0x4a
+	KEY_KP_4,		//0x4b	//keypad left arrow
+	KEY_KP_5,		//0x4c
+	KEY_KP_6,		//0x4d	//keypad right arrow
+	KEY_KP_PLUS,	//0x4e
+	KEY_END,		//0x4f
 	KEY_KP_2,		//0x50	//keypad down arrow
-	KEY_KP_3,		//0x51	//keypad page down
+	KEY_PAGEDOWN,	//0x51
 	KEY_KP_0,		//0x52	//keypad insert key
 	KEY_KP_DECIMAL,	//0x53	//keypad delete key
 	KEY_UNKNOWN,	//0x54
@@ -190,6 +200,30 @@ static int _keyboardScancode[] =
 	KEY_F12			//0x58
 };
 
+// The cursor keys and the block above them send the make codes of the keypad keys in the
+// same place, after an 0xE0 prefix. Array index == make code - 0x47
+#define EXTENDED_SCANCODE_FIRST		0x47
+
+static int _keyboardExtendedScancode[] =
+{
+	KEY_HOME,		//0x47
+	KEY_UP,			//0x48
+	KEY_PAGEUP,		//0x49
+	KEY_UNKNOWN,	//0x4a
+	KEY_LEFT,		//0x4b
+	KEY_UNKNOWN,	//0x4c
+	KEY_RIGHT,		//0x4d
+	KEY_UNKNOWN,	//0x4e
+	KEY_END,		//0x4f
+	KEY_DOWN,		//0x50
+	KEY_PAGEDOWN,	//0x51
+	KEY_INSERT,		//0x52
+	KEY_DELETE		//0x53
+};
+
+// Set if the last scan code saved had an 0xE0 prefix
+static bool _scancodeExtended = false;
+
 // Private functions
 
 //! read status from keyboard controller
@@ -220,6 +254,49 @@ void KeyboardSendEncoderCommand(uint8_t cmd)
 	HAL_OutputByteToPort(KYBRD_ENC_CMD_REG, cmd);
 }
 
+// Convert a make code, and whether it had an 0xE0 prefix, into a key
+
+static int KeyboardScancodeToKey(int code, bool extended)
+{
+	if (extended)
+	{
+		if (code >= EXTENDED_SCANCODE_FIRST && code < EXTENDED_SCANCODE_FIRST + (int)(sizeof(_keyboardExtendedScancode) / sizeof(int)))
+		{
+			return _keyboardExtendedScancode[code - EXTENDED_SCANCODE_FIRST];
+		}
+		if (code == 0x2a || code == 0x36)
+		{
+			// Shift presses and releases the keyboard wraps around the cursor keys. They are not real
+			// shift keys, so they must not change the shift state
+			return KEY_UNKNOWN;
+		}
+	}
+	if (code >= (int)(sizeof(_keyboardScancode) / sizeof(int)))
+	{
+		return KEY_UNKNOWN;
+	}
+	return _keyboardScancode[code];
+}
+
+// Shift+PgUp and Shift+PgDn page through the text console's history. Returns true if the key was used
+
+static bool KeyboardScrollConsole(int key)
+{
+	if (!_shift)
+	{
+		return false;
+	}
+	if (key == KEY_PAGEUP)
+	{
+		return ConsoleScrollView(ConsoleGetHeight() - 1);
+	}
+	if (key == KEY_PAGEDOWN)
+	{
+		return ConsoleScrollView(1 - ConsoleGetHeight());
+	}
+	return false;
+}
+
 //	Keyboard interrupt handler
 
 #if __GNUC__ >= 7
@@ -246,6 +323,7 @@ __attribute__ ((interrupt)) void  I86KeyboardInterruptHandler(struct interrupt_f
 		else 
 		{
 			// Either the second byte of an extended scan code or a single byte scan code
+			bool extended = _extended;
 			_extended = false;
 
 			// Test if this is a break code (Original XT Scan Code Set specific)
@@ -254,7 +332,7 @@ __attribute__ ((interrupt)) void  I86KeyboardInterruptHandler(struct interrupt_f
 				// Convert the break code into its make code equivelant
 				code -= 0x80;
 				// Get the key
-				int key = _keyboardScancode[code];
+				int key = KeyboardScancodeToKey(code, extended);
 				// Test if a special key has been released and clear the appropriate flag
 				switch (key) 
 				{
@@ -278,8 +356,9 @@ __attribute__ ((interrupt)) void  I86KeyboardInterruptHandler(struct interrupt_f
 			{
 				// Save the scan code
 				_scancode = code;
+				_scancodeExtended = extended;
 				// Get the key
-				int key = _keyboardScancode[code];
+				int key = KeyboardScancodeToKey(code, extended);
 				// Test if user is holding down any special keys and set the appropriate flags
 				switch (key) 
 				{
@@ -310,6 +389,11 @@ __attribute__ ((interrupt)) void  I86KeyboardInterruptHandler(struct interrupt_f
 						_scrolllock = (_scrolllock) ? false : true;
 						break;
 				}
+				// Give the console, then any registered key handler, the chance to consume the key
+				if (KeyboardScrollConsole(key) || (_keyHandler && _keyHandler(key)))
+				{
+					_scancode = INVALID_SCANCODE;
+				}
 			}
 		}
 
@@ -362,6 +446,7 @@ void I86KeyboardInterruptHandler()
 		else 
 		{
 			// Either the second byte of an extended scan code or a single byte scan code
+			bool extended = _extended;
 			_extended = false;
 
 			// Test if this is a break code (Original XT Scan Code Set specific)
@@ -370,7 +455,7 @@ void I86KeyboardInterruptHandler()
 				// Convert the break code into its make code equivelant
 				code -= 0x80;
 				// Get the key
-				int key = _keyboardScancode[code];
+				int key = KeyboardScancodeToKey(code, extended);
 				// Test if a special key has been released and clear the appropriate flag
 				switch (key) 
 				{
@@ -394,8 +479,9 @@ void I86KeyboardInterruptHandler()
 			{
 				// Save the scan code
 				_scancode = code;
+				_scancodeExtended = extended;
 				// Get the key
-				int key = _keyboardScancode[code];
+				int key = KeyboardScancodeToKey(code, extended);
 				// Test if user is holding down any special keys and set the appropriate flags
 				switch (key) 
 				{
@@ -426,6 +512,11 @@ void I86KeyboardInterruptHandler()
 						_scrolllock = (_scrolllock) ? false : true;
 						break;
 				}
+				// Give the console, then any registered key handler, the chance to consume the key
+				if (KeyboardScrollConsole(key) || (_keyHandler && _keyHandler(key)))
+				{
+					_scancode = INVALID_SCANCODE;
+				}
 			}
 		}
 
@@ -552,7 +643,7 @@ void KeyboardSetLeds(bool num, bool caps, bool scroll)
 // Get last key stroke
 keycode KeyboardGetLastKey() 
 {
-	return (_scancode != INVALID_SCANCODE) ? ((keycode)_keyboardScancode[_scancode]) : (KEY_UNKNOWN);
+	return (_scancode != INVALID_SCANCODE) ? ((keycode)KeyboardScancodeToKey(_scancode, _scancodeExtended)) : (KEY_UNKNOWN);
 }
 
 // Discard last scan code
@@ -731,6 +822,13 @@ keycode	KeyboardGetCharacter()
 	return key;
 }
 
+// Install a handler to be called from the interrupt handler when a key is pressed.
+// If the handler returns true, the key is not kept for KeyboardGetLastKey
+void KeyboardSetKeyHandler(bool (*handler)(keycode))
+{
+	_keyHandler = handler;
+}
+
 // Prepare keyboard driver for use
 void KeyboardInstall(int irq) 
 {
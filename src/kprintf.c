@@ -0,0 +1,244 @@
+//	Formatted output (see kprintf.h)
+//
+//	Everything is formatted into a buffer first and then written out in one go, so
+//	the console sees one string per call instead of a character at a time.
+
+#include <stdint.h>
+#include <stdarg.h>
+#include <kprintf.h>
+#include <console.h>
+#include <hal.h>
+
+#define FLAG_LEFT		0x01
+#define FLAG_ZERO		0x02
+
+// Where formatted characters go. Characters past the end of the buffer are dropped,
+// leaving room for the terminator
+
+typedef struct _FormatOutput
+{
+	char *	Buffer;
+	size_t	Size;
+	size_t	Length;
+} FormatOutput;
+
+static const char _lowerDigits[] = "0123456789abcdef";
+static const char _upperDigits[] = "0123456789ABCDEF";
+
+static void PutCharacter(FormatOutput * output, char c)
+{
+	if (output->Length + 1 < output->Size)
+	{
+		output->Buffer[output->Length++] = c;
+	}
+}
+
+static void PutPadding(FormatOutput * output, char c, int count)
+{
+	while (count-- > 0)
+	{
+		PutCharacter(output, c);
+	}
+}
+
+// Write text of the given length in a field of width characters
+
+static void PutField(FormatOutput * output, const char * text, int length, int width, uint8_t flags)
+{
+	if (!(flags & FLAG_LEFT))
+	{
+		PutPadding(output, ' ', width - length);
+	}
+	for (int i = 0; i < length; i++)
+	{
+		PutCharacter(output, text[i]);
+	}
+	if (flags & FLAG_LEFT)
+	{
+		PutPadding(output, ' ', width - length);
+	}
+}
+
+// Write a number in a field of width characters. prefix ("-" or "0x") goes before any zero padding
+
+static void PutNumber(FormatOutput * output, uint32_t value, unsigned int base, const char * digits,
+					  const char * prefix, int minimumDigits, int width, uint8_t flags)
+{
+	char text[32];
+	int length = 0;
+	int prefixLength = 0;
+
+	while (prefix[prefixLength])
+	{
+		prefixLength++;
+	}
+	// The digits come out lowest first, so they are stored backwards
+	do
+	{
+		text[length++] = digits[value % base];
+		value /= base;
+	} while (value);
+	while (length < minimumDigits)
+	{
+		text[length++] = '0';
+	}
+
+	int padding = width - length - prefixLength;
+	if (!(flags & (FLAG_LEFT | FLAG_ZERO)))
+	{
+		PutPadding(output, ' ', padding);
+	}
+	for (int i = 0; i < prefixLength; i++)
+	{
+		PutCharacter(output, prefix[i]);
+	}
+	if ((flags & (FLAG_LEFT | FLAG_ZERO)) == FLAG_ZERO)
+	{
+		PutPadding(output, '0', padding);
+	}
+	while (length)
+	{
+		PutCharacter(output, text[--length]);
+	}
+	if (flags & FLAG_LEFT)
+	{
+		PutPadding(output, ' ', padding);
+	}
+}
+
+int kvsnprintf(char * buffer, size_t size, const char * format, va_list args)
+{
+	FormatOutput output = { buffer, size, 0 };
+
+	if (buffer == 0 || size == 0)
+	{
+		return 0;
+	}
+	while (*format)
+	{
+		if (*format != '%')
+		{
+			PutCharacter(&output, *format++);
+			continue;
+		}
+		format++;
+
+		uint8_t flags = 0;
+		int width = 0;
+		while (*format == '-' || *format == '0')
+		{
+			flags |= *format == '-' ? FLAG_LEFT : FLAG_ZERO;
+			format++;
+		}
+		if (*format == '*')
+		{
+			width = va_arg(args, int);
+			if (width < 0)
+			{
+				flags |= FLAG_LEFT;
+				width = -width;
+			}
+			format++;
+		}
+		while (*format >= '0' && *format <= '9')
+		{
+			width = width * 10 + *format++ - '0';
+		}
+		if (*format == 'l')
+		{
+			format++;
+		}
+
+		switch (*format)
+		{
+			case 'd':
+			case 'i':
+			{
+				int32_t value = va_arg(args, int32_t);
+				// Negate as unsigned, so the most negative value comes out right
+				uint32_t magnitude = value < 0 ? 0 - (uint32_t)value : (uint32_t)value;
+				PutNumber(&output, magnitude, 10, _lowerDigits, value < 0 ? "-" : "", 1, width, flags);
+				break;
+			}
+			case 'u':
+				PutNumber(&output, va_arg(args, uint32_t), 10, _lowerDigits, "", 1, width, flags);
+				break;
+			case 'x':
+				PutNumber(&output, va_arg(args, uint32_t), 16, _lowerDigits, "", 1, width, flags);
+				break;
+			case 'X':
+				PutNumber(&output, va_arg(args, uint32_t), 16, _upperDigits, "", 1, width, flags);
+				break;
+			case 'p':
+				PutNumber(&output, (uint32_t)(uintptr_t)va_arg(args, void *), 16, _lowerDigits, "0x", 8, width, flags & FLAG_LEFT);
+				break;
+			case 's':
+			{
+				const char * text = va_arg(args, const char *);
+				int length = 0;
+				if (text == 0)
+				{
+					text = "(null)";
+				}
+				while (text[length])
+				{
+					length++;
+				}
+				PutField(&output, text, length, width, flags);
+				break;
+			}
+			case 'c':
+			{
+				char c = (char)va_arg(args, int);
+				PutField(&output, &c, 1, width, flags);
+				break;
+			}
+			case '%':
+				PutCharacter(&output, '%');
+				break;
+			default:
+				// Not a conversion we know. Show it as it was written rather than guess at its argument
+				PutCharacter(&output, '%');
+				if (*format == 0)
+				{
+					continue;
+				}
+				PutCharacter(&output, *format);
+				break;
+		}
+		format++;
+	}
+	output.Buffer[output.Length] = 0;
+	return (int)output.Length;
+}
+
+int ksnprintf(char * buffer, size_t size, const char * format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	int length = kvsnprintf(buffer, size, format, args);
+	va_end(args);
+	return length;
+}
+
+int kprintf(const char * format, ...)
+{
+	char buffer[KPRINTF_BUFFER_SIZE];
+	va_list args;
+	va_start(args, format);
+	int length = kvsnprintf(buffer, sizeof(buffer), format, args);
+	va_end(args);
+	ConsoleWriteString(buffer);
+	return length;
+}
+
+int kserialprintf(const char * format, ...)
+{
+	char buffer[KPRINTF_BUFFER_SIZE];
+	va_list args;
+	va_start(args, format);
+	int length = kvsnprintf(buffer, sizeof(buffer), format, args);
+	va_end(args);
+	HAL_SerialWriteString(buffer);
+	return length;
+}
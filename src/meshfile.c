@@ -0,0 +1,106 @@
+//	Meshes loaded from the boot disk
+//
+//	The boot loader copies MESHES.DAT into low memory next to the kernel and
+//	passes its address in the BootInfo structure. The Mesh structures set up
+//	here point straight at the positions and faces in that copy, so nothing is
+//	decoded or copied and the kernel image no longer carries any model data.
+
+#include <stdint.h>
+#include <draw3d.h>
+#include <meshfile.h>
+
+typedef struct _LoadedMesh
+{
+	char	Name[MESHFILE_NAME_LENGTH];
+	Mesh	Mesh;
+} LoadedMesh;
+
+static LoadedMesh	_meshes[MESHFILE_MAX_MESHES];
+static uint16_t		_meshCount = 0;
+
+// Bytes a record with these counts needs, rounded up so the next record is aligned
+static uint32_t RecordSize(uint16_t vertexCount, uint16_t faceCount)
+{
+	uint32_t size = sizeof(MeshFileRecord) + (uint32_t)vertexCount * 3 * sizeof(int16_t) +
+					(uint32_t)faceCount * 3 * sizeof(uint16_t);
+	return (size + 3) & ~3u;
+}
+
+// 1 if every face refers to a vertex the mesh has, so a bad file can't send the pipeline outside its buffers
+static int FacesValid(const uint16_t * faces, uint16_t faceCount, uint16_t vertexCount)
+{
+	for (uint32_t i = 0; i < (uint32_t)faceCount * 3; i++)
+	{
+		if (faces[i] >= vertexCount)
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+uint16_t MeshFile_Load(const void * data, uint32_t size)
+{
+	const MeshFileHeader * header = (const MeshFileHeader *)data;
+	const uint8_t * next;
+	const uint8_t * end;
+
+	_meshCount = 0;
+	if (data == 0 || size < sizeof(MeshFileHeader) || header->Magic != MESHFILE_MAGIC)
+	{
+		return 0;
+	}
+	next = (const uint8_t *)(header + 1);
+	end = (const uint8_t *)data + size;
+	for (uint16_t m = 0; m < header->MeshCount && _meshCount < MESHFILE_MAX_MESHES; m++)
+	{
+		const MeshFileRecord * record = (const MeshFileRecord *)next;
+		if ((uint32_t)(end - next) < sizeof(MeshFileRecord) ||
+			record->Size < RecordSize(record->VertexCount, record->FaceCount) ||
+			record->Size > (uint32_t)(end - next) ||
+			record->VertexCount > MESH_MAX_VERTICES || record->Shift > FIXED_SHIFT)
+		{
+			break;
+		}
+		const int16_t * positions = (const int16_t *)(record + 1);
+		const uint16_t * faces = (const uint16_t *)(positions + record->VertexCount * 3);
+		if (!FacesValid(faces, record->FaceCount, record->VertexCount))
+		{
+			break;
+		}
+
+		LoadedMesh * loaded = &_meshes[_meshCount++];
+		for (int i = 0; i < MESHFILE_NAME_LENGTH; i++)
+		{
+			loaded->Name[i] = record->Name[i];
+		}
+		loaded->Mesh.VertexCount = record->VertexCount;
+		loaded->Mesh.FaceCount = record->FaceCount;
+		loaded->Mesh.Shift = record->Shift;
+		loaded->Mesh.Radius = record->Radius;
+		loaded->Mesh.X = positions;
+		loaded->Mesh.Y = positions + record->VertexCount;
+		loaded->Mesh.Z = positions + record->VertexCount * 2;
+		loaded->Mesh.Faces = faces;
+		next += record->Size;
+	}
+	return _meshCount;
+}
+
+const Mesh * MeshFile_Find(const char * name)
+{
+	for (uint16_t m = 0; m < _meshCount; m++)
+	{
+		const char * stored = _meshes[m].Name;
+		int i = 0;
+		while (i < MESHFILE_NAME_LENGTH && stored[i] == name[i] && name[i] != 0)
+		{
+			i++;
+		}
+		if (i == MESHFILE_NAME_LENGTH ? name[i] == 0 : stored[i] == 0 && name[i] == 0)
+		{
+			return &_meshes[m].Mesh;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,169 @@
+//	Palette shadow copy, batched upload and colour cycling
+//
+//	Changes are made to _palette and recorded a bit per entry in _dirty. Flushing
+//	turns the dirty bits into runs of consecutive entries and uploads each run
+//	with VGA_SetPaletteRange, so a whole palette costs one index write and one
+//	rep outsb rather than 4 separate port writes per entry.
+
+#include <stdint.h>
+#include <hal.h>
+#include <string.h>
+#include <vgamodes.h>
+#include <palette.h>
+
+typedef struct _PaletteCycle
+{
+	uint8_t		First;
+	uint16_t	Count;
+	uint16_t	TicksPerStep;
+	uint32_t	LastStep;
+} PaletteCycle;
+
+static uint8_t		_palette[256][3];
+static uint32_t		_dirty[256 / 32];
+static uint8_t		_anyDirty = 0;
+
+static PaletteCycle	_cycles[PALETTE_MAX_CYCLES];
+static uint8_t		_cycleCount = 0;
+
+static void MarkEntryDirty(uint8_t index)
+{
+	_dirty[index >> 5] |= 1u << (index & 31);
+	_anyDirty = 1;
+}
+
+void Palette_Initialise()
+{
+	VGA_GetPaletteRange(0, 256, &_palette[0][0]);
+	memset(_dirty, 0, sizeof(_dirty));
+	_anyDirty = 0;
+	_cycleCount = 0;
+}
+
+void Palette_SetEntry(uint8_t index, uint8_t red, uint8_t green, uint8_t blue)
+{
+	uint8_t * entry = _palette[index];
+	red &= 0x3f;
+	green &= 0x3f;
+	blue &= 0x3f;
+	if (entry[0] == red && entry[1] == green && entry[2] == blue)
+	{
+		return;
+	}
+	entry[0] = red;
+	entry[1] = green;
+	entry[2] = blue;
+	MarkEntryDirty(index);
+}
+
+void Palette_SetRange(uint8_t first, uint16_t count, const uint8_t * rgb)
+{
+	for (uint16_t i = 0; i < count && first + i < 256; i++, rgb += 3)
+	{
+		Palette_SetEntry((uint8_t)(first + i), rgb[0], rgb[1], rgb[2]);
+	}
+}
+
+void Palette_GetEntry(uint8_t index, uint8_t * rgb)
+{
+	rgb[0] = _palette[index][0];
+	rgb[1] = _palette[index][1];
+	rgb[2] = _palette[index][2];
+}
+
+uint8_t Palette_AddCycle(uint8_t first, uint16_t count, uint16_t ticksPerStep)
+{
+	if (count < 2 || first + count > 256 || ticksPerStep == 0 || _cycleCount == PALETTE_MAX_CYCLES)
+	{
+		return 0;
+	}
+	PaletteCycle * cycle = &_cycles[_cycleCount++];
+	cycle->First = first;
+	cycle->Count = count;
+	cycle->TicksPerStep = ticksPerStep;
+	cycle->LastStep = HAL_GetTickCount();
+	return 1;
+}
+
+void Palette_StopCycles()
+{
+	_cycleCount = 0;
+}
+
+// Rotate a range of entries up by steps entries, wrapping the last ones round to the start
+static void RotateEntries(uint8_t first, uint16_t count, uint16_t steps)
+{
+	uint8_t rotated[256][3];
+	for (uint16_t i = 0; i < count; i++)
+	{
+		uint16_t from = (uint16_t)((i + count - steps) % count);
+		rotated[i][0] = _palette[first + from][0];
+		rotated[i][1] = _palette[first + from][1];
+		rotated[i][2] = _palette[first + from][2];
+	}
+	for (uint16_t i = 0; i < count; i++)
+	{
+		Palette_SetEntry((uint8_t)(first + i), rotated[i][0], rotated[i][1], rotated[i][2]);
+	}
+}
+
+static void AdvanceCycles()
+{
+	uint32_t now = HAL_GetTickCount();
+	for (uint8_t c = 0; c < _cycleCount; c++)
+	{
+		PaletteCycle * cycle = &_cycles[c];
+		uint32_t steps = (now - cycle->LastStep) / cycle->TicksPerStep;
+		if (steps)
+		{
+			cycle->LastStep += steps * cycle->TicksPerStep;
+			RotateEntries(cycle->First, cycle->Count, (uint16_t)(steps % cycle->Count));
+		}
+	}
+}
+
+void Palette_Flush(uint8_t waitForRetrace)
+{
+	AdvanceCycles();
+	if (!_anyDirty)
+	{
+		return;
+	}
+	if (waitForRetrace)
+	{
+		VGA_WaitForVerticalRetrace();
+	}
+	uint16_t index = 0;
+	while (index < 256)
+	{
+		if (!(_dirty[index >> 5] & (1u << (index & 31))))
+		{
+			// Skip clean entries a word at a time where possible
+			index = (index & 31) == 0 && _dirty[index >> 5] == 0 ? index + 32 : index + 1;
+			continue;
+		}
+		uint16_t first = index;
+		while (index < 256 && (_dirty[index >> 5] & (1u << (index & 31))))
+		{
+			index++;
+		}
+		VGA_SetPaletteRange((uint8_t)first, index - first, &_palette[first][0]);
+	}
+	memset(_dirty, 0, sizeof(_dirty));
+	_anyDirty = 0;
+}
+
+void SetUserPaletteEntry(uint32_t index, uint32_t colour)
+{
+	Palette_SetEntry((uint8_t)index, (uint8_t)(colour >> 16), (uint8_t)(colour >> 8), (uint8_t)colour);
+}
+
+void AddUserPaletteCycle(uint32_t range, uint32_t ticksPerStep)
+{
+	Palette_AddCycle((uint8_t)(range >> 16), (uint16_t)range, (uint16_t)ticksPerStep);
+}
+
+void UpdatePalette()
+{
+	Palette_Flush(1);
+}
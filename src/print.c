@@ -2,69 +2,63 @@
 #include <stdint.h>
 #include <draw.h>
 #include <string.h>
-
-#define FONT_WIDTH 9
-#define FONT_HEIGHT 16
-#define TOTAL_WIDTH 324
+#include <font.h>
 
 void WriteUserCharacter(char c, uint32_t position, uint8_t colour) {
     Vector2 p = Reverse32BitMergeVector2(position);
     WriteCharacter(c, p.x, p.y, colour);
 }
 
-void WriteCharacter(char c, uint16_t x, uint16_t y, uint8_t colour)
-{
-    uint16_t xpos = 0;
-    //selection for the full bitmap, see .h for more info
-    // if (c >= 32 && c <= 127) {
-    //     xpos = (c - ' ') * FONT_WIDTH;
-    // }
+//Most runs one line of a glyph can have (alternate pixels lit across the 9 columns)
+#define GLYPH_MAX_RUNS ((FONT_WIDTH + 1) / 2)
+#define TEXT_MAX_SPANS 512
 
-    //reduced character set A-Z 0-9
-    if (c >= 97 && c <= 122)
-    {
-        xpos = (c - 'a') * FONT_WIDTH;
-    }
-    else if (c >= 65 && c <= 90)
-    {
-        xpos = (c - 'A') * FONT_WIDTH;
-    }
-    else if (c >= 48 && c <= 57)
+//lit runs of the text being drawn, written out together by FillSpans
+static Span _textSpans[TEXT_MAX_SPANS];
+static uint16_t _textSpanCount = 0;
+
+static void AddGlyphSpans(char c, uint16_t x, uint16_t y, uint8_t colour)
+{
+    uint8_t code = (uint8_t)c;
+    if (code < FONT_FIRST || code > FONT_LAST)
     {
-        xpos = (c - '0' + 26) * FONT_WIDTH;
+        return;
     }
-    else
+    const uint16_t *glyph = FontGlyphs[code - FONT_FIRST];
+    if (_textSpanCount + FONT_HEIGHT * GLYPH_MAX_RUNS > TEXT_MAX_SPANS)
     {
-        return;
+        FillSpans(_textSpans, _textSpanCount, colour);
+        _textSpanCount = 0;
     }
-    // uint8_t bitmask[8] = { 128, 64, 32, 16, 8, 4, 2, 1 };
-
-    // for (uint16_t i = 0; i < FONT_WIDTH; i++) {
-    //     for (uint16_t j = 0; j < FONT_HEIGHT; j++) {
-    //         uint8_t pos = full_font[(FONT_HEIGHT * FONT_WIDTH * xpos) + j + i];
-    //         for (uint16_t k = 0; k < 8; k++) {
-    //             if (pos & bitmask[i] > 0) {
-    //                 SetPixel(x + i, y + j + k, 5);
-    //             }
-    //         }
-    //     }
-    // }
-
     for (uint16_t i = 0; i < FONT_HEIGHT; i++)
     {
-        for (uint16_t j = 0; j < FONT_WIDTH; j++)
+        //bit scan to the first lit pixel, then past the end of its run, and clear the run
+        uint32_t mask = glyph[i];
+        while (mask)
         {
-            //gets value at the point on the bitmap imported from GIMP
-            uint8_t pixel = font[(TOTAL_WIDTH * i) + xpos + j] * colour;
-            if (pixel > 0) {
-                //only sets the actual character pixels, allows a transparency affect.
-                SetPixel(x + j, y + i, pixel);
-            }
-            //upgrade idea. have a background highlighting colour as well. If 0 set to background colour value
+            uint32_t start = __builtin_ctz(mask);
+            uint32_t length = __builtin_ctz(~(mask >> start));
+            Span *span = &_textSpans[_textSpanCount++];
+            span->x = x + start;
+            span->y = y + i;
+            span->length = length;
+            mask &= ~(((1u << length) - 1) << start);
         }
     }
 }
 
+static void FlushTextSpans(uint8_t colour)
+{
+    FillSpans(_textSpans, _textSpanCount, colour);
+    _textSpanCount = 0;
+}
+
+void WriteCharacter(char c, uint16_t x, uint16_t y, uint8_t colour)
+{
+    AddGlyphSpans(c, x, y, colour);
+    FlushTextSpans(colour);
+}
+
 void WriteUserText(const char* c, uint32_t position, uint8_t colour) {
     Vector2 p = Reverse32BitMergeVector2(position);
     WriteText(c, p.x, p.y, colour);
@@ -72,49 +66,32 @@ void WriteUserText(const char* c, uint32_t position, uint8_t colour) {
 
 void WriteText(const char *text, uint16_t x, uint16_t y, uint8_t colour)
 {
-    //iterate through the provided string until we reach end character. Any character not recognised is ignored
-    uint16_t len = strlen(text);
-    for (int i = 0; i < len; i++)
+    //Transparent text: only the lit runs of each glyph are drawn, all in one FillSpans call (or a few
+    //for very long strings). Any character not in the font is skipped, leaving a gap
+    for (int i = 0; text[i] != '\0'; i++)
     {
-        //Space we just iterate, no need to print a space character
-        if (text[i] != ' ')
-        {
-            WriteCharacter(text[i], i * FONT_WIDTH + x, y, colour);
-        }
-
-        //break early if we find a null termination, should not be needed with correct strlen implementation
-        if (text[i] == '\0')
-        {
-            break;
-        }
+        AddGlyphSpans(text[i], i * FONT_WIDTH + x, y, colour);
     }
+    FlushTextSpans(colour);
+}
+
+void WriteUserTextOpaque(const char* c, uint32_t position, uint32_t colours) {
+    Vector2 p = Reverse32BitMergeVector2(position);
+    WriteTextOpaque(c, p.x, p.y, (uint8_t)colours, (uint8_t)(colours >> 8));
 }
 
-char *ToStringUint16(uint16_t i, uint16_t base)
+void WriteTextOpaque(const char *text, uint16_t x, uint16_t y, uint8_t colour, uint8_t background)
 {
-    //converts a uint16_t to a string
-    char *buffer;
-    char *buffer2;
-    uint16_t temp = i;
-    uint16_t j = 0;
-    while (temp > 0)
+    //Opaque text: in plane mode each cell is a latch copy from the glyph cache. Otherwise one fill
+    //for the whole field, then the glyph runs on top
+    if (DrawCachedText(text, x, y, colour, background))
     {
-        //get remainder and then convert to ascii, add 7 for A-F for hex, or even higher bases
-        uint16_t rem = temp % base;
-        buffer[j] = (char)(rem + '0');
-        if (rem > 9)
-        {
-            buffer[j] += 7;
-        }
-        temp /= base;
-        j++;
+        return;
     }
-    uint16_t k;
-    //reverse the buffer
-    for (k = 0; k < j; k++)
+    Rectangle field = { x, y, strlen(text) * FONT_WIDTH, FONT_HEIGHT };
+    if (field.width > 0)
     {
-        buffer2[k] = buffer[j - k - 1];
+        FillRectangle(field, background);
+        WriteText(text, x, y, colour);
     }
-    buffer2[k] = '\0';
-    return buffer2;
-}
\ No newline at end of file
+}
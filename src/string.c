@@ -69,7 +69,10 @@ errno_t strcpy_s(char *destination, size_t numberOfElements, const char *source)
 size_t strlen(const char* source) 
 {
 	size_t len = 0;
-	while (source[len++]);
+	while (source[len])
+	{
+		len++;
+	}
 	return len;
 }
 
@@ -3,10 +3,15 @@
 #include <keyboard.h>
 #include <draw.h>
 #include <print.h>
+#include <ioring.h>
+#include <benchmark.h>
+#include <palette.h>
+#include <draw3d.h>
 
 #define MAX_CONSOLECALL 5
-#define MAX_DRAWCALL 11
-#define MAX_TEXTCALL 2
+#define MAX_DRAWCALL 32
+#define MAX_TEXTCALL 3
+#define MAX_IORINGCALL 2
 
 typedef struct _SysCallInfo
 {
@@ -17,6 +22,7 @@ typedef struct _SysCallInfo
 SysCallInfo _ConsoleCalls[MAX_CONSOLECALL];
 SysCallInfo _DrawCalls[MAX_DRAWCALL];
 SysCallInfo _TextCalls[MAX_TEXTCALL];
+SysCallInfo _IORingCalls[MAX_IORINGCALL];
 
 void InitialiseConsoleCall(int index, void *sysCall, int paramCount)
 {
@@ -44,6 +50,30 @@ void InitialiseTextCall(int index, void *sysCall, int paramCount)
 	}
 }
 
+void InitialiseIORingCall(int index, void *sysCall, int paramCount)
+{
+	if (index >= 0 && index < MAX_IORINGCALL)
+	{
+		_IORingCalls[index].SysCall = sysCall;
+		_IORingCalls[index].ParamCount = paramCount;
+	}
+}
+
+// Call a draw routine directly from kernel code, using the same index and
+// packed parameters as a call through int 0x81. Returns false if the index is invalid
+
+bool SysCall_InvokeDrawCall(uint32_t index, uint32_t param1, uint32_t param2, uint32_t param3)
+{
+	if (index >= MAX_DRAWCALL || _DrawCalls[index].SysCall == 0)
+	{
+		return false;
+	}
+	// Unused parameters are simply ignored by the callee (C calling convention)
+	void (*sysFunction)(uint32_t, uint32_t, uint32_t) = _DrawCalls[index].SysCall;
+	sysFunction(param1, param2, param3);
+	return true;
+}
+
 // The new interrupt attribute has not been used here since
 // the code is so specialised.
 
@@ -54,7 +84,7 @@ void ConsoleCallDispatcher()
 	asm volatile("movl %%eax, %0"
 				 : "=r"(index));
 
-	if (index < MAX_CONSOLECALL)
+	if (index < MAX_CONSOLECALL && _ConsoleCalls[index].SysCall != 0)
 	{
 		// Temporarily save the registers that are used to pass in the parameters
 		asm volatile("push %edx\n\t"
@@ -125,7 +155,7 @@ void DrawcallDispatcher()
 	asm volatile("movl %%eax, %0"
 				 : "=r"(index));
 
-	if (index < MAX_DRAWCALL)
+	if (index < MAX_DRAWCALL && _DrawCalls[index].SysCall != 0)
 	{
 		// Temporarily save the registers that are used to pass in the parameters
 		asm volatile("push %edx\n\t"
@@ -260,13 +290,85 @@ void TextCallDispatcher()
 	asm("iret");
 }
 
+void IORingCallDispatcher()
+{
+	static int index = 0;
+	// Get index into _SysCalls table from eax
+	asm volatile("movl %%eax, %0"
+				 : "=r"(index));
+
+	if (index < MAX_IORINGCALL)
+	{
+		// Temporarily save the registers that are used to pass in the parameters
+		asm volatile("push %edx\n\t"
+					 "push %ecx\n\t"
+					 "push %ebx\n\t");
+		void *sysFunction = _IORingCalls[index].SysCall;
+		int paramCount = _IORingCalls[index].ParamCount;
+		// Now generate the code for the user call.  There is different
+		// code depending on how many parameters are passed to the function.
+		// After the call to the kernel routine, we remove the parameters from teh
+		// stack by adjusting the stack pointer.  This is the standard C calling convention.
+		switch (paramCount)
+		{
+		case 3:
+			asm volatile("pop %%ebx\n\t"
+						 "pop %%ecx\n\t"
+						 "pop %%edx\n\t"
+						 "push %%edx\n\t"
+						 "push %%ecx\n\t"
+						 "push %%ebx\n\t"
+						 "call *%0\n\t"
+						 "addl $12, %%esp"
+						 :
+						 : "r"(sysFunction));
+			break;
+
+		case 2:
+			asm volatile("pop %%ebx\n\t"
+						 "pop %%ecx\n\t"
+						 "pop %%edx\n\t"
+						 "push %%ecx\n\t"
+						 "push %%ebx\n\t"
+						 "call *%0\n\t"
+						 "addl $8, %%esp"
+						 :
+						 : "r"(sysFunction));
+			break;
+
+		case 1:
+			asm volatile("pop %%ebx\n\t"
+						 "pop %%ecx\n\t"
+						 "pop %%edx\n\t"
+						 "push %%ebx\n\t"
+						 "call *%0\n\t"
+						 "addl $4, %%esp"
+						 :
+						 : "r"(sysFunction));
+			break;
+
+		case 0:
+			asm volatile("pop %%ebx\n\t"
+						 "pop %%ecx\n\t"
+						 "pop %%edx\n\t"
+						 "call *%0\n\t"
+						 :
+						 : "r"(sysFunction));
+			break;
+		}
+	}
+	// Any value returned by the kernel routine is passed back to the caller in eax
+	asm("leave");
+	asm("iret");
+}
+
 #define I86_IDT_DESC_RING3 0x60
 
 void InitialiseSysCalls()
 {
 	InitialiseConsoleCall(0, ConsoleWriteString, 1);
 	InitialiseConsoleCall(1, ConsoleWriteCharacter, 1);
-	InitialiseConsoleCall(2, ConsoleWriteInt, 2);
+	// 2 was ConsoleWriteInt. User code formats with User_Printf and writes the result with call 0
 	InitialiseConsoleCall(3, ConsoleClearScreen, 1);
 	InitialiseConsoleCall(4, ConsoleGotoXY, 2);
 
@@ -282,14 +384,41 @@ void InitialiseSysCalls()
 	InitialiseDrawCall(8, FillUserCircle, 3);
 	InitialiseDrawCall(9, DrawUserPolygon, 3);
 	InitialiseDrawCall(10, FillUserPolygon, 3);
+	InitialiseDrawCall(11, Benchmark_SpanFill, 1);
+	InitialiseDrawCall(12, EnableBackBuffer, 1);
+	InitialiseDrawCall(13, Present, 0);
+	InitialiseDrawCall(14, EnablePageFlipping, 1);
+	InitialiseDrawCall(15, GetPresentStatistics, 1);
+	InitialiseDrawCall(16, Benchmark_CircleFill, 1);
+	InitialiseDrawCall(17, FillUserEllipse, 3);
+	InitialiseDrawCall(18, SetUserClipRectangle, 2);
+	InitialiseDrawCall(19, ResetClipRectangle, 0);
+	InitialiseDrawCall(20, BlitUserSprite, 3);
+	InitialiseDrawCall(21, Benchmark_Blit, 1);
+	InitialiseDrawCall(22, CopyUserRect, 3);
+	InitialiseDrawCall(23, DrawUserGradientRectangle, 3);
+	InitialiseDrawCall(24, Benchmark_AllModes, 0);
+	InitialiseDrawCall(25, SetUserPaletteEntry, 2);
+	InitialiseDrawCall(26, AddUserPaletteCycle, 2);
+	InitialiseDrawCall(27, Palette_StopCycles, 0);
+	InitialiseDrawCall(28, UpdatePalette, 0);
+	InitialiseDrawCall(29, Benchmark_Fixed, 1);
+	InitialiseDrawCall(30, DrawUserMesh, 1);
+	InitialiseDrawCall(31, DrawUserScene, 2);
 
 	//Initialise text writing calls
 	InitialiseTextCall(0, WriteUserCharacter, 3);
 	InitialiseTextCall(1, WriteUserText, 3);
+	InitialiseTextCall(2, WriteUserTextOpaque, 3);
+
+	//Initialise asynchronous I/O ring calls
+	InitialiseIORingCall(0, IORing_Setup, 0);
+	InitialiseIORingCall(1, IORing_Enter, 0);
 
 	// Install interrupt handler!
 	HAL_SetInterruptVector(0x80, ConsoleCallDispatcher, I86_IDT_DESC_RING3);
 	HAL_SetInterruptVector(0x81, DrawcallDispatcher, I86_IDT_DESC_RING3);
 	HAL_SetInterruptVector(0x82, TextCallDispatcher, I86_IDT_DESC_RING3); //another interrupt for text output functions
+	HAL_SetInterruptVector(0x83, IORingCallDispatcher, I86_IDT_DESC_RING3); //asynchronous I/O rings
 
 }
\ No newline at end of file
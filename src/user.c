@@ -1,6 +1,10 @@
 #include <console.h>
+#include <kprintf.h>
 #include <keyboard.h>
 #include <draw.h>
+#include <draw3d.h>
+#include <ioring.h>
+#include <benchmark.h>
 
 void User_ConsoleWriteCharacter(unsigned char c)
 {
@@ -20,14 +24,16 @@ void User_ConsoleWriteString(char* str)
 				);
 }
 
-void User_ConsoleWriteInt(unsigned int i, unsigned int base)
+// Formatted in the caller's stack and written with one console call, however many values it has
+int User_Printf(const char* format, ...)
 {
-	asm volatile("movl $2, %%eax\n\t"
-				 "movl %0, %%ecx\n\t"
-				 "movl %1, %%ebx\n\t"
-				 "int $0x80\n"
-				 : : "c"(base), "b"(i)
-				);
+	char buffer[KPRINTF_BUFFER_SIZE];
+	va_list args;
+	va_start(args, format);
+	int length = kvsnprintf(buffer, sizeof(buffer), format, args);
+	va_end(args);
+	User_ConsoleWriteString(buffer);
+	return length;
 }
 
 void User_ConsoleClearScreen(const uint8_t c)
@@ -191,6 +197,218 @@ void User_FillPolygon(uint16_t* xPoints, uint16_t* yPoints, uint16_t sides, uint
 				);
 }
 
+void User_FillPolygonWithRule(uint16_t* xPoints, uint16_t* yPoints, uint16_t sides, uint8_t colour, uint8_t rule) {
+	//the fill rule goes in the high byte of the colour
+	uint16_t colourRule = (uint16_t)colour | ((uint16_t)rule << 8);
+	uint32_t sizeCol = MergeTwo16Bit(sides, colourRule);
+	asm volatile("movl $10, %%eax\n\t"
+				 "movl %0, %%edx\n\t"
+				 "mov %1, %%ecx\n\t"
+				 "mov %2, %%ebx\n\t"
+				 "int $0x81\n"
+				 : : "d"(sizeCol), "c"(yPoints), "b"(xPoints)
+				);
+}
+
+void User_FillEllipse(uint16_t centreX, uint16_t centreY, uint16_t radiusX, uint16_t radiusY, uint8_t colour) {
+	uint32_t centre = MergeTwo16Bit(centreX, centreY);
+	uint32_t radii = MergeTwo16Bit(radiusX, radiusY);
+
+	asm volatile("movl $17, %%eax\n\t"
+				 "movl %0, %%ebx\n\t"
+				 "movl %1, %%ecx\n\t"
+				 "movzx %2, %%edx\n\t"
+				 "int $0x81\n"
+				 : : "b"(centre), "c"(radii), "d"(colour)
+				);
+}
+
+void User_BenchmarkCircleFill(CircleFillBenchmark* results) {
+	asm volatile("movl $16, %%eax\n\t"
+				 "leal (%0), %%ebx\n\t"
+				 "int $0x81\n"
+				 : : "b"(results)
+				 : "memory"
+				);
+}
+
+void User_SetClipRectangle(uint16_t startX, uint16_t startY, uint16_t width, uint16_t height) {
+	uint32_t start = MergeTwo16Bit(startX, startY);
+	uint32_t size = MergeTwo16Bit(width, height);
+	asm volatile("movl $18, %%eax\n\t"
+				 "movl %0, %%ebx\n\t"
+				 "movl %1, %%ecx\n\t"
+				 "int $0x81\n"
+				 : : "b"(start), "c"(size)
+				);
+}
+
+void User_ResetClipRectangle() {
+	asm volatile("movl $19, %%eax\n\t"
+				 "int $0x81\n"
+				 : :
+				);
+}
+
+void User_Blit(const void* sprite, int16_t x, int16_t y, uint8_t mode, uint8_t key) {
+	//sprite must match the mode: a Bitmap, RLESprite or PlanarSprite
+	uint32_t position = MergeTwo16Bit((uint16_t)x, (uint16_t)y);
+	uint32_t modeKey = mode | (key << 8);
+	asm volatile("movl $20, %%eax\n\t"
+				 "movl %0, %%ebx\n\t"
+				 "movl %1, %%ecx\n\t"
+				 "movl %2, %%edx\n\t"
+				 "int $0x81\n"
+				 : : "b"(sprite), "c"(position), "d"(modeKey)
+				 : "memory"
+				);
+}
+
+void User_CopyRect(uint16_t sourceX, uint16_t sourceY, uint16_t width, uint16_t height, int16_t destinationX, int16_t destinationY) {
+	uint32_t start = MergeTwo16Bit(sourceX, sourceY);
+	uint32_t size = MergeTwo16Bit(width, height);
+	uint32_t destination = MergeTwo16Bit((uint16_t)destinationX, (uint16_t)destinationY);
+	asm volatile("movl $22, %%eax\n\t"
+				 "movl %0, %%ebx\n\t"
+				 "movl %1, %%ecx\n\t"
+				 "movl %2, %%edx\n\t"
+				 "int $0x81\n"
+				 : : "b"(start), "c"(size), "d"(destination)
+				);
+}
+
+void User_DrawGradientRectangle(uint16_t startX, uint16_t startY, uint16_t width, uint16_t height, uint8_t topLeft, uint8_t topRight, uint8_t bottomLeft, uint8_t bottomRight, uint8_t dither) {
+	uint32_t start = MergeTwo16Bit(startX, startY);
+	uint32_t size = MergeTwo16Bit((width & 0x7FFF) | (dither ? 0x8000 : 0), height);
+	uint32_t corners = (topLeft << 24) | (topRight << 16) | (bottomLeft << 8) | bottomRight;
+	asm volatile("movl $23, %%eax\n\t"
+				 "movl %0, %%ebx\n\t"
+				 "movl %1, %%ecx\n\t"
+				 "movl %2, %%edx\n\t"
+				 "int $0x81\n"
+				 : : "b"(start), "c"(size), "d"(corners)
+				);
+}
+
+void User_SetPaletteEntry(uint8_t index, uint8_t red, uint8_t green, uint8_t blue) {
+	uint32_t colour = ((uint32_t)red << 16) | ((uint32_t)green << 8) | blue;
+	asm volatile("movl $25, %%eax\n\t"
+				 "movzx %0, %%ebx\n\t"
+				 "movl %1, %%ecx\n\t"
+				 "int $0x81\n"
+				 : : "b"(index), "c"(colour)
+				);
+}
+
+void User_CyclePalette(uint8_t first, uint16_t count, uint16_t ticksPerStep) {
+	uint32_t range = ((uint32_t)first << 16) | count;
+	asm volatile("movl $26, %%eax\n\t"
+				 "movl %0, %%ebx\n\t"
+				 "movl %1, %%ecx\n\t"
+				 "int $0x81\n"
+				 : : "b"(range), "c"((uint32_t)ticksPerStep)
+				);
+}
+
+void User_StopPaletteCycles() {
+	asm volatile("movl $27, %%eax\n\t"
+				 "int $0x81\n"
+				 : :
+				);
+}
+
+void User_UpdatePalette() {
+	asm volatile("movl $28, %%eax\n\t"
+				 "int $0x81\n"
+				 : :
+				);
+}
+
+void User_DrawMesh(MeshInstance* instance) {
+	asm volatile("movl $30, %%eax\n\t"
+				 "leal (%0), %%ebx\n\t"
+				 "int $0x81\n"
+				 : : "b"(instance)
+				 : "memory"
+				);
+}
+
+void User_DrawScene(MeshInstance* instances, uint16_t count) {
+	asm volatile("movl $31, %%eax\n\t"
+				 "leal (%0), %%ebx\n\t"
+				 "movl %1, %%ecx\n\t"
+				 "int $0x81\n"
+				 : : "b"(instances), "c"((uint32_t)count)
+				 : "memory"
+				);
+}
+
+void User_BenchmarkBlit(BlitBenchmark* results) {
+	asm volatile("movl $21, %%eax\n\t"
+				 "leal (%0), %%ebx\n\t"
+				 "int $0x81\n"
+				 : : "b"(results)
+				 : "memory"
+				);
+}
+
+void User_BenchmarkAllModes() {
+	asm volatile("movl $24, %%eax\n\t"
+				 "int $0x81\n"
+				 : :
+				 : "memory"
+				);
+}
+
+void User_BenchmarkFixed(FixedBenchmark* results) {
+	asm volatile("movl $29, %%eax\n\t"
+				 "leal (%0), %%ebx\n\t"
+				 "int $0x81\n"
+				 : : "b"(results)
+				 : "memory"
+				);
+}
+
+void User_BenchmarkSpanFill(SpanFillBenchmark* results) {
+	asm volatile("movl $11, %%eax\n\t"
+				 "leal (%0), %%ebx\n\t"
+				 "int $0x81\n"
+				 : : "b"(results)
+				 : "memory"
+				);
+}
+
+void User_EnableBackBuffer(uint8_t enable) {
+	asm volatile("movl $12, %%eax\n\t"
+				 "movzx %0, %%ebx\n\t"
+				 "int $0x81\n"
+				 : : "b"(enable)
+				);
+}
+
+void User_Present() {
+	asm volatile("movl $13, %%eax\n\t"
+				 "int $0x81\n"
+				 : :
+				);
+}
+
+void User_EnablePageFlipping(uint8_t enable) {
+	asm volatile("movl $14, %%eax\n\t"
+				 "movzx %0, %%ebx\n\t"
+				 "int $0x81\n"
+				 : : "b"(enable)
+				);
+}
+
+void User_GetPresentStatistics(PresentStatistics* stats) {
+	asm volatile("movl $15, %%eax\n\t"
+				 "leal (%0), %%ebx\n\t"
+				 "int $0x81\n"
+				 : : "b"(stats)
+				 : "memory"
+				);
+}
 
 void User_WriteCharacter(char c, uint16_t x, uint16_t y, uint8_t colour) {
 	uint32_t position = MergeTwo16Bit(x, y);
@@ -212,4 +430,34 @@ void User_WriteText(char* str, uint16_t x, uint16_t y, uint8_t colour) {
 				 "int $0x82\n"
 				 : : "b"(str), "c"(position), "d"(colour)
 				);
+}
+
+void User_WriteTextOpaque(char* str, uint16_t x, uint16_t y, uint8_t colour, uint8_t background) {
+	uint32_t position = MergeTwo16Bit(x, y);
+	uint32_t colours = ((uint32_t)background << 8) | colour;
+	asm volatile("movl $2, %%eax\n\t"
+				 "leal (%0), %%ebx\n\t"
+				 "movl %1, %%ecx\n\t"
+				 "movl %2, %%edx\n\t"
+				 "int $0x82\n"
+				 : : "b"(str), "c"(position), "d"(colours)
+				);
+}
+
+IORing* User_IORingSetup() {
+	IORing* ring;
+	asm volatile("movl $0, %%eax\n\t"
+				 "int $0x83\n"
+				 : "=a"(ring)
+				);
+	return ring;
+}
+
+int User_IORingEnter() {
+	int consumed;
+	asm volatile("movl $1, %%eax\n\t"
+				 "int $0x83\n"
+				 : "=a"(consumed)
+				);
+	return consumed;
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include <hal.h>
 #include <vgamodes.h>
+#include <vgamemory.h>
 
 //-----------------------------------------------------------------------------
 // Do not change any code in this file unless you really know what you are doing
@@ -53,14 +54,66 @@ static const uint8_t height_600[] = { 0x70, 0xf0, 0x60, 0x5b, 0x8c, 0x57, 0x58,
 
 void VGA_OutputWordToPort(uint16_t portid, uint16_t value)
 {
+#ifdef HOST_FRAMEBUFFER
+	// A word write is an index write followed by a data write to the next port
+	HAL_OutputByteToPort(portid, (uint8_t)value);
+	HAL_OutputByteToPort(portid + 1, (uint8_t)(value >> 8));
+#else
 	asm volatile ("outw %0, %1"
 				  :
 				  : "a"(value), "Nd"(portid));
+#endif
 }
 
 uint16_t screenWidth;
 uint16_t screenHeight;
 
+#ifdef HOST_FRAMEBUFFER
+#define VGA_MEMORY			((uintptr_t)HostVGA_GetWindow())
+#else
+#define VGA_MEMORY			0xA0000
+#endif
+#define VGA_PLANE_SIZE		65536L
+#define VGA_MAX_PAGES		3
+
+#define VGA_CRTC_INDEX		0x3d4
+#define VGA_INPUT_STATUS	0x3da
+#define VGA_RETRACE_BIT		0x08
+
+// Size in bytes of one page of each plane, and how many pages fit in VGA memory
+static uint32_t _pageSize = 0;
+static uint8_t	_pageCount = 1;
+static uint8_t	_displayPage = 0;
+
+// Successful mode switches so far. Anything kept in VGA memory may have been drawn over since
+static uint32_t _modeSets = 0;
+
+#define VGA_SEQ_INDEX		0x3c4
+#define VGA_SEQ_DATA		0x3c5
+#define VGA_GC_INDEX		0x3ce
+#define VGA_GC_DATA			0x3cf
+#define VGA_DAC_READ_INDEX	0x3c7
+#define VGA_DAC_WRITE_INDEX	0x3c8
+#define VGA_DAC_DATA		0x3c9
+
+#define VGA_SEQ_REGISTERS	5
+#define VGA_GC_REGISTERS	9
+
+// Shadow copies of the sequencer, graphics controller and DAC write index registers, so that
+// writes that would not change anything can be skipped. A value of -1 means not known
+static int16_t	_seqIndex = -1;
+static int16_t	_seqRegisters[VGA_SEQ_REGISTERS] = { -1, -1, -1, -1, -1 };
+static int16_t	_gcIndex = -1;
+static int16_t	_gcRegisters[VGA_GC_REGISTERS] = { -1, -1, -1, -1, -1, -1, -1, -1, -1 };
+static int16_t	_dacIndex = -1;
+
+static VGAPortStatistics _portStatistics;
+
+// Present latency counters
+static uint32_t _retraceWaits = 0;
+static uint64_t _retraceWaitCycles = 0;
+static uint32_t _retracePolls = 0;
+
 // Switch VGA Mode.
 //
 // The chain4Mode parameter should be 1 for normal mode, but 
@@ -158,6 +211,251 @@ int VGA_SetGraphicsMode(uint16_t width, uint16_t height, uint8_t chain4Mode)
 	} 
    
 	HAL_OutputByteToPort(0x3c0, 0x20); // Enable video
+
+	// The registers have been written directly above, so start the shadow copies again
+	// from what we know was left in them
+	VGA_InvalidateShadowRegisters();
+	_seqIndex = 2;
+	_seqRegisters[1] = 0x01;
+	_seqRegisters[2] = 0x0f;
+	_seqRegisters[4] = chain4Mode ? 0x0e : 0x06;
+	_gcIndex = 6;
+	_gcRegisters[5] = 0x40;
+	_gcRegisters[6] = 0x05;
+
+	// Display from the start of VGA memory and work out how many whole screens fit.
+	// In chain4 mode only one 64k window is addressable, so there is only one page.
+	VGA_OutputWordToPort(VGA_CRTC_INDEX, 0x000c);
+	VGA_OutputWordToPort(VGA_CRTC_INDEX, 0x000d);
+	_displayPage = 0;
+	if (chain4Mode)
+	{
+		_pageSize = (uint32_t)width * height;
+		_pageCount = 1;
+	}
+	else
+	{
+		_pageSize = (uint32_t)width * height / 4;
+		_pageCount = VGA_PLANE_SIZE / _pageSize;
+		if (_pageCount > VGA_MAX_PAGES)
+		{
+			_pageCount = VGA_MAX_PAGES;
+		}
+	}
+	_modeSets++;
 	return 1;
 }
 
+// Number of complete pages that fit in VGA memory in the current mode
+
+uint8_t VGA_GetPageCount()
+{
+	return _pageCount;
+}
+
+// Address of the start of a page. In plane mode this is an offset into each plane
+
+uint8_t * VGA_GetPageAddress(uint8_t page)
+{
+	return (uint8_t *)(VGA_MEMORY + _pageSize * page);
+}
+
+// Number of screen-width rows from the start of a page to the end of VGA memory.
+// Rows below the bottom of the screen (and of the last page) are off-screen memory
+
+uint16_t VGA_GetMemoryRows(uint8_t page)
+{
+	uint32_t rowBytes = _pageSize / screenHeight;
+	if (rowBytes == 0 || page >= _pageCount)
+	{
+		return 0;
+	}
+	return (uint16_t)((VGA_PLANE_SIZE - _pageSize * page) / rowBytes);
+}
+
+// Number of successful mode switches, so that code keeping images in off-screen VGA memory
+// can tell when they have to be drawn again
+
+uint32_t VGA_GetModeSetCount()
+{
+	return _modeSets;
+}
+
+// The page currently being displayed
+
+uint8_t VGA_GetDisplayPage()
+{
+	return _displayPage;
+}
+
+// Wait for the start of the next vertical retrace.  The CRTC latches the start
+// address at the start of vertical retrace, so after this returns a new start
+// address has taken effect and the previously displayed page is free
+
+void VGA_WaitForVerticalRetrace()
+{
+	// Called from system calls, which run with interrupts off, so the wait is timed with the
+	// time stamp counter rather than the tick count, which would not move
+	uint64_t start = HAL_ReadTimeStampCounter();
+	// If we are already in retrace, wait for it to finish so we don't return part way through
+	while (HAL_InputByteFromPort(VGA_INPUT_STATUS) & VGA_RETRACE_BIT)
+	{
+		_retracePolls++;
+	}
+	while (!(HAL_InputByteFromPort(VGA_INPUT_STATUS) & VGA_RETRACE_BIT))
+	{
+		_retracePolls++;
+	}
+	_retraceWaits++;
+	_retraceWaitCycles += HAL_ReadTimeStampCounter() - start;
+}
+
+// Show a page by reprogramming the CRTC start address (registers 0x0c and 0x0d),
+// then wait for vertical retrace so that the change is tear-free
+
+void VGA_SetDisplayPage(uint8_t page)
+{
+	if (page >= _pageCount)
+	{
+		return;
+	}
+	uint16_t start = (uint16_t)(_pageSize * page);
+	// Only change the start address while the display is active, so both halves are
+	// latched together at the next retrace
+	while (HAL_InputByteFromPort(VGA_INPUT_STATUS) & VGA_RETRACE_BIT);
+	VGA_OutputWordToPort(VGA_CRTC_INDEX, (uint16_t)((start & 0xff00) | 0x0c));
+	VGA_OutputWordToPort(VGA_CRTC_INDEX, (uint16_t)((start << 8) | 0x0d));
+	VGA_WaitForVerticalRetrace();
+	_displayPage = page;
+}
+
+// Return the present latency counters: number of retrace waits, total time stamp counter
+// cycles spent waiting and number of times the status register was polled while waiting
+
+void VGA_GetRetraceStatistics(uint32_t * waits, uint64_t * cycles, uint32_t * polls)
+{
+	*waits = _retraceWaits;
+	*cycles = _retraceWaitCycles;
+	*polls = _retracePolls;
+}
+
+// Forget the shadow register values, e.g. after something has programmed the VGA directly
+
+void VGA_InvalidateShadowRegisters()
+{
+	int i;
+	_seqIndex = -1;
+	for (i = 0; i < VGA_SEQ_REGISTERS; i++)
+	{
+		_seqRegisters[i] = -1;
+	}
+	_gcIndex = -1;
+	for (i = 0; i < VGA_GC_REGISTERS; i++)
+	{
+		_gcRegisters[i] = -1;
+	}
+	_dacIndex = -1;
+}
+
+// Write a byte to a port unless the shadow copy says it already holds that value
+
+static void VGA_OutputShadowedByte(uint16_t port, uint8_t value, int16_t * shadow, int counter)
+{
+	if (*shadow == value)
+	{
+		_portStatistics.Elided[counter]++;
+		return;
+	}
+	HAL_OutputByteToPort(port, value);
+	*shadow = value;
+	_portStatistics.Issued[counter]++;
+}
+
+// Set a sequencer register (e.g. index 2, the map mask), skipping the index and data
+// writes when they would not change anything
+
+void VGA_SetSequencerRegister(uint8_t index, uint8_t value)
+{
+	if (index >= VGA_SEQ_REGISTERS)
+	{
+		return;
+	}
+	VGA_OutputShadowedByte(VGA_SEQ_INDEX, index, &_seqIndex, VGA_PORT_SEQ_INDEX);
+	VGA_OutputShadowedByte(VGA_SEQ_DATA, value, &_seqRegisters[index], VGA_PORT_SEQ_DATA);
+}
+
+// Set a graphics controller register (e.g. index 4, the read map select, or 5, the mode)
+
+void VGA_SetGraphicsControllerRegister(uint8_t index, uint8_t value)
+{
+	if (index >= VGA_GC_REGISTERS)
+	{
+		return;
+	}
+	VGA_OutputShadowedByte(VGA_GC_INDEX, index, &_gcIndex, VGA_PORT_GC_INDEX);
+	VGA_OutputShadowedByte(VGA_GC_DATA, value, &_gcRegisters[index], VGA_PORT_GC_DATA);
+}
+
+// Set one palette entry (6 bits per component). The DAC moves its write index on after
+// every three data writes, so writing entries in order only sets the index once
+
+void VGA_SetPaletteEntry(uint8_t index, uint8_t red, uint8_t green, uint8_t blue)
+{
+	VGA_OutputShadowedByte(VGA_DAC_WRITE_INDEX, index, &_dacIndex, VGA_PORT_DAC_INDEX);
+	HAL_OutputByteToPort(VGA_DAC_DATA, red);
+	HAL_OutputByteToPort(VGA_DAC_DATA, green);
+	HAL_OutputByteToPort(VGA_DAC_DATA, blue);
+	// Index 255 wraps round to 0
+	_dacIndex = (uint8_t)(index + 1);
+}
+
+// Set count palette entries starting at first from 3 bytes (red, green, blue) per entry.
+// The DAC write index is set once and the data goes out in a single rep outsb
+
+void VGA_SetPaletteRange(uint8_t first, uint16_t count, const uint8_t * rgb)
+{
+	uint32_t bytes = (uint32_t)count * 3;
+	if (count == 0)
+	{
+		return;
+	}
+	VGA_OutputShadowedByte(VGA_DAC_WRITE_INDEX, first, &_dacIndex, VGA_PORT_DAC_INDEX);
+#ifdef HOST_FRAMEBUFFER
+	while (bytes--)
+	{
+		HAL_OutputByteToPort(VGA_DAC_DATA, *rgb++);
+	}
+#else
+	asm volatile("rep outsb" : "+S"(rgb), "+c"(bytes) : "d"(VGA_DAC_DATA) : "memory");
+#endif
+	_dacIndex = (uint8_t)(first + count);
+}
+
+// Read count palette entries starting at first back from the DAC, 3 bytes per entry
+
+void VGA_GetPaletteRange(uint8_t first, uint16_t count, uint8_t * rgb)
+{
+	uint32_t bytes = (uint32_t)count * 3;
+	if (count == 0)
+	{
+		return;
+	}
+	HAL_OutputByteToPort(VGA_DAC_READ_INDEX, first);
+	// Setting the read index also moves the write index, so the next write must set it again
+	_dacIndex = -1;
+#ifdef HOST_FRAMEBUFFER
+	while (bytes--)
+	{
+		*rgb++ = HAL_InputByteFromPort(VGA_DAC_DATA);
+	}
+#else
+	asm volatile("rep insb" : "+D"(rgb), "+c"(bytes) : "d"(VGA_DAC_DATA) : "memory");
+#endif
+}
+
+// Return the number of writes issued and skipped for each shadowed port
+
+void VGA_GetPortStatistics(VGAPortStatistics * stats)
+{
+	*stats = _portStatistics;
+}